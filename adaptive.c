@@ -20,12 +20,21 @@
 #include "dump1090.h"
 #include "adaptive.h"
 
+#include "dsp/helpers/log_histogram.h"
+
 //
 // gain limits
 //
 static int adaptive_gain_min;
 static int adaptive_gain_max;
 
+// Gain changes are made by the SDR gain control thread (sdrRequestGain), so
+// they don't hold up demodulation; buffers already in the FIFO were captured
+// at the old gain. Measurements and stats use the gain of the samples being
+// processed, which changes at the first buffer tagged MAGBUF_GAIN_CHANGED.
+static int adaptive_gain_step;                         // gain step of the samples being processed
+static bool adaptive_gain_pending;                     // a gain change was requested and hasn't reached us yet
+
 // gain steps relative to current gain
 static float adaptive_gain_up_db;
 static float adaptive_gain_down_db;
@@ -104,8 +113,8 @@ static void adaptive_burst_end_of_block();
 // noise floor measurement (adaptive dynamic range)
 //
 
-static unsigned *adaptive_range_radix;                 // radix-sort buckets for current block
-static unsigned adaptive_range_radix_counter;          // sum of all radix-sort buckets (= number of samples sorted)
+static uint32_t adaptive_range_histogram[LOG_HISTOGRAM_SIZE]; // log-spaced histogram of sample magnitudes for current block
+static unsigned adaptive_range_histogram_counter;      // sum of all histogram buckets (= number of samples seen)
 static double adaptive_range_smoothed;                 // smoothed noise floor estimate, dBFS
 static enum { RANGE_SCAN_IDLE, RANGE_SCAN_UP, RANGE_SCAN_DOWN } adaptive_range_state = RANGE_SCAN_UP;
 static unsigned adaptive_range_change_timer;           // countdown inhibiting control after changing gain
@@ -115,34 +124,32 @@ static int adaptive_range_gain_limit;                  // probed maximum gain st
 static void adaptive_range_update(uint16_t *buf, unsigned length);
 static void adaptive_range_end_of_block();
 
-// Try to change the SDR gain to 'step' and tell the user about it,
-// with 'why' as the reason to show. Return true if the gain actually changed.
-static bool adaptive_set_gain(int step, const char *why)
+// Ask for the SDR gain to be changed to 'step' and tell the user about it,
+// with 'why' as the reason to show. The change is picked up by
+// adaptive_begin_buffer once it has been made.
+static void adaptive_set_gain(int step, const char *why)
 {
     if (step < adaptive_gain_min)
         step = adaptive_gain_min;
     if (step > adaptive_gain_max)
         step = adaptive_gain_max;
 
-    int current_gain = sdrGetGain();
+    int current_gain = adaptive_gain_step;
     if (current_gain == step)
-        return false;
+        return;
 
     fprintf(stderr, "adaptive: changing gain from %.1fdB (step %d) to %.1fdB (step %d) because: %s\n",
             sdrGetGainDb(current_gain), current_gain, sdrGetGainDb(step), step, why);
 
-    int new_gain = sdrSetGain(step);
-    bool changed = (current_gain != new_gain);
-    if (changed)
-        ++Modes.stats_current.adaptive_gain_changes;
-    return changed;
+    adaptive_gain_pending = true;
+    sdrRequestGain(step);
 }
 
 // Update internal state to reflect a gain change
-// (usually after adaptive_set_gain returns true, but also called during init)
+// (usually from adaptive_begin_buffer, but also called during init)
 static void adaptive_gain_changed()
 {
-    int new_gain = sdrGetGain();
+    int new_gain = adaptive_gain_step;
     adaptive_gain_up_db = sdrGetGainDb(new_gain + 1) - sdrGetGainDb(new_gain);
     adaptive_gain_down_db = sdrGetGainDb(new_gain) - sdrGetGainDb(new_gain - 1);
     
@@ -195,7 +202,6 @@ void adaptive_init()
     adaptive_burst_window_remaining = adaptive_samples_per_window;
     adaptive_burst_window_counter = 0;
 
-    adaptive_range_radix = calloc(sizeof(unsigned), 65536);
     adaptive_range_state = RANGE_SCAN_UP;
 
     // select and enforce gain limits
@@ -215,10 +221,37 @@ void adaptive_init()
         fprintf(stderr, "adaptive: enabled dynamic range control, target dynamic range %.1fdB\n", Modes.adaptive_range_target);
     if (Modes.adaptive_burst_control)
         fprintf(stderr, "adaptive: enabled burst control\n");
-    adaptive_set_gain(sdrGetGain(), "constraining gain to adaptive gain limits");
+    // (no control thread yet, so this change is made straight away)
+    adaptive_gain_step = sdrGetGain();
+    adaptive_set_gain(adaptive_gain_step, "constraining gain to adaptive gain limits");
+    adaptive_gain_step = sdrGetGain();
+    adaptive_gain_pending = false;
     adaptive_gain_changed();
 
-    adaptive_range_gain_limit = sdrGetGain();
+    adaptive_range_gain_limit = adaptive_gain_step;
+
+    sdrStartGainControl();
+}
+
+// Called for each buffer before it is demodulated
+void adaptive_begin_buffer(struct mag_buf *buf)
+{
+    if (!Modes.adaptive_burst_control && !Modes.adaptive_range_control)
+        return;
+
+    // only the first source is controlled
+    if (buf->source != 0 || !(buf->flags & MAGBUF_GAIN_CHANGED) || !adaptive_gain_pending)
+        return;
+
+    // The requested gain change has been made (or has failed);
+    // the samples from here on are at the new gain
+    adaptive_gain_pending = false;
+    int new_gain = sdrGetGain();
+    if (new_gain != adaptive_gain_step) {
+        adaptive_gain_step = new_gain;
+        ++Modes.stats_current.adaptive_gain_changes;
+        adaptive_gain_changed();
+    }
 }
 
 // Feed some samples into the adaptive system. Any number of samples might be passed in.
@@ -261,6 +294,26 @@ void adaptive_update(uint16_t *buf, unsigned length, struct modesMessage *decode
     }
 }
 
+// Number of 8-bit samples widened at a time by adaptive_update_u8
+#define ADAPTIVE_WIDEN_CHUNK 4096
+
+void adaptive_update_u8(uint8_t *buf, unsigned length, struct modesMessage *decoded)
+{
+    if (!Modes.adaptive_burst_control && !Modes.adaptive_range_control)
+        return;
+
+    // widen to the 16-bit scale that the thresholds are measured in
+    uint16_t wide[ADAPTIVE_WIDEN_CHUNK];
+    while (length > 0) {
+        unsigned n = (length < ADAPTIVE_WIDEN_CHUNK ? length : ADAPTIVE_WIDEN_CHUNK);
+        for (unsigned i = 0; i < n; ++i)
+            wide[i] = buf[i] << 8;
+        adaptive_update(wide, n, decoded);
+        buf += n;
+        length -= n;
+    }
+}
+
 // Feed some samples into the adaptive system. The samples are guaranteed to not cross a subblock boundary.
 // The samples should be processsed (i.e. duty cycle is in the active part)
 static void adaptive_update_subblock(uint16_t *buf, unsigned length, struct modesMessage *decoded)
@@ -385,13 +438,10 @@ static void adaptive_range_update(uint16_t *buf, unsigned length)
     if (!Modes.adaptive_range_control)
         return;
 
-    adaptive_range_radix_counter += length;
-    while (length--) {
-        // do a very simple radix sort of sample magnitudes
-        // so we can later find the Nth percentile value
-        ++adaptive_range_radix[buf[0]];
-        ++buf;
-    }
+    // build a histogram of sample magnitudes so we can later find the
+    // (approximate) Nth percentile value
+    adaptive_range_histogram_counter += length;
+    starch_log_histogram_u16(buf, length, adaptive_range_histogram);
 }
 
 // Noise measurement: we reached the end of a block, update
@@ -403,11 +453,11 @@ static void adaptive_range_end_of_block()
 
     unsigned n = 0, i = 0;
 
-    // measure Nth percentile magnitude
-    unsigned count_n = adaptive_range_radix_counter * Modes.adaptive_range_percentile / 100;
-    while (i < 65536 && n <= count_n)
-        n += adaptive_range_radix[i++];
-    uint16_t percentile_n = i - 1;
+    // measure Nth percentile magnitude (to within one histogram bucket)
+    unsigned count_n = adaptive_range_histogram_counter * Modes.adaptive_range_percentile / 100;
+    while (i < LOG_HISTOGRAM_BUCKETS && n <= count_n)
+        n += log_histogram_count(adaptive_range_histogram, i++);
+    uint16_t percentile_n = log_histogram_value(i - 1);
 
     // maintain an EMA of the Nth percentile
     adaptive_range_smoothed = adaptive_range_smoothed * (1 - Modes.adaptive_range_alpha) + percentile_n * Modes.adaptive_range_alpha;
@@ -418,9 +468,9 @@ static void adaptive_range_end_of_block()
         Modes.stats_current.adaptive_noise_dbfs = 0;
     }
 
-    // reset radix sort for the next block
-    memset(adaptive_range_radix, 0, 65536 * sizeof(unsigned));
-    adaptive_range_radix_counter = 0;
+    // reset histogram for the next block
+    memset(adaptive_range_histogram, 0, sizeof(adaptive_range_histogram));
+    adaptive_range_histogram_counter = 0;
 }
 
 // Burst measurement: we reached the end of a block, update our burst rate estimate
@@ -449,14 +499,12 @@ void flush_stats(uint64_t now);
 
 static void adaptive_increase_gain(const char *why)
 {
-    if (adaptive_set_gain(sdrGetGain() + 1, why))
-        adaptive_gain_changed();
+    adaptive_set_gain(adaptive_gain_step + 1, why);
 }
 
 static void adaptive_decrease_gain(const char *why)
 {
-    if (adaptive_set_gain(sdrGetGain() - 1, why))
-        adaptive_gain_changed();
+    adaptive_set_gain(adaptive_gain_step - 1, why);
 }
 
 // Adaptive gain: we reached a block boundary. Update measurements and act on them.
@@ -465,10 +513,12 @@ static void adaptive_end_of_block()
     adaptive_range_end_of_block();
     adaptive_burst_end_of_block();
 
-    adaptive_control_update();
+    // don't act on anything while a gain change is on its way
+    if (!adaptive_gain_pending)
+        adaptive_control_update();
 
     Modes.stats_current.adaptive_valid = true;
-    unsigned current = Modes.stats_current.adaptive_gain = sdrGetGain();
+    unsigned current = Modes.stats_current.adaptive_gain = adaptive_gain_step;
     Modes.stats_current.adaptive_range_gain_limit = adaptive_range_gain_limit;
     ++Modes.stats_current.adaptive_gain_seconds[current < STATS_GAIN_COUNT ? current : STATS_GAIN_COUNT-1];
 }
@@ -486,7 +536,7 @@ static void adaptive_control_update()
     const char *gain_down_reason = NULL;
     bool gain_not_up = false;
 
-    int current_gain = sdrGetGain();
+    int current_gain = adaptive_gain_step;
 
     if (adaptive_burst_change_timer)
         --adaptive_burst_change_timer;
@@ -551,7 +601,7 @@ static void adaptive_control_update()
                 break;
             }
 
-            if (sdrGetGain() >= adaptive_gain_max) {
+            if (adaptive_gain_step >= adaptive_gain_max) {
                 // We have reached our upper gain limit
                 fprintf(stderr, "adaptive: reached upper gain limit, halting dynamic range scan here\n");
                 adaptive_range_state = RANGE_SCAN_IDLE;
@@ -581,7 +631,7 @@ static void adaptive_control_update()
                 adaptive_range_gain_limit = current_gain - 1;
             }
 
-            if (sdrGetGain() <= adaptive_gain_min) {
+            if (adaptive_gain_step <= adaptive_gain_min) {
                 fprintf(stderr, "adaptive: reached lower gain limit, halting dynamic range scan here\n");
                 adaptive_range_state = RANGE_SCAN_IDLE;
                 adaptive_range_rescan_timer = Modes.adaptive_range_rescan_delay;
@@ -597,7 +647,7 @@ static void adaptive_control_update()
         case RANGE_SCAN_IDLE:
             // Look for increased noise that could be compensated for by decreasing gain.
             // Do this even if we're waiting to rescan or if burst control is also active
-            if (available_range + adaptive_gain_down_db / 2 < Modes.adaptive_range_target && sdrGetGain() > adaptive_gain_min) {
+            if (available_range + adaptive_gain_down_db / 2 < Modes.adaptive_range_target && adaptive_gain_step > adaptive_gain_min) {
                 fprintf(stderr, "adaptive: available dynamic range (%.1fdB) + half gain step down (%.1fdB) < required dynamic range (%.1fdB), starting downward scan\n",
                         available_range, Modes.adaptive_range_target, adaptive_gain_down_db);
                 if (adaptive_range_gain_limit >= current_gain) {
@@ -612,7 +662,7 @@ static void adaptive_control_update()
             // Infrequently consider increasing gain to handle the case where we've selected a too-low gain where the noise floor is dominated by noise unrelated to the gain setting.
             // But don't do this while burst control is preventing gain increases.
             if (!adaptive_range_rescan_timer && !gain_not_up) {
-                if (available_range >= Modes.adaptive_range_target && sdrGetGain() < adaptive_gain_max) {
+                if (available_range >= Modes.adaptive_range_target && adaptive_gain_step < adaptive_gain_max) {
                     fprintf(stderr, "adaptive: start periodic scan for acceptable dynamic range at increased gain\n");
                     gain_up = true;
                     gain_up_reason = "periodic re-probing of dynamic range gain upper bound";
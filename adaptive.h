@@ -23,8 +23,12 @@
 #include <inttypes.h>
 
 struct modesMessage;
+struct mag_buf;
 
 void adaptive_init();
+void adaptive_begin_buffer(struct mag_buf *buf);
 void adaptive_update(uint16_t *buf, unsigned length, struct modesMessage *decoded);
+// As adaptive_update, for 8-bit magnitude samples (--demod-u8)
+void adaptive_update_u8(uint8_t *buf, unsigned length, struct modesMessage *decoded);
 
 #endif
@@ -73,17 +73,22 @@ void dumprb_startDumprb(void) {
     }
 
     int mode_ac = ini_getBoolean(configuration_file, "client", "dump_mode_ac", 1);
-    if (mode_ac) {
+    int demod_u8 = ini_getBoolean(configuration_file, "client", "dump_demod_u8", 0);
+    if (mode_ac && !demod_u8) { // the 8-bit demodulator is Mode S only
         dcmd = airnav_concat(dcmd, " --modeac");
     }
 
     if (ini_getBoolean(configuration_file, "client", "dump_fix", 1)) {
         dcmd = airnav_concat(dcmd, " --fix");
     }
+
+    if (ini_getBoolean(configuration_file, "client", "dump_fix_soft", 0)) {
+        dcmd = airnav_concat(dcmd, " --fix-soft");
+    }
     
-    //if (ini_getBoolean(configuration_file, "client", "dump_dc_filter", 1)) {
-    //    dcmd = airnav_concat(dcmd, " --dcfilter");
-    //}
+    if (ini_getBoolean(configuration_file, "client", "dump_dc_filter", 0)) {
+        dcmd = airnav_concat(dcmd, " --dcfilter");
+    }
 
     if (ini_getBoolean(configuration_file, "client", "dump_adaptive_burst", 1)) {
         dcmd = airnav_concat(dcmd, " --adaptive-burst");
@@ -92,12 +97,133 @@ void dumprb_startDumprb(void) {
     if (ini_getBoolean(configuration_file, "client", "dump_adaptive_range", 1)) {
         dcmd = airnav_concat(dcmd, " --adaptive-range");
     }
+
+    if (ini_getBoolean(configuration_file, "client", "dump_overload_shedding", 0)) {
+        dcmd = airnav_concat(dcmd, " --overload-shedding");
+    }
     
     
     if (use_gnss == 1) {
         dcmd = airnav_concat(dcmd, " --gnss");
     }
 
+    // RTL-SDR USB buffering (0 keeps the dump1090-rb defaults)
+    int rtl_buffers = ini_getInteger(configuration_file, "client", "dump_rtl_buffers", 0);
+    if (rtl_buffers > 0) {
+        dcmd = airnav_concat(dcmd, " --rtl-buffers %d", rtl_buffers);
+    }
+
+    int rtl_buffer_size = ini_getInteger(configuration_file, "client", "dump_rtl_buffer_size", 0);
+    if (rtl_buffer_size > 0) {
+        dcmd = airnav_concat(dcmd, " --rtl-buffer-size %d", rtl_buffer_size);
+    }
+
+    // Sample rate in MHz, 2.4 or 2.0 (empty keeps the dump1090-rb default)
+    char *sample_rate = NULL;
+    ini_getString(&sample_rate, configuration_file, "client", "dump_sample_rate", "");
+    if (sample_rate != NULL && strlen(sample_rate) > 0) {
+        dcmd = airnav_concat(dcmd, " --sample-rate %s", sample_rate);
+    }
+    free(sample_rate);
+
+    // SDR capture rate in MHz, resampled to the sample rate (e.g. 2.56, 3.2 or 6)
+    char *capture_rate = NULL;
+    ini_getString(&capture_rate, configuration_file, "client", "dump_capture_rate", "");
+    if (capture_rate != NULL && strlen(capture_rate) > 0) {
+        dcmd = airnav_concat(dcmd, " --capture-rate %s", capture_rate);
+    }
+    free(capture_rate);
+
+    // Mode S preamble detector, heuristic or correlate (empty keeps the default)
+    char *preamble_detector = NULL;
+    ini_getString(&preamble_detector, configuration_file, "client", "dump_preamble_detector", "");
+    if (preamble_detector != NULL && strlen(preamble_detector) > 0) {
+        dcmd = airnav_concat(dcmd, " --preamble-detector %s", preamble_detector);
+    }
+    free(preamble_detector);
+
+    // Demodulate 8-bit magnitudes, for small CPUs (rtlsdr at 2.4MHz, no Mode A/C)
+    if (demod_u8) {
+        dcmd = airnav_concat(dcmd, " --demod-u8");
+    }
+
+    // CPU pinning (-1 to leave unpinned) and SCHED_FIFO priority (0 for
+    // default scheduling) of the reader and demodulator threads
+    int reader_cpu = ini_getInteger(configuration_file, "client", "dump_reader_cpu", -1);
+    if (reader_cpu >= 0) {
+        dcmd = airnav_concat(dcmd, " --reader-cpu %d", reader_cpu);
+    }
+
+    int demod_cpu = ini_getInteger(configuration_file, "client", "dump_demod_cpu", -1);
+    if (demod_cpu >= 0) {
+        dcmd = airnav_concat(dcmd, " --demod-cpu %d", demod_cpu);
+    }
+
+    int reader_priority = ini_getInteger(configuration_file, "client", "dump_reader_priority", 0);
+    if (reader_priority > 0) {
+        dcmd = airnav_concat(dcmd, " --reader-priority %d", reader_priority);
+    }
+
+    int demod_priority = ini_getInteger(configuration_file, "client", "dump_demod_priority", 0);
+    if (demod_priority > 0) {
+        dcmd = airnav_concat(dcmd, " --demod-priority %d", demod_priority);
+    }
+
+    if (ini_getBoolean(configuration_file, "client", "dump_mlock", 0)) {
+        dcmd = airnav_concat(dcmd, " --mlock");
+    }
+
+    // Raw sample capture directory (empty to disable). By default samples
+    // are only captured while toggled on with SIGUSR1 to dump1090-rb.
+    char *iq_capture = NULL;
+    ini_getString(&iq_capture, configuration_file, "client", "dump_iq_capture", "");
+    if (iq_capture != NULL && strlen(iq_capture) > 0) {
+        dcmd = airnav_concat(dcmd, " --iq-capture %s", iq_capture);
+        if (ini_getBoolean(configuration_file, "client", "dump_iq_capture_on_demand", 1)) {
+            dcmd = airnav_concat(dcmd, " --iq-capture-on-demand");
+        }
+        if (ini_getBoolean(configuration_file, "client", "dump_iq_capture_raw", 0)) {
+            dcmd = airnav_concat(dcmd, " --iq-capture-raw");
+        }
+    }
+    free(iq_capture);
+
+    // Number of phases to score for each 2.4MHz preamble (0 keeps the default)
+    int score_phases = ini_getInteger(configuration_file, "client", "dump_score_phases", 0);
+    if (score_phases > 0) {
+        dcmd = airnav_concat(dcmd, " --score-phases %d", score_phases);
+    }
+
+    // Cache of DSP wisdom benchmarked on this machine (empty to disable)
+    char *wisdom_cache = NULL;
+    ini_getString(&wisdom_cache, configuration_file, "client", "dump_wisdom_cache", "/var/cache/rbfeeder");
+    if (wisdom_cache != NULL && strlen(wisdom_cache) > 0) {
+        dcmd = airnav_concat(dcmd, " --wisdom-cache %s", wisdom_cache);
+    }
+    free(wisdom_cache);
+
+    // Further RTL-SDR devices to decode alongside the first one, as a
+    // comma-separated list of indexes or serials. These must come last:
+    // the SDR options after each --add-source configure the added device.
+    char *extra_devices = NULL;
+    ini_getString(&extra_devices, configuration_file, "client", "dump_extra_devices", "");
+    if (extra_devices != NULL && strlen(extra_devices) > 0) {
+        char *saveptr = NULL;
+        for (char *dev = strtok_r(extra_devices, ", ", &saveptr); dev != NULL; dev = strtok_r(NULL, ", ", &saveptr)) {
+            dcmd = airnav_concat(dcmd, " --add-source --device %s", dev);
+            if (dump_agc == 1) {
+                dcmd = airnav_concat(dcmd, " --enable-agc");
+            }
+            if (rtl_buffers > 0) {
+                dcmd = airnav_concat(dcmd, " --rtl-buffers %d", rtl_buffers);
+            }
+            if (rtl_buffer_size > 0) {
+                dcmd = airnav_concat(dcmd, " --rtl-buffer-size %d", rtl_buffer_size);
+            }
+        }
+    }
+    free(extra_devices);
+
     airnav_log_level(3, "Final dump1090-rb command: %s\n", dcmd);
 
     airnav_log_level(3, "Starting dump1090-rb with this command: '%s'\n", dcmd);
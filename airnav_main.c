@@ -390,6 +390,9 @@ void airnav_loadConfig(int argc, char **argv) {
 
     dump_agc = ini_getBoolean(configuration_file, "client", "dump_agc", 0);
     Modes.nfix_crc = ini_getBoolean(configuration_file, "client", "dump_fix", 1);
+    Modes.fix_soft = ini_getBoolean(configuration_file, "client", "dump_fix_soft", 0);
+    if (Modes.fix_soft && !Modes.nfix_crc)
+        Modes.nfix_crc = 1;
     Modes.mode_ac = ini_getBoolean(configuration_file, "client", "dump_mode_ac", 1);
 #ifdef RBCSRBLC
     Modes.dc_filter = 0;
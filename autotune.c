@@ -0,0 +1,253 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// autotune.c: DSP wisdom auto-tuning
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/utsname.h>
+#include <sys/wait.h>
+
+// The built-in wisdom files are produced by starch-benchmark on reference
+// machines, which often don't match the CPU we actually run on. Instead,
+// run the same benchmark (as a library, in a child process so that a crash
+// or a hang can't take us down with it) with a short per-implementation
+// run time, and cache the sorted result keyed by a signature of the CPU and
+// the build.
+
+#define AUTOTUNE_WISDOM_FILE "wisdom.local"
+#define AUTOTUNE_SIGNATURE_PREFIX "# signature "
+
+// benchmark settings: 5 iterations (min and max discarded) of ~10ms each
+// per implementation; this takes a few seconds on x86, a little longer on
+// a Pi, and is usually enough to separate the implementations that matter
+#define AUTOTUNE_ITERATIONS "5"
+#define AUTOTUNE_TARGET_MS "10"
+
+// /proc/cpuinfo keys that identify the CPU model and its features;
+// per-core or variable values (clock speed, bogomips, etc) are left out
+static const char *signature_keys[] = {
+    "vendor_id", "cpu family", "model", "model name", "stepping", "flags",                     // x86
+    "CPU implementer", "CPU architecture", "CPU variant", "CPU part", "CPU revision", "Features", // ARM
+    "Hardware",
+    NULL
+};
+
+static uint64_t fnv1a(uint64_t hash, const char *s)
+{
+    while (*s) {
+        hash ^= (unsigned char) *s++;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static void trim(char *s)
+{
+    char *end = s + strlen(s);
+    while (end > s && isspace((unsigned char) end[-1]))
+        *--end = 0;
+}
+
+// Build a signature of the CPU we're running on, and of this build
+static void autotune_signature(char *buf, size_t len)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    bool seen[sizeof(signature_keys) / sizeof(signature_keys[0])] = { false };
+    struct utsname uts;
+
+    hash = fnv1a(hash, MODES_DUMP1090_VARIANT " " MODES_DUMP1090_VERSION);
+#ifdef BDTIME
+    hash = fnv1a(hash, BDTIME);
+#endif
+    if (uname(&uts) == 0)
+        hash = fnv1a(hash, uts.machine);
+
+    FILE *fp = fopen("/proc/cpuinfo", "r");
+    if (fp) {
+        char line[4096];
+        while (fgets(line, sizeof(line), fp)) {
+            char *colon = strchr(line, ':');
+            if (!colon)
+                continue;
+            *colon = 0;
+            trim(line);
+
+            // only use the first instance of each key (i.e. the first core)
+            for (unsigned i = 0; signature_keys[i]; ++i) {
+                if (!seen[i] && !strcmp(line, signature_keys[i])) {
+                    seen[i] = true;
+                    trim(colon + 1);
+                    hash = fnv1a(hash, line);
+                    hash = fnv1a(hash, colon + 1);
+                    break;
+                }
+            }
+        }
+        fclose(fp);
+    }
+
+    snprintf(buf, len, "%016llx", (unsigned long long) hash);
+}
+
+// Return true if 'path' is a cached wisdom file with the given signature
+static bool autotune_cache_valid(const char *path, const char *signature)
+{
+    char line[256];
+    bool valid = false;
+
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        return false;
+
+    if (fgets(line, sizeof(line), fp) && !strncmp(line, AUTOTUNE_SIGNATURE_PREFIX, strlen(AUTOTUNE_SIGNATURE_PREFIX))) {
+        trim(line);
+        valid = !strcmp(line + strlen(AUTOTUNE_SIGNATURE_PREFIX), signature);
+    }
+
+    fclose(fp);
+    return valid;
+}
+
+// Run the benchmark in a child process, writing sorted wisdom to 'path'.
+// Returns true if the child completed within the time limit.
+static bool autotune_run_benchmark(const char *path, unsigned timeout_secs)
+{
+    pid_t pid = fork();
+    if (pid < 0) {
+        fprintf(stderr, "autotune: fork failed: %s\n", strerror(errno));
+        return false;
+    }
+
+    if (pid == 0) {
+        // child: run the benchmark quietly
+        char *argv[] = { "starch-benchmark", "-i", AUTOTUNE_ITERATIONS, "-T", AUTOTUNE_TARGET_MS, "-o", (char *) path, NULL };
+        if (!freopen("/dev/null", "w", stderr))
+            _exit(2);
+        _exit(starch_benchmark_main(7, argv));
+    }
+
+    uint64_t deadline = mstime() + timeout_secs * 1000ULL;
+    for (;;) {
+        int status;
+        pid_t result = waitpid(pid, &status, WNOHANG);
+        if (result == pid) {
+            // a non-zero exit status only means some implementations failed validation
+            // and were left out; the wisdom file is still usable if it was written
+            return WIFEXITED(status) && WEXITSTATUS(status) <= 1;
+        }
+
+        if (result < 0 && errno != EINTR) {
+            fprintf(stderr, "autotune: waitpid failed: %s\n", strerror(errno));
+            return false;
+        }
+
+        if (Modes.exit || mstime() >= deadline) {
+            if (!Modes.exit)
+                fprintf(stderr, "autotune: benchmark did not finish within %u seconds, giving up\n", timeout_secs);
+            kill(pid, SIGKILL);
+            waitpid(pid, &status, 0);
+            return false;
+        }
+
+        struct timespec slp = { 0, 100 * 1000 * 1000 };
+        nanosleep(&slp, NULL);
+    }
+}
+
+// Copy the benchmark output to 'path', prefixed with the signature line,
+// replacing any existing file atomically
+static bool autotune_save(const char *benchmark_path, const char *path, const char *signature)
+{
+    char tmp_path[PATH_MAX];
+    char buf[4096];
+    size_t n;
+    bool ok = true;
+
+    if (snprintf(tmp_path, sizeof(tmp_path), "%s.new", path) >= (int) sizeof(tmp_path))
+        return false;
+
+    FILE *in = fopen(benchmark_path, "r");
+    if (!in)
+        return false;
+
+    FILE *out = fopen(tmp_path, "w");
+    if (!out) {
+        fclose(in);
+        return false;
+    }
+
+    fprintf(out, "%s%s\n", AUTOTUNE_SIGNATURE_PREFIX, signature);
+    while ((n = fread(buf, 1, sizeof(buf), in)) > 0) {
+        if (fwrite(buf, 1, n, out) != n) {
+            ok = false;
+            break;
+        }
+    }
+
+    if (ferror(in))
+        ok = false;
+    fclose(in);
+    if (fclose(out) != 0)
+        ok = false;
+
+    if (ok && rename(tmp_path, path) < 0)
+        ok = false;
+    if (!ok)
+        unlink(tmp_path);
+    return ok;
+}
+
+bool autotune_load_wisdom(const char *dir, unsigned timeout_secs)
+{
+    char signature[32];
+    char path[PATH_MAX];
+    char benchmark_path[PATH_MAX];
+
+    autotune_signature(signature, sizeof(signature));
+    if (snprintf(path, sizeof(path), "%s/%s", dir, AUTOTUNE_WISDOM_FILE) >= (int) sizeof(path) ||
+        snprintf(benchmark_path, sizeof(benchmark_path), "%s.benchmark", path) >= (int) sizeof(benchmark_path)) {
+        fprintf(stderr, "autotune: cache path too long: %s\n", dir);
+        return false;
+    }
+
+    if (!autotune_cache_valid(path, signature)) {
+        fprintf(stderr, "autotune: no cached DSP wisdom for this CPU, benchmarking (this may take up to %u seconds)\n", timeout_secs);
+
+        if (mkdir(dir, 0755) < 0 && errno != EEXIST) {
+            fprintf(stderr, "autotune: cannot create %s: %s\n", dir, strerror(errno));
+            return false;
+        }
+
+        bool ok = autotune_run_benchmark(benchmark_path, timeout_secs) && autotune_save(benchmark_path, path, signature);
+        unlink(benchmark_path);
+
+        if (!ok) {
+            fprintf(stderr, "autotune: failed to generate DSP wisdom in %s, using built-in wisdom\n", dir);
+            return false;
+        }
+
+        fprintf(stderr, "autotune: saved DSP wisdom to %s\n", path);
+    }
+
+    if (starch_read_wisdom(path) < 0) {
+        fprintf(stderr, "autotune: failed to read wisdom file %s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    return true;
+}
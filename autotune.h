@@ -0,0 +1,33 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// autotune.h: DSP wisdom auto-tuning prototypes
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef AUTOTUNE_H
+#define AUTOTUNE_H
+
+#include <stdbool.h>
+
+// Default time limit for the benchmark, in seconds
+#define AUTOTUNE_DEFAULT_TIMEOUT 120
+
+// Load DSP wisdom from the cache in directory 'dir'. If there is no cached
+// wisdom, or it was generated on a different CPU or by a different build,
+// first benchmark the available implementations (for at most 'timeout_secs'
+// seconds) and save the result to the cache. Returns false if no wisdom
+// could be loaded; the built-in wisdom is used in that case.
+bool autotune_load_wisdom(const char *dir, unsigned timeout_secs);
+
+#endif
@@ -19,8 +19,44 @@
 
 #include "dump1090.h"
 
+// Corner frequency of the DC-blocking filter
+#define DC_FILTER_CUTOFF_HZ 1.0
+
+struct converter_state {
+    dc_offset_t dc;         // current DC offset estimate, normalized
+    double dc_rate;         // 2*pi*cutoff/sample_rate, i.e. filter rate per sample
+};
+
+// Update the DC estimate from the mean of the block just converted.
+// This is a single-pole IIR lowpass evaluated once per block rather than
+// once per sample; with a cutoff of ~1Hz the estimate barely moves within
+// a block, and it keeps the per-sample kernels free of loop-carried
+// dependencies so they can be vectorized.
+static void update_dc_estimate(struct converter_state *state, unsigned nsamples)
+{
+    if (!nsamples)
+        return;
+
+    float alpha = (float) (1.0 - exp(-state->dc_rate * nsamples));
+    state->dc.I += alpha * (state->dc.mean_I - state->dc.I);
+    state->dc.Q += alpha * (state->dc.mean_Q - state->dc.Q);
+}
+
+static void compute_mean_power(uint16_t *mag_data,
+                               unsigned nsamples,
+                               double *out_mean_level,
+                               double *out_mean_power)
+{
+    if (out_mean_level && out_mean_power) {
+        if (STARCH_IS_ALIGNED(mag_data))
+            starch_mean_power_u16_aligned(mag_data, nsamples, out_mean_level, out_mean_power);
+        else
+            starch_mean_power_u16(mag_data, nsamples, out_mean_level, out_mean_power);
+    }
+}
+
 static void convert_uc8(void *iq_data,
-                        uint16_t *mag_data,
+                        void *mag_data,
                         unsigned nsamples,
                         struct converter_state *state,
                         double *out_mean_level,
@@ -44,7 +80,7 @@ static void convert_uc8(void *iq_data,
 }
 
 static void convert_sc16(void *iq_data,
-                         uint16_t *mag_data,
+                         void *mag_data,
                          unsigned nsamples,
                          struct converter_state *state,
                          double *out_mean_level,
@@ -54,21 +90,21 @@ static void convert_sc16(void *iq_data,
 
     const sc16_t *in = (const sc16_t *) iq_data;
 
-    if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
-        starch_magnitude_sc16_aligned(in, mag_data, nsamples);
-    else
-        starch_magnitude_sc16(in, mag_data, nsamples);
-
     if (out_mean_level && out_mean_power) {
-        if (STARCH_IS_ALIGNED(mag_data))
-            starch_mean_power_u16_aligned(mag_data, nsamples, out_mean_level, out_mean_power);
+        if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+            starch_magnitude_power_sc16_aligned(in, mag_data, nsamples, out_mean_level, out_mean_power);
         else
-            starch_mean_power_u16(mag_data, nsamples, out_mean_level, out_mean_power);
+            starch_magnitude_power_sc16(in, mag_data, nsamples, out_mean_level, out_mean_power);
+    } else {
+        if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+            starch_magnitude_sc16_aligned(in, mag_data, nsamples);
+        else
+            starch_magnitude_sc16(in, mag_data, nsamples);
     }
 }
 
 static void convert_sc16q11(void *iq_data,
-                            uint16_t *mag_data,
+                            void *mag_data,
                             unsigned nsamples,
                             struct converter_state *state,
                             double *out_mean_level,
@@ -78,16 +114,94 @@ static void convert_sc16q11(void *iq_data,
 
     const sc16_t *in = (const sc16_t *) iq_data;
 
+    if (out_mean_level && out_mean_power) {
+        if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+            starch_magnitude_power_sc16q11_aligned(in, mag_data, nsamples, out_mean_level, out_mean_power);
+        else
+            starch_magnitude_power_sc16q11(in, mag_data, nsamples, out_mean_level, out_mean_power);
+    } else {
+        if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+            starch_magnitude_sc16q11_aligned(in, mag_data, nsamples);
+        else
+            starch_magnitude_sc16q11(in, mag_data, nsamples);
+    }
+}
+
+static void convert_uc8_dc(void *iq_data,
+                           void *mag_data,
+                           unsigned nsamples,
+                           struct converter_state *state,
+                           double *out_mean_level,
+                           double *out_mean_power)
+{
+    const uc8_t *in = (const uc8_t *) iq_data;
+
+    if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+        starch_magnitude_dc_uc8_aligned(in, mag_data, nsamples, &state->dc);
+    else
+        starch_magnitude_dc_uc8(in, mag_data, nsamples, &state->dc);
+
+    update_dc_estimate(state, nsamples);
+    compute_mean_power(mag_data, nsamples, out_mean_level, out_mean_power);
+}
+
+static void convert_sc16_dc(void *iq_data,
+                            void *mag_data,
+                            unsigned nsamples,
+                            struct converter_state *state,
+                            double *out_mean_level,
+                            double *out_mean_power)
+{
+    const sc16_t *in = (const sc16_t *) iq_data;
+
+    if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+        starch_magnitude_dc_sc16_aligned(in, mag_data, nsamples, &state->dc);
+    else
+        starch_magnitude_dc_sc16(in, mag_data, nsamples, &state->dc);
+
+    update_dc_estimate(state, nsamples);
+    compute_mean_power(mag_data, nsamples, out_mean_level, out_mean_power);
+}
+
+static void convert_sc16q11_dc(void *iq_data,
+                               void *mag_data,
+                               unsigned nsamples,
+                               struct converter_state *state,
+                               double *out_mean_level,
+                               double *out_mean_power)
+{
+    const sc16_t *in = (const sc16_t *) iq_data;
+
+    if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
+        starch_magnitude_dc_sc16q11_aligned(in, mag_data, nsamples, &state->dc);
+    else
+        starch_magnitude_dc_sc16q11(in, mag_data, nsamples, &state->dc);
+
+    update_dc_estimate(state, nsamples);
+    compute_mean_power(mag_data, nsamples, out_mean_level, out_mean_power);
+}
+
+static void convert_uc8_u8(void *iq_data,
+                           void *mag_data,
+                           unsigned nsamples,
+                           struct converter_state *state,
+                           double *out_mean_level,
+                           double *out_mean_power)
+{
+    MODES_NOTUSED(state);
+
+    const uc8_t *in = (const uc8_t *) iq_data;
+    double mean_level, mean_power;
+
+    // the 8-bit kernels always compute the level and power
     if (STARCH_IS_ALIGNED(in) && STARCH_IS_ALIGNED(mag_data))
-        starch_magnitude_sc16q11_aligned(in, mag_data, nsamples);
+        starch_magnitude_power_uc8_u8_aligned(in, mag_data, nsamples, &mean_level, &mean_power);
     else
-        starch_magnitude_sc16q11(in, mag_data, nsamples);
+        starch_magnitude_power_uc8_u8(in, mag_data, nsamples, &mean_level, &mean_power);
 
     if (out_mean_level && out_mean_power) {
-        if (STARCH_IS_ALIGNED(mag_data))
-            starch_mean_power_u16_aligned(mag_data, nsamples, out_mean_level, out_mean_power);
-        else
-            starch_mean_power_u16(mag_data, nsamples, out_mean_level, out_mean_power);
+        *out_mean_level = mean_level;
+        *out_mean_power = mean_power;
     }
 }
 
@@ -96,12 +210,34 @@ iq_convert_fn init_converter(input_format_t format,
                              int filter_dc,
                              struct converter_state **out_state)
 {
-    MODES_NOTUSED(sample_rate);
-    MODES_NOTUSED(out_state);
+    *out_state = NULL;
 
     if (filter_dc) {
-        fprintf(stderr, "DC filtering not supported (yet)\n");
-        return NULL;
+        iq_convert_fn fn;
+        switch (format) {
+        case INPUT_UC8:
+            fn = convert_uc8_dc;
+            break;
+        case INPUT_SC16:
+            fn = convert_sc16_dc;
+            break;
+        case INPUT_SC16Q11:
+            fn = convert_sc16q11_dc;
+            break;
+        default:
+            fprintf(stderr, "no suitable DC-filtering converter for format=%d\n", format);
+            return NULL;
+        }
+
+        struct converter_state *state = calloc(1, sizeof(*state));
+        if (!state) {
+            fprintf(stderr, "can't allocate converter state\n");
+            return NULL;
+        }
+
+        state->dc_rate = 2.0 * M_PI * DC_FILTER_CUTOFF_HZ / sample_rate;
+        *out_state = state;
+        return fn;
     }
 
     switch (format) {
@@ -117,7 +253,21 @@ iq_convert_fn init_converter(input_format_t format,
     }
 }
 
+iq_convert_fn init_converter_u8(input_format_t format,
+                                struct converter_state **out_state)
+{
+    *out_state = NULL;
+
+    switch (format) {
+    case INPUT_UC8:
+        return convert_uc8_u8;
+    default:
+        fprintf(stderr, "no suitable 8-bit converter for format=%d\n", format);
+        return NULL;
+    }
+}
+
 void cleanup_converter(struct converter_state *state)
 {
-    MODES_NOTUSED(state);
+    free(state);
 }
@@ -23,8 +23,10 @@
 struct converter_state;
 typedef enum { INPUT_UC8=0, INPUT_SC16, INPUT_SC16Q11 } input_format_t;
 
+// mag_data is uint16_t magnitudes, or uint8_t magnitudes for a
+// converter returned by init_converter_u8
 typedef void (*iq_convert_fn)(void *iq_data,
-                              uint16_t *mag_data,
+                              void *mag_data,
                               unsigned nsamples,
                               struct converter_state *state,
                               double *out_mean_level,
@@ -35,6 +37,11 @@ iq_convert_fn init_converter(input_format_t format,
                              int filter_dc,
                              struct converter_state **out_state);
 
+// Converter producing 8-bit magnitudes (--demod-u8); UC8 input only,
+// no DC filter
+iq_convert_fn init_converter_u8(input_format_t format,
+                                struct converter_state **out_state);
+
 void cleanup_converter(struct converter_state *state);
 
 #endif
@@ -404,6 +404,99 @@ struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen)
     return bsearch(&ei, table, tablesize, sizeof(struct errorinfo), syndrome_compare);
 }
 
+// Short name of a correction type, for stats
+const char *fix_type_name(fix_type type)
+{
+    switch (type) {
+    case FIX_NONE: return "none";
+    case FIX_TABLE: return "table";
+    case FIX_SOFT: return "soft";
+    default: return "unknown";
+    }
+}
+
+// Given an error syndrome, message length, and the slicer confidence of
+// each message bit (larger is more confident), look for a correction of
+// one or two bits that only touches weak bits, those with a confidence
+// below 1/SOFT_FIX_WEAK_FRACTION of the mean. Messages with more than
+// SOFT_FIX_CANDIDATES weak bits are not tried. Returns true and fills *ei
+// if a correction was found.
+//
+// This doesn't need a syndrome table: the syndrome of a set of bit errors
+// is the XOR of the syndromes of the individual bits. As only a handful of
+// bit combinations are considered, the chance of "correcting" a message
+// with many errors into a bogus valid message is much lower than with a
+// full 2-bit table.
+#define SOFT_FIX_CANDIDATES 16
+#define SOFT_FIX_WEAK_FRACTION 3
+
+bool modesChecksumSoftDiagnose(uint32_t syndrome, int bitlen, const uint16_t *confidence, struct errorinfo *ei)
+{
+    int offset = 112 - bitlen;
+    int i, j;
+
+    assert (bitlen == 56 || bitlen == 112);
+
+    uint32_t total = 0;
+    for (i = 0; i < bitlen; ++i)
+        total += confidence[i];
+    uint32_t limit = total / bitlen / SOFT_FIX_WEAK_FRACTION;
+
+    // Collect the weak bits (branch-free, most bits are not weak) as
+    // (confidence << 7 | bit), so that one comparison orders them, then
+    // sort them
+    uint32_t weak[112];
+    int count = 0;
+    for (i = 0; i < bitlen; ++i) {
+        weak[count] = ((uint32_t) confidence[i] << 7) | i;
+        count += (confidence[i] < limit);
+    }
+
+    // Noise has many weak bits; a message with just one or two errors has
+    // few
+    if (count > SOFT_FIX_CANDIDATES)
+        return false;
+
+    for (i = 1; i < count; ++i) {
+        uint32_t key = weak[i];
+        for (j = i; j > 0 && weak[j - 1] > key; --j)
+            weak[j] = weak[j - 1];
+        weak[j] = key;
+    }
+
+    uint32_t bit_syndrome[SOFT_FIX_CANDIDATES];
+    for (i = 0; i < count; ++i)
+        bit_syndrome[i] = single_bit_syndrome[(weak[i] & 127) + offset];
+
+    // single-bit errors
+    for (i = 0; i < count; ++i) {
+        if (bit_syndrome[i] == syndrome) {
+            ei->syndrome = syndrome;
+            ei->errors = 1;
+            ei->bit[0] = weak[i] & 127;
+            ei->bit[1] = -1;
+            return true;
+        }
+    }
+
+    // two-bit errors; two pairs can only share a syndrome if together they
+    // form a 4-bit error with a zero syndrome, so take the first match
+    for (i = 0; i < count; ++i) {
+        uint32_t remaining = syndrome ^ bit_syndrome[i];
+        for (j = i + 1; j < count; ++j) {
+            if (bit_syndrome[j] == remaining) {
+                ei->syndrome = syndrome;
+                ei->errors = 2;
+                ei->bit[0] = weak[i] & 127;
+                ei->bit[1] = weak[j] & 127;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 // Given a message and an error-correction descriptor,
 // apply the error correction to the given message.
 void modesChecksumFix(uint8_t *msg, struct errorinfo *info)
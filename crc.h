@@ -31,9 +31,27 @@ struct errorinfo {
     int8_t   bit[MODES_MAX_BITERRORS]; // bit positions to fix (-1 = no bit)
 };
 
+// How a message was corrected
+typedef enum {
+    FIX_NONE = 0,                      // not corrected
+    FIX_TABLE,                         // syndrome table lookup
+    FIX_SOFT,                          // flipping the least confident bits
+    FIX_TYPES
+} fix_type;
+
+// Error correction work and yield, by fix_type
+struct fix_stats {
+    uint32_t attempts[FIX_TYPES];      // syndromes diagnosed
+    uint32_t found[FIX_TYPES];         // corrections found
+    uint32_t accepted[FIX_TYPES];      // messages accepted with this kind of correction
+    uint64_t ns[FIX_TYPES];            // time spent diagnosing, in nanoseconds
+};
+
 void modesChecksumInit(int fixBits);
 uint32_t modesChecksum(const uint8_t *msg, int bitlen);
 struct errorinfo *modesChecksumDiagnose(uint32_t syndrome, int bitlen);
+const char *fix_type_name(fix_type type);
+bool modesChecksumSoftDiagnose(uint32_t syndrome, int bitlen, const uint16_t *confidence, struct errorinfo *ei);
 void modesChecksumFix(uint8_t *msg, struct errorinfo *info);
 
 #endif
@@ -0,0 +1,300 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// demod_2000.c: 2.0MHz Mode S demodulator.
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#include <assert.h>
+
+// 2.0MHz sampling rate version
+//
+// When sampling at 2.0MHz we have exactly 1 sample per symbol: each symbol
+// is 500ns wide, and so is each sample. This costs less USB bandwidth and
+// CPU than 2.4MHz, at the price of less information about the symbol phase.
+//
+// We consider two phase offsets, in units of 1/2 sample (250ns, 3 ticks of
+// the 12MHz clock):
+//
+//   phase 0: symbols line up with samples; a 1 bit is m[k] > m[k+1]
+//   phase 1: symbols straddle two samples; each sample holds half of one
+//            symbol and half of the next, so m[k+1] carries no information
+//            and we compare m[k] with m[k+2], allowing for the spill-over
+//            from the neighbouring symbols using the previous bit decision
+//
+// Both phases are sliced and scored, and the best one wins, as the 2.4MHz
+// demodulator does for its five phases.
+
+// Look for a preamble starting at m[0] with the given phase. Returns the
+// estimated amplitude of a pulse, or 0 if this doesn't look like a preamble.
+//
+// sample#:  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6
+// phase 0:  P . P . . . . P . P . . . . . . X0
+// phase 1:  p p p p . . . p p p p . . . . . X0
+//
+// (P = whole pulse, p = half of a pulse, X0 = first data symbol)
+static unsigned check_preamble(const uint16_t *m, int phase)
+{
+    unsigned pulses, threshold;
+
+    if (phase == 0) {
+        if (!(m[0] > m[1] && m[1] < m[2] && m[2] > m[3] &&
+              m[6] < m[7] && m[7] > m[8] && m[8] < m[9] && m[9] > m[10]))
+            return 0;
+
+        pulses = m[0] + m[2] + m[7] + m[9];
+        threshold = pulses / 6;  // 2/3 of the average pulse sample
+    } else {
+        if (!(m[3] > m[4] && m[6] < m[7] && m[10] > m[11]))
+            return 0;
+
+        pulses = m[0] + m[1] + m[2] + m[3] + m[7] + m[8] + m[9] + m[10];
+        threshold = pulses / 12; // 2/3 of the average half-pulse sample
+    }
+
+    // the gaps between the pulses, and before the data, should be quiet
+    if (m[4] >= threshold || m[5] >= threshold ||
+        m[11] >= threshold || m[12] >= threshold || m[13] >= threshold || m[14] >= threshold)
+        return 0;
+
+    return pulses / 4;
+}
+
+// Number of samples prefiltered at a time
+#define PREFILTER_CHUNK 4096
+
+// Set out[i] to 1 if the preamble candidate at m[i] passes a quick test for
+// things that hold for both phases, else 0. This rejects most samples
+// cheaply, and is written so that the compiler can vectorize it.
+static void prefilter(const uint16_t *m, unsigned len, uint8_t *out)
+{
+    for (unsigned i = 0; i < len; ++i)
+        out[i] = (m[i+7] > m[i+6]) & (m[i+2] > m[i+4]) & (m[i+0] > m[i+5]) & (m[i+9] > m[i+11]) & (m[i+7] > m[i+12]);
+}
+
+// Slice 'bytes' bytes of data following the preamble at m[0]
+static void slice_message(const uint16_t *m, int phase, unsigned amplitude, unsigned char *msg, unsigned bytes)
+{
+    // For phase 1, a sample contains half of the second symbol of the
+    // previous bit; if that symbol was on (previous bit was 0), require
+    // correspondingly more evidence for a 1 bit, and vice versa.
+    int feedback = (phase ? (int) amplitude / 4 : 0);
+    int threshold = -feedback; // the symbol before the first data bit is quiet
+    const uint16_t *p = &m[16];
+
+    for (unsigned i = 0; i < bytes; ++i) {
+        unsigned theByte = 0;
+        for (unsigned bit = 0; bit < 8; ++bit, p += 2) {
+            int one = ((int) p[0] - (int) p[1 + phase]) > threshold;
+            theByte = (theByte << 1) | one;
+            threshold = one ? -feedback : feedback;
+        }
+        msg[i] = theByte;
+    }
+}
+
+// Where the next buffer should start scanning from; each sample source
+// has its own position, loaded and saved around each buffer
+static unsigned last_message_end = 0;
+static unsigned source_message_end[MAGBUF_MAX_SOURCES];
+
+//
+// Given 'mlen' magnitude samples in 'm', sampled at 2.0MHz,
+// try to demodulate some Mode S messages.
+//
+void demodulate2000(struct mag_buf *mag)
+{
+    static struct modesMessage zeroMessage;
+    struct modesMessage mm;
+    unsigned char msg[2][MODES_LONG_MSG_BYTES];
+    uint16_t *m = mag->data;
+    uint64_t sum_scaled_signal_power = 0;
+    uint32_t j;
+    uint8_t pass[PREFILTER_CHUNK];
+    uint32_t chunk_start = 0, chunk_end = 0;
+
+    last_message_end = source_message_end[mag->source];
+    if (mag->flags & MAGBUF_DISCONTINUOUS) {
+        // gap, start from the very beginning
+        last_message_end = 0;
+    }
+
+    // maximum lookahead we use
+    assert(mag->overlap >= 16 + MODES_LONG_MSG_BITS * 2 + 2);
+
+    uint32_t mlen = mag->validLength - mag->overlap;
+
+    // sanity check
+    if (last_message_end > mlen)
+        last_message_end = mlen;
+
+    for (j = last_message_end; j < mlen; j++) {
+        unsigned char *bestmsg = NULL;
+        int bestscore = SR_NOT_SET;
+        int bestphase = -1;
+        bool found = false;
+
+        // find the next sample that passes the prefilter
+        if (j >= chunk_end) {
+            chunk_start = j;
+            chunk_end = (mlen - j > PREFILTER_CHUNK ? j + PREFILTER_CHUNK : mlen);
+            prefilter(&m[j], chunk_end - j, pass);
+        }
+
+        uint8_t *next = memchr(&pass[j - chunk_start], 1, chunk_end - j);
+        if (!next) {
+            j = chunk_end - 1;
+            continue;
+        }
+        j = chunk_start + (next - pass);
+
+        for (int phase = 0; phase <= 1; ++phase) {
+            unsigned amplitude = check_preamble(&m[j], phase);
+            if (!amplitude)
+                continue;
+
+            found = true;
+
+            // Slice the first byte and inspect the DF field early: only
+            // slice the whole message if the DF appears valid
+            slice_message(&m[j], phase, amplitude, msg[phase], 1);
+            if (!demodulateValidDF(msg[phase][0] >> 3)) {
+                Modes.stats_current.demod_rejected_bad++;
+                continue;
+            }
+
+            slice_message(&m[j], phase, amplitude, msg[phase], MODES_LONG_MSG_BYTES);
+
+            // Score the mode S message and see if it's any good.
+            int score = scoreModesMessageSoft(msg[phase], NULL, &Modes.stats_current.fix);
+            if (score > bestscore) {
+                // new high score!
+                bestmsg = msg[phase];
+                bestscore = score;
+                bestphase = phase;
+            }
+        }
+
+        if (!found)
+            continue;
+
+        Modes.stats_current.demod_preambles++;
+
+        // Do we have a candidate?
+        if (bestscore < SR_ACCEPT_THRESHOLD) {
+            if (bestscore >= SR_UNKNOWN_THRESHOLD)
+                Modes.stats_current.demod_rejected_unknown_icao++;
+            else
+                Modes.stats_current.demod_rejected_bad++;
+            continue; // nope.
+        }
+
+        int msglen = modesMessageLenByType(bestmsg[0] >> 3);
+
+        // Set initial mm structure details
+        mm = zeroMessage;
+
+        // For consistency with how the Beast / Radarcape does it,
+        // we report the timestamp at the end of bit 56 (even if
+        // the frame is a 112-bit frame)
+        mm.timestampMsg = mag->sampleTimestamp + j*6 + (8 + 56) * 12 + bestphase * 3;
+
+        // compute message receive time as block-start-time + difference in the 12MHz clock
+        mm.sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, mm.timestampMsg);
+        mm.sdr_source = mag->source;
+
+        mm.score = bestscore;
+
+        // Decode the received message
+        struct timespec decode_start;
+        start_phase_timing(&decode_start);
+        int decoded = decodeModesMessage(&mm, bestmsg);
+        end_phase_timing(&decode_start, &Modes.stats_current.decode_cpu);
+        if (decoded < 0) {
+            Modes.stats_current.demod_rejected_bad++;
+            continue;
+        } else {
+            Modes.stats_current.demod_accepted[mm.correctedbits]++;
+            Modes.stats_current.fix.accepted[mm.fixtype]++;
+        }
+
+        // measure signal power
+        {
+            double signal_power;
+            uint64_t scaled_signal_power = 0;
+            int signal_len = msglen*2;
+            int k;
+
+            for (k = 0; k < signal_len; ++k) {
+                uint32_t mag = m[j+16+k];
+                scaled_signal_power += mag * mag;
+            }
+
+            signal_power = scaled_signal_power / 65535.0 / 65535.0;
+            mm.signalLevel = signal_power / signal_len;
+            Modes.stats_current.signal_power_sum += signal_power;
+            Modes.stats_current.signal_power_count += signal_len;
+            sum_scaled_signal_power += scaled_signal_power;
+
+            if (mm.signalLevel > Modes.stats_current.peak_signal_power)
+                Modes.stats_current.peak_signal_power = mm.signalLevel;
+            if (mm.signalLevel > 0.50119)
+                Modes.stats_current.strong_signal_count++; // signal power above -3dBFS
+        }
+
+        // Feed "empty" sample to adaptive gain logic (which only controls the first source)
+        if (j > last_message_end && mag->source == 0)
+            adaptive_update(&m[last_message_end], j - last_message_end, NULL);
+
+        // Feed message samples to adaptive gain logic, update end pointer
+        last_message_end = j + (msglen + 8) * 2;
+        if (mag->source == 0)
+            adaptive_update(&m[j], last_message_end - j, &mm);
+
+        // Queue the message for the next layer
+        queueModesMessage(&mm);
+
+        // Skip over the message:
+        // (we actually skip to 8 bits before the end of the message,
+        //  because we can often decode two messages that *almost* collide,
+        //  where the preamble of the second message clobbered the last
+        //  few bits of the first message, but the message bits didn't
+        //  overlap)
+        j = last_message_end - 8*2;
+    }
+
+    /* update noise power */
+    {
+        double sum_signal_power = sum_scaled_signal_power / 65535.0 / 65535.0;
+        Modes.stats_current.noise_power_sum += (mag->mean_power * mlen - sum_signal_power);
+        Modes.stats_current.noise_power_count += mlen;
+    }
+
+    // feed trailing empty samples to adaptive gain logic
+    if (last_message_end < mlen) {
+        // trailing data from end of last message to start of overlap;
+        // on the next pass, start from the start of the overlap
+        if (mag->source == 0)
+            adaptive_update(&m[last_message_end], mlen - last_message_end, NULL);
+        last_message_end = 0;
+    } else {
+        // last decoded message runs into the overlap region;
+        // on the next pass, start at the right place in the overlap;
+        // no trailing data to pass this time
+        last_message_end -= mlen;
+    }
+
+    source_message_end[mag->source] = last_message_end;
+}
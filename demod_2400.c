@@ -21,6 +21,8 @@
 
 #include <assert.h>
 
+#include "dsp/helpers/slice_correlate.h"
+
 #ifdef MODEAC_DEBUG
 #include <gd.h>
 #endif
@@ -33,33 +35,16 @@
 // We maintain a phase offset that is expressed in units of 1/5 of a sample i.e. 1/6 of a symbol, 83.333ns
 // Each symbol we process advances the phase offset by 6 i.e. 6/5 of a sample, 500ns
 //
-// The correlation functions below correlate a 1-0 pair of symbols (i.e. manchester encoded 1 bit)
-// starting at the given sample, and assuming that the symbol starts at a fixed 0-5 phase offset within
-// m[0]. They return a correlation value, generally interpreted as >0 = 1 bit, <0 = 0 bit
-
-// TODO check if there are better (or more balanced) correlation functions to use here
-
-// nb: the correlation functions sum to zero, so we do not need to adjust for the DC offset in the input signal
-// (adding any constant value to all of m[0..3] does not change the result)
-
-static inline int slice_phase0(uint16_t *m) {
-    return 5 * m[0] - 3 * m[1] - 2 * m[2];
-}
-static inline int slice_phase1(uint16_t *m) {
-    return 4 * m[0] - m[1] - 3 * m[2];
-}
-static inline int slice_phase2(uint16_t *m) {
-    return 3 * m[0] + m[1] - 4 * m[2];
-}
-static inline int slice_phase3(uint16_t *m) {
-    return 2 * m[0] + 3 * m[1] - 5 * m[2];
-}
-static inline int slice_phase4(uint16_t *m) {
-    return m[0] + 5 * m[1] - 5 * m[2] - m[3];
-}
+// The data bits are sliced by the starch slice_phases_u16 kernel, for all
+// five candidate phase offsets at once. Its correlation functions correlate a
+// 1-0 pair of symbols (i.e. manchester encoded 1 bit) starting at a given
+// sample, and assuming that the symbol starts at a fixed 0-5 phase offset
+// within that sample; a correlation >0 is a 1 bit, <0 is a 0 bit.
 
 static uint32_t valid_df_short_bitset;        // set of acceptable DF values for short messages
 static uint32_t valid_df_long_bitset;         // set of acceptable DF values for long messages
+static uint32_t soft_fix_df_bitset;           // set of DF values that might get a soft-decision correction
+static bool bitsets_no_fix;                   // was error correction shed (OVERLOAD_NO_FIX) when the bitsets were built?
 
 static uint32_t generate_damage_set(uint8_t df, unsigned damage_bits)
 {
@@ -77,6 +62,8 @@ static uint32_t generate_damage_set(uint8_t df, unsigned damage_bits)
 
 static void init_bitsets()
 {
+    bitsets_no_fix = (Modes.overload_level >= OVERLOAD_NO_FIX);
+
     // DFs that we directly understand without correction
     valid_df_short_bitset = (1 << 0) | (1 << 4) | (1 << 5) | (1 << 11);
     valid_df_long_bitset = (1 << 16) | (1 << 17) | (1 << 18) | (1 << 20) | (1 << 21);
@@ -85,343 +72,459 @@ static void init_bitsets()
         valid_df_long_bitset |= (1 << 24) | (1 << 25) | (1 << 26) | (1 << 27) | (1 << 28) | (1 << 29) | (1 << 30) | (1 << 31);
 
     // if we can also repair DF damage, include those corrections
-    if (Modes.fix_df && Modes.nfix_crc) {
+    if (Modes.fix_df && Modes.nfix_crc && !bitsets_no_fix) {
         valid_df_short_bitset |= generate_damage_set(11, 1);
         valid_df_long_bitset |= generate_damage_set(17, Modes.nfix_crc);
         valid_df_long_bitset |= generate_damage_set(18, Modes.nfix_crc);
     }
+
+    // soft-decision correction is only tried on messages that were sliced
+    // as DF17/18: searching noise for 2-bit errors is what makes --fix-2bit
+    // expensive, and damaged DFs are still corrected by the table
+    soft_fix_df_bitset = 0;
+    if (Modes.fix_soft && !bitsets_no_fix)
+        soft_fix_df_bitset = (1 << 17) | (1 << 18);
 }
 
-//
-// Given 'mlen' magnitude samples in 'm', sampled at 2.4MHz,
-// try to demodulate some Mode S messages.
-//
-void demodulate2400(struct mag_buf *mag)
+// Build the bitsets on first use, and rebuild them if the overload
+// controller has turned error correction off or on again since
+static inline void ensure_bitsets()
 {
-    static struct modesMessage zeroMessage;
-    struct modesMessage mm;
-    unsigned char msg1[MODES_LONG_MSG_BYTES], msg2[MODES_LONG_MSG_BYTES], *msg;
-    uint32_t j;
+    if (!valid_df_short_bitset || bitsets_no_fix != (Modes.overload_level >= OVERLOAD_NO_FIX))
+        init_bitsets();
+}
 
-    static unsigned last_message_end = 0;
+// Confidence of one bit: the magnitude of the correlation that sliced it,
+// using the same correlation functions as slice_phases_u16
+static inline uint16_t bit_confidence(const uint16_t *p, unsigned phase)
+{
+    int correlation = slice_correlate(p, phase);
 
-    // initialize bitsets on first call
-    if (!valid_df_short_bitset)
-        init_bitsets();
+    if (correlation < 0)
+        correlation = -correlation;
+    return (correlation > 65535 ? 65535 : correlation);
+}
 
-    if (mag->flags & MAGBUF_DISCONTINUOUS) {
-        // gap, start from the very beginning
-        last_message_end = 0;
+// Per-bit confidence for the first "bits" bits of the message sliced from
+// m[0] at the given try_phase (4..8). Bit N starts (try_phase + 12 * N) / 5
+// samples in, at sub-sample phase (try_phase + 12 * N) % 5, so bits N, N+5,
+// N+10, .. share a phase and are 12 samples apart; doing them together
+// keeps the phase constant in the inner loop.
+static void slice_confidence(const uint16_t *m, int try_phase, unsigned bits, uint16_t *confidence)
+{
+    for (unsigned first = 0; first < 5; ++first) {
+        unsigned offset = try_phase + 12 * first;
+        const uint16_t *p = &m[offset / 5];
+
+        switch (offset % 5) {
+#define SLICE_CONFIDENCE_LOOP(phase)                                    \
+        case phase:                                                     \
+            for (unsigned bit = first; bit < bits; bit += 5, p += 12)   \
+                confidence[bit] = bit_confidence(p, phase);             \
+            break;
+        SLICE_CONFIDENCE_LOOP(0)
+        SLICE_CONFIDENCE_LOOP(1)
+        SLICE_CONFIDENCE_LOOP(2)
+        SLICE_CONFIDENCE_LOOP(3)
+        SLICE_CONFIDENCE_LOOP(4)
+#undef SLICE_CONFIDENCE_LOOP
+        }
     }
+}
 
-    unsigned char *bestmsg;
-    int bestscore, bestphase;
+// Number of leading bits that phase_weak_bits() looks at. Looking at more
+// bits predicts slightly better which phase will pass the CRC, but costs
+// about as much as the scoring it saves.
+#define PHASE_QUALITY_BITS 16
+
+// With --score-phases, phases beyond the first N are still scored if the
+// first N fail and they have at most this many more weak bits than the best
+#define PHASE_FALLBACK_WEAK_BITS 2
+
+// Cheap quality metric for the message sliced from m[0] at the given
+// try_phase (4..8): the number of weak bits (slicer margin below 1/4 of the
+// mean) among its first PHASE_QUALITY_BITS bits. Weak bits are the ones most
+// likely to be sliced wrongly, so the phase with the fewest weak bits is the
+// one most likely to pass the CRC. (The sum of the margins is a much worse
+// predictor: a phase straddling the symbol edges can still have large
+// margins on most bits.)
+static unsigned phase_weak_bits(const uint16_t *m, int try_phase)
+{
+    uint16_t confidence[PHASE_QUALITY_BITS];
+    unsigned sum = 0, weak = 0;
 
-    // maximum lookahead we use
-    assert(mag->overlap >= 19 + 1 + 269);
+    slice_confidence(m, try_phase, PHASE_QUALITY_BITS, confidence);
 
-    uint16_t *m = mag->data;
-    uint32_t mlen = mag->validLength - mag->overlap;
+    for (unsigned bit = 0; bit < PHASE_QUALITY_BITS; ++bit)
+        sum += confidence[bit];
+    for (unsigned bit = 0; bit < PHASE_QUALITY_BITS; ++bit)
+        weak += (confidence[bit] * PHASE_QUALITY_BITS * 4 < sum);
+    return weak;
+}
 
-    uint64_t sum_scaled_signal_power = 0;
+// Does this score mean the message was only valid after error correction?
+static bool score_needs_correction(int score)
+{
+    switch (score) {
+    case SR_DF11_IID_1ERROR_UNKNOWN:
+    case SR_DF11_ACQ_1ERROR_UNKNOWN:
+    case SR_DF18_2ERROR_UNKNOWN:
+    case SR_DF17_2ERROR_UNKNOWN:
+    case SR_DF18_2ERROR_KNOWN:
+    case SR_DF17_2ERROR_KNOWN:
+    case SR_DF18_1ERROR_UNKNOWN:
+    case SR_DF17_1ERROR_UNKNOWN:
+    case SR_DF11_IID_1ERROR_KNOWN:
+    case SR_DF11_ACQ_1ERROR_KNOWN:
+    case SR_DF18_1ERROR_KNOWN:
+    case SR_DF17_1ERROR_KNOWN:
+        return true;
+    default:
+        return false;
+    }
+}
 
-    msg = msg1;
+// Is 'df' a DF value worth slicing the rest of the message for?
+// (also used by the 2.0MHz demodulator)
+bool demodulateValidDF(unsigned df)
+{
+    ensure_bitsets();
 
-    // sanity check
-    if (last_message_end > mlen)
-        last_message_end = mlen;
+    return ((valid_df_long_bitset | valid_df_short_bitset) & (1 << df)) != 0;
+}
 
-    for (j = last_message_end; j < mlen; j++) {
-        uint16_t *preamble = &m[j];
-        int high;
-        uint32_t base_signal, base_noise;
-        int try_phase;
-        int msglen;
+// Number of samples handed to the preamble scanner at a time
+#define PREAMBLE_SCAN_CHUNK 4096
+
+// Iterator over the candidate preambles in a magnitude buffer, which are
+// found by the (vectorized) preamble_scan_u16 kernel a chunk at a time,
+// or preamble_scan_u8 with --demod-u8.
+struct preamble_scanner {
+    uint16_t *m;
+    uint8_t *m8;                                // 8-bit samples (--demod-u8), else NULL
+    uint32_t mlen;
+    bool correlate;                             // use the matched-filter detector
+    uint32_t chunk_start;                       // offset in m of the current chunk
+    uint32_t chunk_end;                         // offset in m of the end of the current chunk
+    unsigned count;                             // number of candidates in the current chunk
+    unsigned next;                              // index of the next candidate to return
+    uint32_t offsets[PREAMBLE_SCAN_CHUNK];      // candidate offsets, relative to chunk_start
+};
+
+// Return the offset of the first candidate preamble at or after 'from',
+// or s->mlen if there are no more candidates.
+static uint32_t next_preamble(struct preamble_scanner *s, uint32_t from)
+{
+    for (;;) {
+        while (s->next < s->count) {
+            uint32_t candidate = s->chunk_start + s->offsets[s->next++];
+            if (candidate >= from)
+                return candidate;
+        }
 
-        // Look for a message starting at around sample 0 with phase offset 3..7
+        uint32_t start = (from > s->chunk_end ? from : s->chunk_end);
+        if (start >= s->mlen)
+            return s->mlen;
 
-        // Ideal sample values for preambles with different phase
-        // Xn is the first data symbol with phase offset N
-        //
-        // sample#: 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0
-        // phase 3: 2/4\0/5\1 0 0 0 0/5\1/3 3\0 0 0 0 0 0 X4
-        // phase 4: 1/5\0/4\2 0 0 0 0/4\2 2/4\0 0 0 0 0 0 0 X0
-        // phase 5: 0/5\1/3 3\0 0 0 0/3 3\1/5\0 0 0 0 0 0 0 X1
-        // phase 6: 0/4\2 2/4\0 0 0 0 2/4\0/5\1 0 0 0 0 0 0 X2
-        // phase 7: 0/3 3\1/5\0 0 0 0 1/5\0/4\2 0 0 0 0 0 0 X3
-        //
+        unsigned len = s->mlen - start;
+        if (len > PREAMBLE_SCAN_CHUNK)
+            len = PREAMBLE_SCAN_CHUNK;
 
-        // quick check: we must have a rising edge 0->1 and a falling edge 12->13
-        if (! (preamble[0] < preamble[1] && preamble[12] > preamble[13]) )
-           continue;
-
-        if (preamble[1] > preamble[2] &&                                       // 1
-            preamble[2] < preamble[3] && preamble[3] > preamble[4] &&          // 3
-            preamble[8] < preamble[9] && preamble[9] > preamble[10] &&         // 9
-            preamble[10] < preamble[11]) {                                     // 11-12
-            // peaks at 1,3,9,11-12: phase 3
-            high = (preamble[1] + preamble[3] + preamble[9] + preamble[11] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[3] + preamble[9];
-            base_noise = preamble[5] + preamble[6] + preamble[7];
-        } else if (preamble[1] > preamble[2] &&                                // 1
-                   preamble[2] < preamble[3] && preamble[3] > preamble[4] &&   // 3
-                   preamble[8] < preamble[9] && preamble[9] > preamble[10] &&  // 9
-                   preamble[11] < preamble[12]) {                              // 12
-            // peaks at 1,3,9,12: phase 4
-            high = (preamble[1] + preamble[3] + preamble[9] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[3] + preamble[9] + preamble[12];
-            base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
-        } else if (preamble[1] > preamble[2] &&                                // 1
-                   preamble[2] < preamble[3] && preamble[4] > preamble[5] &&   // 3-4
-                   preamble[8] < preamble[9] && preamble[10] > preamble[11] && // 9-10
-                   preamble[11] < preamble[12]) {                              // 12
-            // peaks at 1,3-4,9-10,12: phase 5
-            high = (preamble[1] + preamble[3] + preamble[4] + preamble[9] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[12];
-            base_noise = preamble[6] + preamble[7];
-        } else if (preamble[1] > preamble[2] &&                                 // 1
-                   preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
-                   preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
-                   preamble[11] < preamble[12]) {                               // 12
-            // peaks at 1,4,10,12: phase 6
-            high = (preamble[1] + preamble[4] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[1] + preamble[4] + preamble[10] + preamble[12];
-            base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
-        } else if (preamble[2] > preamble[3] &&                                 // 1-2
-                   preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
-                   preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
-                   preamble[11] < preamble[12]) {                               // 12
-            // peaks at 1-2,4,10,12: phase 7
-            high = (preamble[1] + preamble[2] + preamble[4] + preamble[10] + preamble[12]) / 4;
-            base_signal = preamble[4] + preamble[10] + preamble[12];
-            base_noise = preamble[6] + preamble[7] + preamble[8];
+        if (s->m8) {
+            if (STARCH_IS_ALIGNED(&s->m8[start]))
+                starch_preamble_scan_u8_aligned(&s->m8[start], len, s->offsets, &s->count);
+            else
+                starch_preamble_scan_u8(&s->m8[start], len, s->offsets, &s->count);
+        } else if (s->correlate) {
+            if (STARCH_IS_ALIGNED(&s->m[start]))
+                starch_preamble_correlate_u16_aligned(&s->m[start], len, s->offsets, &s->count);
+            else
+                starch_preamble_correlate_u16(&s->m[start], len, s->offsets, &s->count);
         } else {
-            // no suitable peaks
-            continue;
+            if (STARCH_IS_ALIGNED(&s->m[start]))
+                starch_preamble_scan_u16_aligned(&s->m[start], len, s->offsets, &s->count);
+            else
+                starch_preamble_scan_u16(&s->m[start], len, s->offsets, &s->count);
         }
 
-        // Check for enough signal
-        if (base_signal * 2 < 3 * base_noise) // about 3.5dB SNR
-            continue;
+        s->chunk_start = start;
+        s->chunk_end = start + len;
+        s->next = 0;
+    }
+}
 
-        // Check that the "quiet" bits 6,7,15,16,17 are actually quiet
-        if (preamble[5] >= high ||
-            preamble[6] >= high ||
-            preamble[7] >= high ||
-            preamble[8] >= high ||
-            preamble[14] >= high ||
-            preamble[15] >= high ||
-            preamble[16] >= high ||
-            preamble[17] >= high ||
-            preamble[18] >= high) {
-            continue;
-        }
+// Number of samples from the start of a candidate preamble that scoring and
+// decoding may look at: the preamble, then what slice_phases_u16 reads for
+// a long message (SLICE_PHASES_SAMPLES(MODES_LONG_MSG_BYTES), which is
+// padded for its vectorized loops)
+#define CANDIDATE_WINDOW (19 + 291)
+
+// Return the 16-bit samples of the candidate preamble at offset j. With
+// --demod-u8, the 8-bit samples are widened into 'window' (which must have
+// room for CANDIDATE_WINDOW samples) first, so that everything after the
+// preamble scan is the same for both sample sizes.
+static uint16_t *candidate_samples(struct mag_buf *mag, uint32_t j, uint16_t *window)
+{
+    if (!Modes.demod_u8)
+        return &mag->data[j];
 
-        // try all phases
-        Modes.stats_current.demod_preambles++;
-        bestmsg = NULL; bestscore = SR_NOT_SET; bestphase = -1;
-        for (try_phase = 4; try_phase <= 8; ++try_phase) {
-            uint16_t *pPtr;
-            int phase, score;
-
-            // Decode all the next 112 bits, regardless of the actual message
-            // size. We'll check the actual message type later
-
-            pPtr = &m[j+19] + (try_phase/5);
-            phase = try_phase % 5;
-
-            unsigned bytelen = 1;
-            for (unsigned i = 0; i < bytelen; ++i) {
-                uint8_t theByte = 0;
-
-                switch (phase) {
-                case 0:
-                    theByte =
-                        (slice_phase0(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase2(pPtr+2) > 0 ? 0x40 : 0) |
-                        (slice_phase4(pPtr+4) > 0 ? 0x20 : 0) |
-                        (slice_phase1(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase3(pPtr+9) > 0 ? 0x08 : 0) |
-                        (slice_phase0(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase2(pPtr+14) > 0 ? 0x02 : 0) |
-                        (slice_phase4(pPtr+16) > 0 ? 0x01 : 0);
-
-
-                    phase = 1;
-                    pPtr += 19;
-                    break;
+    const uint8_t *p = &mag->data8[j];
+    for (unsigned k = 0; k < CANDIDATE_WINDOW; ++k)
+        window[k] = p[k] << 8;
+    return window;
+}
 
-                case 1:
-                    theByte =
-                        (slice_phase1(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase3(pPtr+2) > 0 ? 0x40 : 0) |
-                        (slice_phase0(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase2(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase4(pPtr+9) > 0 ? 0x08 : 0) |
-                        (slice_phase1(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase3(pPtr+14) > 0 ? 0x02 : 0) |
-                        (slice_phase0(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 2;
-                    pPtr += 19;
-                    break;
+// Feed 'length' samples starting at offset 'from', which are not part of a
+// decoded message, to the adaptive gain logic
+static void adaptive_update_empty(struct mag_buf *mag, uint32_t from, unsigned length)
+{
+    if (Modes.demod_u8)
+        adaptive_update_u8(&mag->data8[from], length, NULL);
+    else
+        adaptive_update(&mag->data[from], length, NULL);
+}
 
-                case 2:
-                    theByte =
-                        (slice_phase2(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase4(pPtr+2) > 0 ? 0x40 : 0) |
-                        (slice_phase1(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase3(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase0(pPtr+10) > 0 ? 0x08 : 0) |
-                        (slice_phase2(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase4(pPtr+14) > 0 ? 0x02 : 0) |
-                        (slice_phase1(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 3;
-                    pPtr += 19;
-                    break;
+//
+// Slice and score all phases of the candidate preamble that starts at m[0].
+// The sliced messages are written to msg (5 phases of MODES_LONG_MSG_BYTES);
+// on return, *bestmsg and *bestphase describe the highest-scoring phase, and
+// *rejected is the number of phases rejected early by the DF filter and
+// *scored the number of phases that were scored. With --score-phases N,
+// only the N phases with the fewest phase_weak_bits() are scored, unless
+// none of them gives a message that can be accepted without error
+// correction; then the remaining phases that are nearly as good are tried
+// too.
+// Error correction work is counted in *fix. Returns the best score.
+//
+static int score_candidate(uint16_t *m, unsigned char *msg, unsigned char **bestmsg, int *bestphase, unsigned *rejected, unsigned *scored, struct fix_stats *fix)
+{
+    int try_phase;
+    int bestscore = SR_NOT_SET;
+    int order[5];
+    unsigned count = 0;
+
+    // Look for a message starting at around sample 0 with phase offset 3..7
+
+    // Ideal sample values for preambles with different phase
+    // Xn is the first data symbol with phase offset N
+    //
+    // sample#: 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0
+    // phase 3: 2/4\0/5\1 0 0 0 0/5\1/3 3\0 0 0 0 0 0 X4
+    // phase 4: 1/5\0/4\2 0 0 0 0/4\2 2/4\0 0 0 0 0 0 0 X0
+    // phase 5: 0/5\1/3 3\0 0 0 0/3 3\1/5\0 0 0 0 0 0 0 X1
+    // phase 6: 0/4\2 2/4\0 0 0 0 2/4\0/5\1 0 0 0 0 0 0 X2
+    // phase 7: 0/3 3\1/5\0 0 0 0 1/5\0/4\2 0 0 0 0 0 0 X3
+    //
+
+    // The preamble tests (edges, peak pattern, signal level and quiet
+    // bits) were already done by the preamble scanner; m[0] is a candidate
+    // that passed them all.
+
+    *bestmsg = NULL;
+    *bestphase = -1;
+    *rejected = 0;
+    *scored = 0;
+
+    // Slice the first byte for all phases, and inspect the DF field
+    // early: only continue processing phases where the DF appears valid
+    unsigned phase_mask = 0;
+    starch_slice_phases_u16(&m[19], 1, 0x1F, msg);
+    for (try_phase = 4; try_phase <= 8; ++try_phase) {
+        unsigned df = msg[try_phase - 4] >> 3;
+        if ((valid_df_long_bitset | valid_df_short_bitset) & (1 << df))
+            phase_mask |= 1 << (try_phase - 4);
+        else
+            ++*rejected; // rejected early by the DF filter
+    }
 
-                case 3:
-                    theByte =
-                        (slice_phase3(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase0(pPtr+3) > 0 ? 0x40 : 0) |
-                        (slice_phase2(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase4(pPtr+7) > 0 ? 0x10 : 0) |
-                        (slice_phase1(pPtr+10) > 0 ? 0x08 : 0) |
-                        (slice_phase3(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase0(pPtr+15) > 0 ? 0x02 : 0) |
-                        (slice_phase2(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 4;
-                    pPtr += 19;
-                    break;
+    // Decode all the next 112 bits for the remaining phases, regardless
+    // of the actual message size.
+    if (phase_mask)
+        starch_slice_phases_u16(&m[19], MODES_LONG_MSG_BYTES, phase_mask, msg);
+
+    // Work out the order to score the remaining phases in: with
+    // --score-phases, fewest weak bits first, otherwise in phase order
+    unsigned weak[5];
+    bool by_quality = Modes.score_phases && (unsigned) __builtin_popcount(phase_mask) > Modes.score_phases;
+    for (try_phase = 4; try_phase <= 8; ++try_phase) {
+        if (!(phase_mask & (1 << (try_phase - 4))))
+            continue;
 
-                case 4:
-                    theByte =
-                        (slice_phase4(pPtr) > 0 ? 0x80 : 0) |
-                        (slice_phase1(pPtr+3) > 0 ? 0x40 : 0) |
-                        (slice_phase3(pPtr+5) > 0 ? 0x20 : 0) |
-                        (slice_phase0(pPtr+8) > 0 ? 0x10 : 0) |
-                        (slice_phase2(pPtr+10) > 0 ? 0x08 : 0) |
-                        (slice_phase4(pPtr+12) > 0 ? 0x04 : 0) |
-                        (slice_phase1(pPtr+15) > 0 ? 0x02 : 0) |
-                        (slice_phase3(pPtr+17) > 0 ? 0x01 : 0);
-
-                    phase = 0;
-                    pPtr += 20;
-                    break;
-                }
+        unsigned i = count++;
+        if (by_quality) {
+            unsigned w = phase_weak_bits(&m[19], try_phase);
+            for (; i > 0 && weak[i - 1] > w; --i) {
+                order[i] = order[i - 1];
+                weak[i] = weak[i - 1];
+            }
+            weak[i] = w;
+        }
+        order[i] = try_phase;
+    }
 
-                msg[i] = theByte;
+    for (unsigned i = 0; i < count; ++i) {
+        // with --score-phases, stop after the best phases unless they
+        // needed correction or failed, and this phase is nearly as good
+        if (by_quality && i >= Modes.score_phases &&
+            ((bestscore >= SR_ACCEPT_THRESHOLD && !score_needs_correction(bestscore)) || weak[i] > weak[0] + PHASE_FALLBACK_WEAK_BITS))
+            break;
 
-                if (i == 0) {
-                    // inspect DF field early, only continue processing
-                    // messages where the DF appears valid
-                    unsigned df = theByte >> 3;
-                    if (valid_df_long_bitset & (1 << df))
-                        bytelen = MODES_LONG_MSG_BYTES;
-                    else if (valid_df_short_bitset & (1 << df))
-                        bytelen = MODES_SHORT_MSG_BYTES;
-                }
-            }
+        try_phase = order[i];
+        unsigned char *phasemsg = &msg[(try_phase - 4) * MODES_LONG_MSG_BYTES];
+        int score;
 
-            if (bytelen == 1) {
-                // rejected early by the DF filter
-                Modes.stats_current.demod_rejected_bad++;
-                continue;
-            }
+        ++*scored;
 
-            // Score the mode S message and see if it's any good.
-            score = scoreModesMessage(msg);
-            if (score > bestscore) {
-                // new high score!
-                bestmsg = msg;
-                bestscore = score;
-                bestphase = try_phase;
-
-                // swap to using the other buffer so we don't clobber our demodulated data
-                // (if we find a better result then we'll swap back, but that's OK because
-                // we no longer need this copy if we found a better one)
-                msg = (msg == msg1) ? msg2 : msg1;
-            }
+        // Score the mode S message and see if it's any good.
+        if (soft_fix_df_bitset & (1 << (phasemsg[0] >> 3))) {
+            uint16_t confidence[MODES_LONG_MSG_BITS];
+            slice_confidence(&m[19], try_phase, MODES_LONG_MSG_BITS, confidence);
+            score = scoreModesMessageSoft(phasemsg, confidence, fix);
+        } else {
+            score = scoreModesMessageSoft(phasemsg, NULL, fix);
         }
-
-        // Do we have a candidate?
-        if (bestscore < SR_ACCEPT_THRESHOLD) {
-            if (bestscore >= SR_UNKNOWN_THRESHOLD)
-                Modes.stats_current.demod_rejected_unknown_icao++;
-            else
-                Modes.stats_current.demod_rejected_bad++;
-            continue; // nope.
+        if (score > bestscore) {
+            // new high score!
+            *bestmsg = phasemsg;
+            bestscore = score;
+            *bestphase = try_phase;
         }
+    }
+
+    return bestscore;
+}
 
-        msglen = modesMessageLenByType(bestmsg[0] >> 3);
+// Where the next buffer should start scanning from; shared between the
+// serial and the threaded demodulator. Each sample source has its own
+// position, loaded by begin_buffer() and saved by end_buffer().
+static unsigned last_message_end = 0;
+static unsigned source_message_end[MAGBUF_MAX_SOURCES];
 
-        // Set initial mm structure details
-        mm = zeroMessage;
+//
+// Decode a candidate message at offset j that scored at least
+// SR_ACCEPT_THRESHOLD, feed the adaptive gain logic, and queue the message
+// for the next layer. m is the candidate's samples, from candidate_samples().
+// Returns false if the message could not be decoded, otherwise
+// last_message_end is moved past the message.
+//
+static bool accept_candidate(struct mag_buf *mag, uint32_t j, uint16_t *m, unsigned char *bestmsg, int bestphase, int bestscore, uint64_t *sum_scaled_signal_power)
+{
+    static struct modesMessage zeroMessage;
+    struct modesMessage mm;
+    int msglen;
 
-        // For consistency with how the Beast / Radarcape does it,
-        // we report the timestamp at the end of bit 56 (even if
-        // the frame is a 112-bit frame)
-        mm.timestampMsg = mag->sampleTimestamp + j*5 + (8 + 56) * 12 + bestphase;
+    msglen = modesMessageLenByType(bestmsg[0] >> 3);
 
-        // compute message receive time as block-start-time + difference in the 12MHz clock
-        mm.sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, mm.timestampMsg);
+    // Set initial mm structure details
+    mm = zeroMessage;
 
-        mm.score = bestscore;
+    // For consistency with how the Beast / Radarcape does it,
+    // we report the timestamp at the end of bit 56 (even if
+    // the frame is a 112-bit frame)
+    mm.timestampMsg = mag->sampleTimestamp + j*5 + (8 + 56) * 12 + bestphase;
 
-        // Decode the received message
-        if (decodeModesMessage(&mm, bestmsg) < 0) {
-            Modes.stats_current.demod_rejected_bad++;
-            continue;
-        } else {
-            Modes.stats_current.demod_accepted[mm.correctedbits]++;
-        }
+    // compute message receive time as block-start-time + difference in the 12MHz clock
+    mm.sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, mm.timestampMsg);
+    mm.sdr_source = mag->source;
 
-        // measure signal power
-        {
-            double signal_power;
-            uint64_t scaled_signal_power = 0;
-            int signal_len = msglen*12/5;
-            int k;
+    mm.score = bestscore;
 
-            for (k = 0; k < signal_len; ++k) {
-                uint32_t mag = m[j+19+k];
-                scaled_signal_power += mag * mag;
-            }
+    // Redo the slicer confidence if the message was scored with it
+    uint16_t confidence[MODES_LONG_MSG_BITS];
+    if (soft_fix_df_bitset & (1 << (bestmsg[0] >> 3))) {
+        slice_confidence(&m[19], bestphase, MODES_LONG_MSG_BITS, confidence);
+        mm.confidence = confidence;
+    }
 
-            signal_power = scaled_signal_power / 65535.0 / 65535.0;
-            mm.signalLevel = signal_power / signal_len;
-            Modes.stats_current.signal_power_sum += signal_power;
-            Modes.stats_current.signal_power_count += signal_len;
-            sum_scaled_signal_power += scaled_signal_power;
+    // Decode the received message
+    struct timespec decode_start;
+    start_phase_timing(&decode_start);
+    int decoded = decodeModesMessage(&mm, bestmsg);
+    end_phase_timing(&decode_start, &Modes.stats_current.decode_cpu);
+    if (decoded < 0) {
+        Modes.stats_current.demod_rejected_bad++;
+        return false;
+    } else {
+        Modes.stats_current.demod_accepted[mm.correctedbits]++;
+        Modes.stats_current.fix.accepted[mm.fixtype]++;
+    }
+    mm.confidence = NULL;
+
+    if (Modes.demod_correlate) {
+        // Would the peak/valley tests have found this one?
+        uint32_t offset;
+        unsigned found;
+        Modes.stats_current.demod_correlate_accepted[mm.correctedbits]++;
+        starch_preamble_scan_u16(m, 1, &offset, &found);
+        if (!found)
+            Modes.stats_current.demod_correlate_only++;
+    }
 
-            if (mm.signalLevel > Modes.stats_current.peak_signal_power)
-                Modes.stats_current.peak_signal_power = mm.signalLevel;
-            if (mm.signalLevel > 0.50119)
-                Modes.stats_current.strong_signal_count++; // signal power above -3dBFS
+    // measure signal power
+    {
+        double signal_power;
+        uint64_t scaled_signal_power = 0;
+        int signal_len = msglen*12/5;
+        int k;
+
+        for (k = 0; k < signal_len; ++k) {
+            uint32_t mag = m[19+k];
+            scaled_signal_power += mag * mag;
         }
 
-        // Feed "empty" sample to adaptive gain logic
-        if (j > last_message_end)
-            adaptive_update(&m[last_message_end], j - last_message_end, NULL);
+        signal_power = scaled_signal_power / 65535.0 / 65535.0;
+        mm.signalLevel = signal_power / signal_len;
+        Modes.stats_current.signal_power_sum += signal_power;
+        Modes.stats_current.signal_power_count += signal_len;
+        *sum_scaled_signal_power += scaled_signal_power;
 
-        // Feed message samples to adaptive gain logic, update end pointer
-        last_message_end = j + (msglen + 8) * 12/5;
-        adaptive_update(&m[j], last_message_end - j, &mm);
+        if (mm.signalLevel > Modes.stats_current.peak_signal_power)
+            Modes.stats_current.peak_signal_power = mm.signalLevel;
+        if (mm.signalLevel > 0.50119)
+            Modes.stats_current.strong_signal_count++; // signal power above -3dBFS
+    }
+
+    // Feed "empty" sample to adaptive gain logic (which only controls the first source)
+    if (j > last_message_end && mag->source == 0)
+        adaptive_update_empty(mag, last_message_end, j - last_message_end);
 
-        // Skip over the message:
-        // (we actually skip to 8 bits before the end of the message,
-        //  because we can often decode two messages that *almost* collide,
-        //  where the preamble of the second message clobbered the last
-        //  few bits of the first message, but the message bits didn't
-        //  overlap)
-        j = last_message_end - 8*12/5;
+    // Feed message samples to adaptive gain logic, update end pointer
+    last_message_end = j + (msglen + 8) * 12/5;
+    if (mag->source == 0)
+        adaptive_update(m, last_message_end - j, &mm);
+
+    // Queue the message for the next layer
+    queueModesMessage(&mm);
+    return true;
+}
 
-        // Pass data to the next layer
-        useModesMessage(&mm);
+// Common setup for a new buffer; returns the number of samples to scan
+static uint32_t begin_buffer(struct mag_buf *mag)
+{
+    // initialize bitsets on first call, or after a settings change
+    ensure_bitsets();
+
+    last_message_end = source_message_end[mag->source];
+    if (mag->flags & MAGBUF_DISCONTINUOUS) {
+        // gap, start from the very beginning
+        last_message_end = 0;
     }
 
+    // maximum lookahead we use
+    assert(mag->overlap >= CANDIDATE_WINDOW);
+
+    uint32_t mlen = mag->validLength - mag->overlap;
+
+    // sanity check
+    if (last_message_end > mlen)
+        last_message_end = mlen;
+
+    return mlen;
+}
+
+// Common teardown after a buffer has been scanned
+static void end_buffer(struct mag_buf *mag, uint32_t mlen, uint64_t sum_scaled_signal_power)
+{
     /* update noise power */
     {
         double sum_signal_power = sum_scaled_signal_power / 65535.0 / 65535.0;
@@ -433,7 +536,8 @@ void demodulate2400(struct mag_buf *mag)
     if (last_message_end < mlen) {
         // trailing data from end of last message to start of overlap;
         // on the next pass, start from the start of the overlap
-        adaptive_update(&m[last_message_end], mlen - last_message_end, NULL);
+        if (mag->source == 0)
+            adaptive_update_empty(mag, last_message_end, mlen - last_message_end);
         last_message_end = 0;
     } else {
         // last decoded message runs into the overlap region;
@@ -441,6 +545,366 @@ void demodulate2400(struct mag_buf *mag)
         // no trailing data to pass this time
         last_message_end -= mlen;
     }
+
+    source_message_end[mag->source] = last_message_end;
+}
+
+static void init_scanner(struct preamble_scanner *scanner, struct mag_buf *mag, uint32_t mlen)
+{
+    scanner->m = mag->data;
+    scanner->m8 = (Modes.demod_u8 ? mag->data8 : NULL);
+    scanner->mlen = mlen;
+    scanner->correlate = Modes.demod_correlate;
+    scanner->chunk_start = scanner->chunk_end = 0;
+    scanner->count = scanner->next = 0;
+}
+
+// Serial demodulator: scan the whole buffer on the calling thread
+// Slice, score and (if it is good enough) decode the candidate preamble at
+// m[j]. Returns the offset to continue looking for preambles after.
+static uint32_t demodulate_candidate(struct mag_buf *mag, uint32_t j, uint64_t *sum_scaled_signal_power)
+{
+    unsigned char msg[5 * MODES_LONG_MSG_BYTES];
+    unsigned char *bestmsg;
+    int bestscore, bestphase;
+    unsigned rejected, scored;
+    uint16_t window[CANDIDATE_WINDOW];
+    uint16_t *m = candidate_samples(mag, j, window);
+
+    // try all phases
+    Modes.stats_current.demod_preambles++;
+    if (Modes.demod_correlate)
+        Modes.stats_current.demod_correlate_preambles++;
+    bestscore = score_candidate(m, msg, &bestmsg, &bestphase, &rejected, &scored, &Modes.stats_current.fix);
+    Modes.stats_current.demod_rejected_bad += rejected;
+    Modes.stats_current.demod_phases_scored[scored]++;
+
+    // Do we have a candidate?
+    if (bestscore < SR_ACCEPT_THRESHOLD) {
+        if (bestscore >= SR_UNKNOWN_THRESHOLD)
+            Modes.stats_current.demod_rejected_unknown_icao++;
+        else
+            Modes.stats_current.demod_rejected_bad++;
+        return j; // nope.
+    }
+
+    if (!accept_candidate(mag, j, m, bestmsg, bestphase, bestscore, sum_scaled_signal_power))
+        return j;
+
+    // Skip over the message:
+    // (we actually skip to 8 bits before the end of the message,
+    //  because we can often decode two messages that *almost* collide,
+    //  where the preamble of the second message clobbered the last
+    //  few bits of the first message, but the message bits didn't
+    //  overlap)
+    return last_message_end - 8*12/5;
+}
+
+static void demodulate2400_serial(struct mag_buf *mag)
+{
+    uint32_t j;
+
+    uint32_t mlen = begin_buffer(mag);
+    uint64_t sum_scaled_signal_power = 0;
+
+    struct preamble_scanner scanner;
+    init_scanner(&scanner, mag, mlen);
+
+    for (j = next_preamble(&scanner, last_message_end); j < mlen; j = next_preamble(&scanner, j + 1))
+        j = demodulate_candidate(mag, j, &sum_scaled_signal_power);
+
+    end_buffer(mag, mlen, sum_scaled_signal_power);
+}
+
+//
+// Threaded demodulator (--demod-threads N, N > 1)
+//
+// Each buffer is split into N shards, one per worker thread. Workers run
+// the preamble scanner over their shard and slice and score every candidate
+// they find, reading past the end of the shard into the following samples
+// (and the buffer overlap) as needed. Workers don't skip over messages, as
+// where a message ends depends on everything decoded before it; instead the
+// main thread walks the candidates of all shards in sample order (and so in
+// timestampMsg order), skipping over messages exactly as the serial
+// demodulator does, and decodes and queues the accepted ones. The output
+// is identical to the serial demodulator's, regardless of the number of
+// threads.
+//
+// Scores depend on the ICAO filter. Workers only run while the main thread
+// is waiting for them, so the filter can't change under them; but decoding
+// a message during the merge may add an address to the filter, in which case
+// any remaining candidates that might be affected are rescored.
+//
+
+// A candidate preamble found by a worker
+struct demod_candidate {
+    uint32_t j;                                 // offset of the preamble in the buffer
+    int16_t score;                              // best score over all phases
+    int8_t phase;                               // phase with the best score
+    uint8_t rejected;                           // phases rejected early by the DF filter
+    uint8_t scored;                             // phases scored
+    unsigned char msg[MODES_LONG_MSG_BYTES];    // best message, if score >= SR_UNKNOWN_THRESHOLD
+};
+
+struct demod_worker {
+    pthread_t thread;
+    uint32_t start;                             // scan for preambles in [start, end)
+    uint32_t end;
+    struct demod_candidate *candidates;
+    unsigned count;                             // number of valid entries in candidates
+    unsigned capacity;                          // allocated size of candidates
+    struct timespec cpu;                        // CPU used since the last merge
+    struct fix_stats fix;                       // error correction work since the last merge
+};
+
+static struct {
+    unsigned count;                             // number of workers, 0 if not threaded
+    struct demod_worker *workers;
+
+    pthread_mutex_t mutex;                      // protects the fields below
+    pthread_cond_t work_cond;                   // signalled when a buffer is posted
+    pthread_cond_t done_cond;                   // signalled when all workers are done
+    struct mag_buf *mag;                        // buffer being demodulated
+    unsigned generation;                        // incremented for each posted buffer
+    unsigned pending;                           // workers still working on this buffer
+    bool stop;                                  // workers should exit
+} demod_pool;
+
+// Scan one shard of a buffer, recording every candidate
+static void scan_shard(struct demod_worker *w, struct mag_buf *mag)
+{
+    unsigned char msg[5 * MODES_LONG_MSG_BYTES];
+    unsigned char *bestmsg;
+    int bestphase;
+    unsigned rejected, scored;
+    uint16_t window[CANDIDATE_WINDOW];
+    uint32_t j;
+
+    struct preamble_scanner scanner;
+    init_scanner(&scanner, mag, w->end);
+
+    w->count = 0;
+    for (j = next_preamble(&scanner, w->start); j < w->end; j = next_preamble(&scanner, j + 1)) {
+        if (w->count == w->capacity) {
+            unsigned capacity = w->capacity ? w->capacity * 2 : 1024;
+            struct demod_candidate *candidates = realloc(w->candidates, capacity * sizeof(*candidates));
+            if (!candidates) {
+                fprintf(stderr, "demod_2400: out of memory, dropping candidates\n");
+                return;
+            }
+            w->candidates = candidates;
+            w->capacity = capacity;
+        }
+
+        struct demod_candidate *c = &w->candidates[w->count++];
+        c->j = j;
+        c->score = score_candidate(candidate_samples(mag, j, window), msg, &bestmsg, &bestphase, &rejected, &scored, &w->fix);
+        c->phase = bestphase;
+        c->rejected = rejected;
+        c->scored = scored;
+        if (c->score >= SR_UNKNOWN_THRESHOLD)
+            memcpy(c->msg, bestmsg, MODES_LONG_MSG_BYTES);
+    }
+}
+
+static void *demod_worker_entry(void *arg)
+{
+    struct demod_worker *w = arg;
+    unsigned seen = 0;
+
+    // workers share the demodulator thread's priority, but not its CPU
+    struct thread_policy policy = { .priority = Modes.demod_policy.priority };
+    if (policy.priority)
+        apply_thread_policy(&policy, "demodulator worker thread");
+
+    pthread_mutex_lock(&demod_pool.mutex);
+    for (;;) {
+        while (!demod_pool.stop && demod_pool.generation == seen)
+            pthread_cond_wait(&demod_pool.work_cond, &demod_pool.mutex);
+        if (demod_pool.stop)
+            break;
+
+        seen = demod_pool.generation;
+        struct mag_buf *mag = demod_pool.mag;
+        pthread_mutex_unlock(&demod_pool.mutex);
+
+        struct timespec start_time;
+        start_cpu_timing(&start_time);
+        scan_shard(w, mag);
+        end_cpu_timing(&start_time, &w->cpu);
+
+        pthread_mutex_lock(&demod_pool.mutex);
+        if (--demod_pool.pending == 0)
+            pthread_cond_signal(&demod_pool.done_cond);
+    }
+    pthread_mutex_unlock(&demod_pool.mutex);
+
+    return NULL;
+}
+
+static void demodulate2400_threaded(struct mag_buf *mag)
+{
+    unsigned char msg[5 * MODES_LONG_MSG_BYTES];
+    unsigned char *bestmsg;
+    int bestscore, bestphase;
+    unsigned rejected, scored;
+    uint16_t window[CANDIDATE_WINDOW];
+    unsigned i, k;
+
+    uint32_t mlen = begin_buffer(mag);
+    uint64_t sum_scaled_signal_power = 0;
+
+    // split [last_message_end, mlen) into shards and wait for the workers
+    uint32_t span = mlen - last_message_end;
+    for (i = 0; i < demod_pool.count; ++i) {
+        demod_pool.workers[i].start = last_message_end + (uint64_t) span * i / demod_pool.count;
+        demod_pool.workers[i].end = last_message_end + (uint64_t) span * (i + 1) / demod_pool.count;
+    }
+
+    pthread_mutex_lock(&demod_pool.mutex);
+    demod_pool.mag = mag;
+    demod_pool.pending = demod_pool.count;
+    ++demod_pool.generation;
+    pthread_cond_broadcast(&demod_pool.work_cond);
+    while (demod_pool.pending > 0)
+        pthread_cond_wait(&demod_pool.done_cond, &demod_pool.mutex);
+    pthread_mutex_unlock(&demod_pool.mutex);
+
+    // merge, in sample order
+    unsigned filter_generation = icaoFilterGeneration();
+    uint32_t next = last_message_end;
+    for (i = 0; i < demod_pool.count; ++i) {
+        struct demod_worker *w = &demod_pool.workers[i];
+
+        for (k = 0; k < w->count; ++k) {
+            struct demod_candidate *c = &w->candidates[k];
+            if (c->j < next)
+                continue; // inside a message we already decoded
+
+            Modes.stats_current.demod_preambles++;
+            if (Modes.demod_correlate)
+                Modes.stats_current.demod_correlate_preambles++;
+            Modes.stats_current.demod_rejected_bad += c->rejected;
+
+            bestscore = c->score;
+            bestphase = c->phase;
+            bestmsg = c->msg;
+            scored = c->scored;
+
+            // scores below SR_UNKNOWN_THRESHOLD don't depend on the filter,
+            // and can't be accepted
+            uint16_t *m = NULL;
+            if (bestscore >= SR_UNKNOWN_THRESHOLD)
+                m = candidate_samples(mag, c->j, window);
+            if (bestscore >= SR_UNKNOWN_THRESHOLD && icaoFilterGeneration() != filter_generation)
+                bestscore = score_candidate(m, msg, &bestmsg, &bestphase, &rejected, &scored, &Modes.stats_current.fix);
+            Modes.stats_current.demod_phases_scored[scored]++;
+
+            // Do we have a candidate?
+            if (bestscore < SR_ACCEPT_THRESHOLD) {
+                if (bestscore >= SR_UNKNOWN_THRESHOLD)
+                    Modes.stats_current.demod_rejected_unknown_icao++;
+                else
+                    Modes.stats_current.demod_rejected_bad++;
+                continue; // nope.
+            }
+
+            if (!accept_candidate(mag, c->j, m, bestmsg, bestphase, bestscore, &sum_scaled_signal_power))
+                continue;
+
+            // Skip over the message, as in demodulate2400_serial
+            next = last_message_end - 8*12/5 + 1;
+        }
+
+        add_timespecs(&w->cpu, &Modes.stats_current.demod_worker_cpu[i], &Modes.stats_current.demod_worker_cpu[i]);
+        w->cpu.tv_sec = w->cpu.tv_nsec = 0;
+        add_fix_stats(&w->fix, &Modes.stats_current.fix, &Modes.stats_current.fix);
+        memset(&w->fix, 0, sizeof(w->fix));
+    }
+
+    end_buffer(mag, mlen, sum_scaled_signal_power);
+}
+
+//
+// Start 'count' demodulator worker threads. With a count of 0 or 1,
+// demodulation is done serially on the calling thread.
+//
+bool demodulate2400Init(unsigned count)
+{
+    unsigned i;
+
+    if (count <= 1)
+        return true;
+
+    if (count > MODES_MAX_DEMOD_THREADS)
+        count = MODES_MAX_DEMOD_THREADS;
+
+    if (!(demod_pool.workers = calloc(count, sizeof(*demod_pool.workers))))
+        return false;
+
+    pthread_mutex_init(&demod_pool.mutex, NULL);
+    pthread_cond_init(&demod_pool.work_cond, NULL);
+    pthread_cond_init(&demod_pool.done_cond, NULL);
+    demod_pool.stop = false;
+
+    for (i = 0; i < count; ++i) {
+        if (pthread_create(&demod_pool.workers[i].thread, NULL, demod_worker_entry, &demod_pool.workers[i]) != 0) {
+            demod_pool.count = i;
+            demodulate2400Cleanup();
+            return false;
+        }
+    }
+
+    demod_pool.count = count;
+    return true;
+}
+
+// Mode A/C messages found by the fused demodulator, held back until the
+// Mode S messages of the buffer have been queued
+static struct modeac_detection *fused_modeac;
+static unsigned fused_modeac_capacity;
+
+// Stop any demodulator worker threads
+void demodulate2400Cleanup()
+{
+    unsigned i;
+
+    free(fused_modeac);
+    fused_modeac = NULL;
+    fused_modeac_capacity = 0;
+
+    if (!demod_pool.workers)
+        return;
+
+    pthread_mutex_lock(&demod_pool.mutex);
+    demod_pool.stop = true;
+    pthread_cond_broadcast(&demod_pool.work_cond);
+    pthread_mutex_unlock(&demod_pool.mutex);
+
+    for (i = 0; i < demod_pool.count; ++i) {
+        pthread_join(demod_pool.workers[i].thread, NULL);
+        free(demod_pool.workers[i].candidates);
+    }
+
+    free(demod_pool.workers);
+    demod_pool.workers = NULL;
+    demod_pool.count = 0;
+
+    pthread_cond_destroy(&demod_pool.done_cond);
+    pthread_cond_destroy(&demod_pool.work_cond);
+    pthread_mutex_destroy(&demod_pool.mutex);
+}
+
+//
+// Given 'mlen' magnitude samples in 'm', sampled at 2.4MHz,
+// try to demodulate some Mode S messages.
+//
+void demodulate2400(struct mag_buf *mag)
+{
+    if (demod_pool.count)
+        demodulate2400_threaded(mag);
+    else
+        demodulate2400_serial(mag);
 }
 
 #ifdef MODEAC_DEBUG
@@ -535,20 +999,53 @@ static void draw_modeac(uint16_t *m, unsigned modeac, unsigned f1_clock, unsigne
 //            1.00us = 60 cycles } one bit period = 1.45us = 87 cycles
 //
 // one 2.4MHz sample = 25 cycles
+// one 2.0MHz sample = 30 cycles
+
+// A detected Mode A/C message
+struct modeac_detection {
+    unsigned modeac;                            // in the form used by decodeModeAMessage
+    unsigned f2_clock;                          // position of F2, in 60MHz cycles since the start of the buffer
+};
+
+// Mode A/C detector state. Detection can be stopped and resumed at any
+// sample, so it can be interleaved with the Mode S demodulator.
+struct modeac_scanner {
+    uint16_t *m;
+    uint32_t mlen;                              // look for F1 in m[1 .. mlen-1]
+    uint32_t limit;                             // valid samples in m, including the overlap
+    unsigned sample_cycles;                     // 60MHz cycles per sample
+    unsigned noise_level;
+    uint32_t f1_sample;                         // next F1 position to try
+};
+
+static void init_modeac_scanner(struct modeac_scanner *s, struct mag_buf *mag, unsigned sample_cycles)
+{
+    s->m = mag->data;
+    s->mlen = mag->validLength - mag->overlap;
+    s->limit = mag->validLength;
+    s->sample_cycles = sample_cycles;
 
-void demodulate2400AC(struct mag_buf *mag)
+    double noise_stddev = sqrt(mag->mean_power - mag->mean_level * mag->mean_level); // Var(X) = E[(X-E[X])^2] = E[X^2] - (E[X])^2
+    s->noise_level = (unsigned) ((mag->mean_power + noise_stddev) * 65535 + 0.5);
+
+    s->f1_sample = 1;
+}
+
+// Look for the next Mode A/C message with F1 before 'end' (or before the
+// end of the buffer, if that is sooner). Returns true and fills in *found
+// if there is one.
+static bool next_modeac(struct modeac_scanner *s, uint32_t end, struct modeac_detection *found)
 {
-    struct modesMessage mm;
-    uint16_t *m = mag->data;
-    uint32_t mlen = mag->validLength - mag->overlap;
-    unsigned f1_sample;
+    uint16_t *m = s->m;
+    unsigned sample_cycles = s->sample_cycles;
+    unsigned noise_level = s->noise_level;
 
-    memset(&mm, 0, sizeof(mm));
+    if (end > s->mlen)
+        end = s->mlen;
 
-    double noise_stddev = sqrt(mag->mean_power - mag->mean_level * mag->mean_level); // Var(X) = E[(X-E[X])^2] = E[X^2] - (E[X])^2
-    unsigned noise_level = (unsigned) ((mag->mean_power + noise_stddev) * 65535 + 0.5);
+    for (; s->f1_sample < end; ++s->f1_sample) {
+        unsigned f1_sample = s->f1_sample;
 
-    for (f1_sample = 1; f1_sample < mlen; ++f1_sample) {
         // Mode A/C messages should match this bit sequence:
 
         // bit #     value
@@ -596,12 +1093,8 @@ void demodulate2400AC(struct mag_buf *mag)
         // but it's not a big deal as at most 4% of the power
         // is in the third sample.
 
-        if (!(m[f1_sample-1] < m[f1_sample+0]))
-            continue;      // not a rising edge
-
-        if (m[f1_sample+2] > m[f1_sample+0] || m[f1_sample+2] > m[f1_sample+1])
-            continue;      // quiet part of bit wasn't sufficiently quiet
-
+        // (the level test goes first: it rejects almost all samples that
+        // are just noise, and does so predictably, unlike the edge tests)
         unsigned f1_level = (m[f1_sample+0] + m[f1_sample+1]) / 2;
 
         if (noise_level * 2 > f1_level) {
@@ -609,19 +1102,25 @@ void demodulate2400AC(struct mag_buf *mag)
             continue;
         }
 
+        if (!(m[f1_sample-1] < m[f1_sample+0]))
+            continue;      // not a rising edge
+
+        if (m[f1_sample+2] > m[f1_sample+0] || m[f1_sample+2] > m[f1_sample+1])
+            continue;      // quiet part of bit wasn't sufficiently quiet
+
         // estimate initial clock phase based on the amount of power
         // that ended up in the second sample
 
         float f1a_power = (float)m[f1_sample] * m[f1_sample];
         float f1b_power = (float)m[f1_sample+1] * m[f1_sample+1];
         float fraction = f1b_power / (f1a_power + f1b_power);
-        unsigned f1_clock = (unsigned) (25 * (f1_sample + fraction * fraction) + 0.5);
+        unsigned f1_clock = (unsigned) (sample_cycles * (f1_sample + fraction * fraction) + 0.5);
 
         // same again for F2
         // F2 is 20.3us / 14 bit periods after F1
         unsigned f2_clock = f1_clock + (87 * 14);
-        unsigned f2_sample = f2_clock / 25;
-        assert(f2_sample < mlen + mag->overlap);
+        unsigned f2_sample = f2_clock / sample_cycles;
+        assert(f2_sample < s->limit);
 
         if (!(m[f2_sample-1] < m[f2_sample+0]))
             continue;
@@ -649,7 +1148,7 @@ void demodulate2400AC(struct mag_buf *mag)
         unsigned bit;
         unsigned clock;
         for (bit = 0, clock = f1_clock; bit < 20; ++bit, clock += 87) {
-            unsigned sample = clock / 25;
+            unsigned sample = clock / sample_cycles;
 
             bits <<= 1;
             noisy_bits <<= 1;
@@ -706,21 +1205,130 @@ void demodulate2400AC(struct mag_buf *mag)
         draw_modeac(m, modeac, f1_clock, noise_threshold, signal_threshold, bits, noisy_bits, uncertain_bits);
 #endif
 
-        // This message looks good, submit it
+        // This message looks good
+        found->modeac = modeac;
+        found->f2_clock = f2_clock;
+        s->f1_sample += (20*87 / sample_cycles) + 1;
+        return true;
+    }
+
+    return false;
+}
+
+// Decode a detected Mode A/C message and pass it on
+static void deliver_modeac(struct mag_buf *mag, struct modesMessage *mm, const struct modeac_detection *found)
+{
+    // For consistency with how the Beast / Radarcape does it,
+    // we report the timestamp at the second framing pulse (F2)
+    mm->timestampMsg = mag->sampleTimestamp + found->f2_clock / 5;  // 60MHz -> 12MHz
 
-        // For consistency with how the Beast / Radarcape does it,
-        // we report the timestamp at the second framing pulse (F2)
-        mm.timestampMsg = mag->sampleTimestamp + f2_clock / 5;  // 60MHz -> 12MHz
+    // compute message receive time as block-start-time + difference in the 12MHz clock
+    mm->sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, mm->timestampMsg);
+    mm->sdr_source = mag->source;
 
-        // compute message receive time as block-start-time + difference in the 12MHz clock
-        mm.sysTimestampMsg = mag->sysTimestamp + receiveclock_ms_elapsed(mag->sampleTimestamp, mm.timestampMsg);
+    decodeModeAMessage(mm, found->modeac);
 
-        decodeModeAMessage(&mm, modeac);
+    // Queue the message for the next layer
+    queueModesMessage(mm);
+
+    Modes.stats_current.demod_modeac++;
+}
 
-        // Pass data to the next layer
-        useModesMessage(&mm);
+static void demodulateAC(struct mag_buf *mag, unsigned sample_cycles)
+{
+    struct modesMessage mm;
+    struct modeac_scanner scanner;
+    struct modeac_detection found;
+
+    memset(&mm, 0, sizeof(mm));
 
-        f1_sample += (20*87 / 25);
-        Modes.stats_current.demod_modeac++;
+    init_modeac_scanner(&scanner, mag, sample_cycles);
+    while (next_modeac(&scanner, scanner.mlen, &found))
+        deliver_modeac(mag, &mm, &found);
+}
+
+void demodulate2400AC(struct mag_buf *mag)
+{
+    demodulateAC(mag, 25);
+}
+
+// Number of samples the fused demodulator processes at a time; both
+// detectors go over a chunk while it is still in cache
+#define FUSED_CHUNK 4096
+
+//
+// Mode S and Mode A/C demodulation in one pass over the buffer. The output
+// is the same as demodulate2400() followed by demodulate2400AC(): Mode S
+// messages are queued as they are found, and Mode A/C messages after
+// them, in sample order. (Mode A/C detection only depends on the samples, but
+// the tracking that uses Mode A/C messages depends on the Mode S messages
+// seen before them.)
+//
+static void demodulate2400_fused(struct mag_buf *mag)
+{
+    uint32_t mlen = begin_buffer(mag);
+    uint64_t sum_scaled_signal_power = 0;
+    unsigned modeac_count = 0;
+
+    struct preamble_scanner scanner;
+    init_scanner(&scanner, mag, mlen);
+
+    struct modeac_scanner ac_scanner;
+    init_modeac_scanner(&ac_scanner, mag, 25);
+
+    uint32_t j = next_preamble(&scanner, last_message_end);
+    uint32_t chunk_end = 0;
+    while (chunk_end < mlen) {
+        chunk_end = (mlen - chunk_end > FUSED_CHUNK ? chunk_end + FUSED_CHUNK : mlen);
+
+        for (; j < chunk_end; j = next_preamble(&scanner, j + 1))
+            j = demodulate_candidate(mag, j, &sum_scaled_signal_power);
+
+        for (;;) {
+            if (modeac_count == fused_modeac_capacity) {
+                unsigned capacity = fused_modeac_capacity ? fused_modeac_capacity * 2 : 256;
+                struct modeac_detection *detections = realloc(fused_modeac, capacity * sizeof(*detections));
+                if (!detections) {
+                    fprintf(stderr, "demod_2400: out of memory, dropping Mode A/C messages\n");
+                    break;
+                }
+                fused_modeac = detections;
+                fused_modeac_capacity = capacity;
+            }
+
+            if (!next_modeac(&ac_scanner, chunk_end, &fused_modeac[modeac_count]))
+                break;
+            ++modeac_count;
+        }
     }
+
+    end_buffer(mag, mlen, sum_scaled_signal_power);
+
+    struct modesMessage mm;
+    memset(&mm, 0, sizeof(mm));
+    for (unsigned i = 0; i < modeac_count; ++i)
+        deliver_modeac(mag, &mm, &fused_modeac[i]);
+}
+
+//
+// Given 'mlen' magnitude samples in 'm', sampled at 2.4MHz, try to
+// demodulate some Mode S and Mode A/C messages; equivalent to
+// demodulate2400() followed by demodulate2400AC(). With worker threads,
+// the Mode S messages are found in parallel and the two are done
+// separately.
+//
+void demodulate2400WithAC(struct mag_buf *mag)
+{
+    if (demod_pool.count || Modes.modeac_separate) {
+        demodulate2400(mag);
+        demodulate2400AC(mag);
+    } else {
+        demodulate2400_fused(mag);
+    }
+}
+
+// The 2.0MHz demodulator shares the Mode A/C demodulator
+void demodulate2000AC(struct mag_buf *mag)
+{
+    demodulateAC(mag, 30);
 }
@@ -21,10 +21,18 @@
 #define DUMP1090_DEMOD_2400_H
 
 #include <stdint.h>
+#include <stdbool.h>
+
+// Maximum number of demodulator worker threads
+#define MODES_MAX_DEMOD_THREADS 16
 
 struct mag_buf;
 
+bool demodulate2400Init(unsigned threads);
+void demodulate2400Cleanup();
 void demodulate2400(struct mag_buf *mag);
 void demodulate2400AC(struct mag_buf *mag);
+void demodulate2400WithAC(struct mag_buf *mag);
+bool demodulateValidDF(unsigned df);
 
 #endif
@@ -18,4 +18,15 @@ typedef struct {
     int16_t Q;
 } __attribute__((__packed__, __aligned__(2))) sc16_t;
 
+// DC offset state for the magnitude_dc_* kernels, normalized to -1.0 .. +1.0.
+// The kernels remove (I, Q) from each input sample before computing the
+// magnitude, and store the mean of the unfiltered input in (mean_I, mean_Q)
+// so that the caller can update its DC estimate.
+typedef struct {
+    float I;
+    float Q;
+    float mean_I;
+    float mean_Q;
+} dc_offset_t;
+
 #endif
@@ -0,0 +1,72 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "dsp/helpers/log_histogram.h"
+
+void STARCH_BENCHMARK(log_histogram_u16) (void)
+{
+    uint16_t *in = NULL;
+    uint32_t *histogram = NULL;
+    const unsigned len = 16384;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uint16_t)) || !(histogram = STARCH_BENCHMARK_ALLOC(LOG_HISTOGRAM_SIZE, uint32_t))) {
+        goto done;
+    }
+
+    /* mostly noise (Rayleigh distributed, around -30dBFS) with some full-range values */
+    srand(1);
+    for (unsigned i = 0; i < len; ++i) {
+        if (rand() % 16 == 0) {
+            in[i] = rand() % 65536;
+        } else {
+            double u = (rand() + 1.0) / (RAND_MAX + 2.0);
+            double mag = 2048.0 * sqrt(-2.0 * log(u));
+            in[i] = (mag > 65535.0 ? 65535 : (uint16_t) mag);
+        }
+    }
+
+    for (unsigned i = 0; i < LOG_HISTOGRAM_SIZE; ++i)
+        histogram[i] = 0;
+
+    STARCH_BENCHMARK_RUN( log_histogram_u16, in, len, histogram );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(histogram);
+}
+
+bool STARCH_BENCHMARK_VERIFY(log_histogram_u16) (const uint16_t *in, unsigned len, uint32_t *histogram)
+{
+    /* The histogram has accumulated some unknown number of runs, possibly of
+     * several implementations; check that it is a whole multiple of one run
+     */
+    static uint32_t expected[LOG_HISTOGRAM_BUCKETS];
+    bool okay = true;
+
+    for (unsigned b = 0; b < LOG_HISTOGRAM_BUCKETS; ++b)
+        expected[b] = 0;
+    for (unsigned i = 0; i < len; ++i)
+        ++expected[log_histogram_bucket(in[i])];
+
+    uint64_t total = 0;
+    for (unsigned b = 0; b < LOG_HISTOGRAM_BUCKETS; ++b)
+        total += log_histogram_count(histogram, b);
+
+    if (total % len) {
+        fprintf(stderr, "verification failed: histogram total %llu is not a multiple of %u\n", (unsigned long long) total, len);
+        return false;
+    }
+
+    uint64_t runs = total / len;
+    for (unsigned b = 0; b < LOG_HISTOGRAM_BUCKETS; ++b) {
+        uint32_t actual = log_histogram_count(histogram, b);
+        if (actual != expected[b] * runs) {
+            fprintf(stderr, "verification failed: bucket %u: expected %llu, got %u\n",
+                    b, (unsigned long long) (expected[b] * runs), actual);
+            okay = false;
+        }
+    }
+
+    return okay;
+}
@@ -0,0 +1,87 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+void STARCH_BENCHMARK(magnitude_dc_uc8) (void)
+{
+    uc8_t *in = NULL;
+    uint16_t *out_mag = NULL;
+    dc_offset_t *dc = NULL;
+    const unsigned len = 262144;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uc8_t)) || !(out_mag = STARCH_BENCHMARK_ALLOC(len, uint16_t)) || !(dc = STARCH_BENCHMARK_ALLOC(1, dc_offset_t))) {
+        goto done;
+    }
+
+    // A small DC offset, as seen on cheap dongles
+    dc->I = 0.02;
+    dc->Q = -0.015;
+
+    unsigned i = 0;
+
+    // 0.9 magnitude, varying phase, with DC offset
+    double degrees = 0;
+    for (; i < len && degrees < 360; i += 1, degrees += 1) {
+        in[i].I = (uint8_t) ((0.9 * cos(degrees * M_PI / 180.0) + 0.02) * 128 + 127.4);
+        in[i].Q = (uint8_t) ((0.9 * sin(degrees * M_PI / 180.0) - 0.015) * 128 + 127.4);
+    }
+
+    // Fill the rest with random values
+    srand(1);
+    for (; i < len; ++i) {
+        in[i].I = rand() % 256;
+        in[i].Q = rand() % 256;
+    }
+
+    STARCH_BENCHMARK_RUN( magnitude_dc_uc8, in, out_mag, len, dc );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out_mag);
+    STARCH_BENCHMARK_FREE(dc);
+}
+
+bool STARCH_BENCHMARK_VERIFY(magnitude_dc_uc8) (const uc8_t *in, uint16_t *out, unsigned len, dc_offset_t *dc)
+{
+    const double max_error = 0.015; // tolerate 1.5% error
+    const double epsilon = 3.0;
+    bool okay = true;
+
+    double sum_I = 0, sum_Q = 0;
+
+    for (unsigned i = 0; i < len; ++i) {
+        double rawI = (in[i].I - 127.4) / 128;
+        double rawQ = (in[i].Q - 127.4) / 128;
+        sum_I += rawI;
+        sum_Q += rawQ;
+
+        double I = rawI - dc->I;
+        double Q = rawQ - dc->Q;
+        double expected = round(sqrt(I * I + Q * Q) * 65536.0);
+        if (expected > 65535.0)
+            expected = 65535.0;
+        double actual = out[i];
+
+        double error = fabs(expected - actual);
+        double error_fraction = error / (expected > epsilon ? expected : epsilon);
+        if (error > epsilon && error_fraction > max_error) {
+            fprintf(stderr, "verification failed: in[%u].I=%d in[%u].Q=%d out[%u]=%u, expected=%.0f, error=%.2f%%\n",
+                    i, in[i].I,
+                    i, in[i].Q,
+                    i, out[i],
+                    expected,
+                    error_fraction * 100.0);
+            okay = false;
+        }
+    }
+
+    double mean_I = sum_I / len;
+    double mean_Q = sum_Q / len;
+    if (fabs(mean_I - dc->mean_I) > 1e-4 || fabs(mean_Q - dc->mean_Q) > 1e-4) {
+        fprintf(stderr, "verification failed: expected mean (%.6f,%.6f), got mean (%.6f,%.6f)\n",
+                mean_I, mean_Q, dc->mean_I, dc->mean_Q);
+        okay = false;
+    }
+
+    return okay;
+}
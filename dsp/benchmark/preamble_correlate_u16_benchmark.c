@@ -0,0 +1,91 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#ifndef DSP_PREAMBLE_CORRELATE_BENCHMARK_HELPERS
+#define DSP_PREAMBLE_CORRELATE_BENCHMARK_HELPERS
+
+// Ideal preamble shapes for phases 3..7, see demodulate2400
+static const uint8_t preamble_correlate_shapes[5][19] = {
+    { 2, 4, 0, 5, 1, 0, 0, 0, 0, 5, 1, 3, 3, 0, 0, 0, 0, 0, 0 },
+    { 1, 5, 0, 4, 2, 0, 0, 0, 0, 4, 2, 2, 4, 0, 0, 0, 0, 0, 0 },
+    { 0, 5, 1, 3, 3, 0, 0, 0, 0, 3, 3, 1, 5, 0, 0, 0, 0, 0, 0 },
+    { 0, 4, 2, 2, 4, 0, 0, 0, 0, 2, 4, 0, 5, 1, 0, 0, 0, 0, 0 },
+    { 0, 3, 3, 1, 5, 0, 0, 0, 0, 1, 5, 0, 4, 2, 0, 0, 0, 0, 0 }
+};
+
+// Reference implementation of the correlation statistic, table-driven
+static int64_t preamble_correlate_reference(const uint16_t *p)
+{
+    static const int quiet[] = { 5, 6, 7, 8, 14, 15, 16, 17, 18 };
+
+    int64_t best = INT64_MIN;
+    for (int ph = 0; ph < 5; ++ph) {
+        int64_t correlation = 0;
+        for (int k = 0; k < 19; ++k)
+            correlation += (19 * preamble_correlate_shapes[ph][k] - 24) * (int64_t) p[k];
+        if (correlation > best)
+            best = correlation;
+    }
+
+    int64_t noise = 0;
+    for (int k = 0; k < 9; ++k)
+        noise += p[quiet[k]];
+
+    return best - 64 * noise;
+}
+
+#endif /* DSP_PREAMBLE_CORRELATE_BENCHMARK_HELPERS */
+
+void STARCH_BENCHMARK(preamble_correlate_u16) (void)
+{
+    uint16_t *in = NULL;
+    uint32_t *out_offsets = NULL;
+    const unsigned len = 65536;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len + 19, uint16_t)) || !(out_offsets = STARCH_BENCHMARK_ALLOC(len, uint32_t))) {
+        goto done;
+    }
+
+    // Noise, with a preamble-shaped burst of varying phase and
+    // amplitude every few hundred samples
+    srand(1);
+    for (unsigned i = 0; i < len + 19; ++i)
+        in[i] = rand() % 2000;
+
+    for (unsigned i = 0; i + 19 < len; i += 200 + rand() % 400) {
+        const uint8_t *shape = preamble_correlate_shapes[rand() % 5];
+        unsigned amplitude = 100 + rand() % 12000;
+        for (unsigned k = 0; k < 19; ++k)
+            in[i + k] = (uint16_t) (in[i + k] / 4 + shape[k] * amplitude);
+    }
+
+    unsigned count;
+    STARCH_BENCHMARK_RUN( preamble_correlate_u16, in, len, out_offsets, &count );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out_offsets);
+}
+
+bool STARCH_BENCHMARK_VERIFY(preamble_correlate_u16) (const uint16_t *in, unsigned len, uint32_t *out_offsets, unsigned *out_count)
+{
+    unsigned next = 0;
+    for (unsigned i = 0; i < len; ++i) {
+        if (preamble_correlate_reference(&in[i]) <= 0)
+            continue;
+
+        if (next >= *out_count || out_offsets[next] != i) {
+            fprintf(stderr, "verification failed: expected candidate at offset %u, got %s%u\n",
+                    i, next >= *out_count ? "end of list at " : "", next >= *out_count ? next : out_offsets[next]);
+            return false;
+        }
+        ++next;
+    }
+
+    if (next != *out_count) {
+        fprintf(stderr, "verification failed: expected %u candidates, got %u\n", next, *out_count);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,123 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#ifndef DSP_PREAMBLE_SCAN_BENCHMARK_HELPERS
+#define DSP_PREAMBLE_SCAN_BENCHMARK_HELPERS
+
+// Ideal preamble shapes for phases 3..7, see demodulate2400
+static const uint8_t preamble_scan_shapes[5][19] = {
+    { 2, 4, 0, 5, 1, 0, 0, 0, 0, 5, 1, 3, 3, 0, 0, 0, 0, 0, 0 },
+    { 1, 5, 0, 4, 2, 0, 0, 0, 0, 4, 2, 2, 4, 0, 0, 0, 0, 0, 0 },
+    { 0, 5, 1, 3, 3, 0, 0, 0, 0, 3, 3, 1, 5, 0, 0, 0, 0, 0, 0 },
+    { 0, 4, 2, 2, 4, 0, 0, 0, 0, 2, 4, 0, 5, 1, 0, 0, 0, 0, 0 },
+    { 0, 3, 3, 1, 5, 0, 0, 0, 0, 1, 5, 0, 4, 2, 0, 0, 0, 0, 0 }
+};
+
+// Reference implementation of the preamble tests, table-driven
+static bool preamble_scan_reference(const uint16_t *p)
+{
+    static const struct {
+        signed char peaks[6][2];   // pairs (a, b) requiring p[a] > p[b] (b < 0: none)
+        signed char valleys[3][2]; // pairs (a, b) requiring p[a] < p[b]
+        signed char high[6];       // samples summed for "high", -1 terminated
+        signed char signal[5];     // samples summed for base_signal, -1 terminated
+        signed char noise[5];      // samples summed for base_noise, -1 terminated
+    } phases[5] = {
+        { { {1,2}, {3,4}, {9,10}, {-1,-1}, {-1,-1}, {-1,-1} }, { {2,3}, {8,9}, {10,11} }, { 1,3,9,11,12,-1 }, { 1,3,9,-1 }, { 5,6,7,-1 } },
+        { { {1,2}, {3,4}, {9,10}, {-1,-1}, {-1,-1}, {-1,-1} }, { {2,3}, {8,9}, {11,12} }, { 1,3,9,12,-1 }, { 1,3,9,12,-1 }, { 5,6,7,8,-1 } },
+        { { {1,2}, {4,5}, {10,11}, {-1,-1}, {-1,-1}, {-1,-1} }, { {2,3}, {8,9}, {11,12} }, { 1,3,4,9,10,12 }, { 1,12,-1 }, { 6,7,-1 } },
+        { { {1,2}, {4,5}, {10,11}, {-1,-1}, {-1,-1}, {-1,-1} }, { {3,4}, {9,10}, {11,12} }, { 1,4,10,12,-1 }, { 1,4,10,12,-1 }, { 5,6,7,8,-1 } },
+        { { {2,3}, {4,5}, {10,11}, {-1,-1}, {-1,-1}, {-1,-1} }, { {3,4}, {9,10}, {11,12} }, { 1,2,4,10,12,-1 }, { 4,10,12,-1 }, { 6,7,8,-1 } },
+    };
+    static const int quiet[] = { 5, 6, 7, 8, 14, 15, 16, 17, 18 };
+
+    if (!(p[0] < p[1] && p[12] > p[13]))
+        return false;
+
+    for (int ph = 0; ph < 5; ++ph) {
+        bool match = true;
+        for (int k = 0; k < 6 && phases[ph].peaks[k][0] >= 0; ++k)
+            match = match && p[phases[ph].peaks[k][0]] > p[phases[ph].peaks[k][1]];
+        for (int k = 0; k < 3; ++k)
+            match = match && p[phases[ph].valleys[k][0]] < p[phases[ph].valleys[k][1]];
+        if (!match)
+            continue;
+
+        // first matching phase decides
+        int high = 0;
+        for (int k = 0; k < 6 && phases[ph].high[k] >= 0; ++k)
+            high += p[phases[ph].high[k]];
+        high /= 4;
+
+        uint32_t signal = 0, noise = 0;
+        for (int k = 0; phases[ph].signal[k] >= 0; ++k)
+            signal += p[phases[ph].signal[k]];
+        for (int k = 0; phases[ph].noise[k] >= 0; ++k)
+            noise += p[phases[ph].noise[k]];
+
+        if (signal * 2 < 3 * noise)
+            return false;
+        for (int k = 0; k < 9; ++k)
+            if (p[quiet[k]] >= high)
+                return false;
+        return true;
+    }
+
+    return false;
+}
+
+#endif /* DSP_PREAMBLE_SCAN_BENCHMARK_HELPERS */
+
+void STARCH_BENCHMARK(preamble_scan_u16) (void)
+{
+    uint16_t *in = NULL;
+    uint32_t *out_offsets = NULL;
+    const unsigned len = 65536;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len + 19, uint16_t)) || !(out_offsets = STARCH_BENCHMARK_ALLOC(len, uint32_t))) {
+        goto done;
+    }
+
+    // Noise, with a preamble-shaped burst of varying phase and
+    // amplitude every few hundred samples
+    srand(1);
+    for (unsigned i = 0; i < len + 19; ++i)
+        in[i] = rand() % 2000;
+
+    for (unsigned i = 0; i + 19 < len; i += 200 + rand() % 400) {
+        const uint8_t *shape = preamble_scan_shapes[rand() % 5];
+        unsigned amplitude = 500 + rand() % 12000;
+        for (unsigned k = 0; k < 19; ++k)
+            in[i + k] = (uint16_t) (in[i + k] / 4 + shape[k] * amplitude);
+    }
+
+    unsigned count;
+    STARCH_BENCHMARK_RUN( preamble_scan_u16, in, len, out_offsets, &count );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out_offsets);
+}
+
+bool STARCH_BENCHMARK_VERIFY(preamble_scan_u16) (const uint16_t *in, unsigned len, uint32_t *out_offsets, unsigned *out_count)
+{
+    unsigned next = 0;
+    for (unsigned i = 0; i < len; ++i) {
+        if (!preamble_scan_reference(&in[i]))
+            continue;
+
+        if (next >= *out_count || out_offsets[next] != i) {
+            fprintf(stderr, "verification failed: expected candidate at offset %u, got %s%u\n",
+                    i, next >= *out_count ? "end of list at " : "", next >= *out_count ? next : out_offsets[next]);
+            return false;
+        }
+        ++next;
+    }
+
+    if (next != *out_count) {
+        fprintf(stderr, "verification failed: expected %u candidates, got %u\n", next, *out_count);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,65 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+// preamble_scan_shapes and preamble_scan_reference come from
+// preamble_scan_u16_benchmark.c, which is included before this file
+#ifndef DSP_PREAMBLE_SCAN_BENCHMARK_HELPERS
+#error "preamble_scan_u16_benchmark.c must be included first"
+#endif
+
+void STARCH_BENCHMARK(preamble_scan_u8) (void)
+{
+    uint8_t *in = NULL;
+    uint32_t *out_offsets = NULL;
+    const unsigned len = 65536;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len + 19, uint8_t)) || !(out_offsets = STARCH_BENCHMARK_ALLOC(len, uint32_t))) {
+        goto done;
+    }
+
+    // Noise, with a preamble-shaped burst of varying phase and
+    // amplitude every few hundred samples (as preamble_scan_u16, scaled to 8 bits)
+    srand(1);
+    for (unsigned i = 0; i < len + 19; ++i)
+        in[i] = rand() % 8;
+
+    for (unsigned i = 0; i + 19 < len; i += 200 + rand() % 400) {
+        const uint8_t *shape = preamble_scan_shapes[rand() % 5];
+        unsigned amplitude = 2 + rand() % 46;
+        for (unsigned k = 0; k < 19; ++k)
+            in[i + k] = (uint8_t) (in[i + k] / 4 + shape[k] * amplitude);
+    }
+
+    unsigned count;
+    STARCH_BENCHMARK_RUN( preamble_scan_u8, in, len, out_offsets, &count );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out_offsets);
+}
+
+bool STARCH_BENCHMARK_VERIFY(preamble_scan_u8) (const uint8_t *in, unsigned len, uint32_t *out_offsets, unsigned *out_count)
+{
+    unsigned next = 0;
+    for (unsigned i = 0; i < len; ++i) {
+        uint16_t wide[19];
+        for (unsigned k = 0; k < 19; ++k)
+            wide[k] = in[i + k];
+        if (!preamble_scan_reference(wide))
+            continue;
+
+        if (next >= *out_count || out_offsets[next] != i) {
+            fprintf(stderr, "verification failed: expected candidate at offset %u, got %s%u\n",
+                    i, next >= *out_count ? "end of list at " : "", next >= *out_count ? next : out_offsets[next]);
+            return false;
+        }
+        ++next;
+    }
+
+    if (next != *out_count) {
+        fprintf(stderr, "verification failed: expected %u candidates, got %u\n", next, *out_count);
+        return false;
+    }
+
+    return true;
+}
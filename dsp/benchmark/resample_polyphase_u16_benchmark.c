@@ -0,0 +1,74 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+void STARCH_BENCHMARK(resample_polyphase_u16) (void)
+{
+    uint16_t *in = NULL;
+    uint16_t *out = NULL;
+    float *coeffs = NULL;
+
+    /* 3.2MHz -> 2.4MHz: 3 output samples for every 4 input samples */
+    const unsigned phases = 3, stride = 4, taps = 16;
+    const unsigned periods = 4096;
+    static unsigned offsets[3];
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(periods * stride + 2 * taps, uint16_t)) ||
+        !(out = STARCH_BENCHMARK_ALLOC(periods * phases, uint16_t)) ||
+        !(coeffs = STARCH_BENCHMARK_ALLOC(phases * taps, float))) {
+        goto done;
+    }
+
+    /* windowed-sinc lowpass, split into phases */
+    for (unsigned p = 0; p < phases; ++p) {
+        double center = (taps - 1) / 2.0 + (double) p * stride / phases - (p * stride / phases);
+        double sum = 0;
+        offsets[p] = p * stride / phases;
+        for (unsigned k = 0; k < taps; ++k) {
+            double x = (k - center) * phases / stride;
+            double sinc = (x == 0 ? 1.0 : sin(M_PI * x) / (M_PI * x));
+            double window = 0.42 + 0.5 * cos(M_PI * (k - center) / taps * 2) + 0.08 * cos(M_PI * (k - center) / taps * 4);
+            coeffs[p * taps + k] = sinc * window;
+            sum += coeffs[p * taps + k];
+        }
+        for (unsigned k = 0; k < taps; ++k)
+            coeffs[p * taps + k] /= sum;
+    }
+
+    /* noise with some pulses */
+    srand(1);
+    for (unsigned i = 0; i < periods * stride + 2 * taps; ++i)
+        in[i] = rand() % 4096 + ((i / 3) % 7 == 0 ? 40000 : 0);
+
+    STARCH_BENCHMARK_RUN( resample_polyphase_u16, in, periods, stride, coeffs, offsets, phases, taps, out );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out);
+    STARCH_BENCHMARK_FREE(coeffs);
+}
+
+bool STARCH_BENCHMARK_VERIFY(resample_polyphase_u16) (const uint16_t *in, unsigned periods, unsigned stride,
+                                                      const float *coeffs, const unsigned *offsets,
+                                                      unsigned phases, unsigned taps, uint16_t *out)
+{
+    bool okay = true;
+
+    for (unsigned q = 0; q < periods; ++q) {
+        for (unsigned p = 0; p < phases; ++p) {
+            double acc = 0;
+            for (unsigned k = 0; k < taps; ++k)
+                acc += coeffs[p * taps + k] * in[q * stride + offsets[p] + k];
+
+            double expected = (acc < 0 ? 0 : acc > 65535 ? 65535 : acc);
+            uint16_t actual = out[q * phases + p];
+            if (fabs(actual - expected) > 1.0) {
+                fprintf(stderr, "verification failed: period %u phase %u: expected %.1f, got %u\n",
+                        q, p, expected, actual);
+                okay = false;
+            }
+        }
+    }
+
+    return okay;
+}
@@ -0,0 +1,77 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#ifndef DSP_SLICE_PHASES_BENCHMARK_HELPERS
+#define DSP_SLICE_PHASES_BENCHMARK_HELPERS
+
+// Reference slicer, table-driven: correlation weights for sub-sample phases 0..4
+static unsigned slice_phases_reference(const uint16_t *in, unsigned n, unsigned bit)
+{
+    static const int weights[5][4] = {
+        { 5, -3, -2,  0 },
+        { 4, -1, -3,  0 },
+        { 3,  1, -4,  0 },
+        { 2,  3, -5,  0 },
+        { 1,  5, -5, -1 }
+    };
+
+    unsigned u = 4 + n + 12 * bit;
+    const uint16_t *m = &in[u / 5];
+    const int *w = weights[u % 5];
+    return (w[0] * m[0] + w[1] * m[1] + w[2] * m[2] + w[3] * m[3]) > 0;
+}
+
+#endif /* DSP_SLICE_PHASES_BENCHMARK_HELPERS */
+
+void STARCH_BENCHMARK(slice_phases_u16) (void)
+{
+    uint16_t *in = NULL;
+    uint8_t *out = NULL;
+    const unsigned bytes = 14; /* a long message */
+    const unsigned len = bytes * 8 * 12 / 5 + 16;
+
+    if (!(in = STARCH_BENCHMARK_ALLOC(len, uint16_t)) || !(out = STARCH_BENCHMARK_ALLOC(5 * bytes, uint8_t))) {
+        goto done;
+    }
+
+    /* random manchester-encoded bits at 2.4MHz plus some noise */
+    srand(1);
+    for (unsigned i = 0; i < len; ++i)
+        in[i] = rand() % 4096;
+    for (unsigned bit = 0; bit < bytes * 8; ++bit) {
+        unsigned start = 12 * bit / 5 + 1;
+        if (rand() & 1)
+            in[start] += 40000;
+        else if (start + 1 < len)
+            in[start + 1] += 40000;
+    }
+
+    STARCH_BENCHMARK_RUN( slice_phases_u16, in, bytes, 0x1F, out );
+
+ done:
+    STARCH_BENCHMARK_FREE(in);
+    STARCH_BENCHMARK_FREE(out);
+}
+
+bool STARCH_BENCHMARK_VERIFY(slice_phases_u16) (const uint16_t *in, unsigned bytes, unsigned phase_mask, uint8_t *out)
+{
+    bool okay = true;
+
+    for (unsigned n = 0; n < 5; ++n) {
+        if (!(phase_mask & (1 << n)))
+            continue;
+        for (unsigned i = 0; i < bytes; ++i) {
+            unsigned expected = 0;
+            for (unsigned bit = 0; bit < 8; ++bit)
+                expected = (expected << 1) | slice_phases_reference(in, n, i * 8 + bit);
+
+            if (out[n * bytes + i] != expected) {
+                fprintf(stderr, "verification failed: phase %u byte %u: expected %02x, got %02x\n",
+                        n, i, expected, out[n * bytes + i]);
+                okay = false;
+            }
+        }
+    }
+
+    return okay;
+}
@@ -56,6 +56,7 @@ static bool starch_benchmark_validate_only = false;
 static bool starch_benchmark_validation_failed = false;
 static bool starch_benchmark_top_only = false;
 static unsigned starch_benchmark_iterations = 1;
+static uint64_t starch_benchmark_target_ns = 1000000000;
 
 typedef struct timespec starch_benchmark_time;
 void starch_benchmark_get_time(starch_benchmark_time *t)
@@ -169,12 +170,12 @@ static void starch_benchmark_one_count_above_u16( starch_count_above_u16_regentr
         return;
     }
 
-    /* pre-benchmark, find a loop count that takes at least 100ms */
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
     starch_benchmark_time _start, _end;
     uint64_t _elapsed = 0;
-    uint64_t _loops = 127;
-    while (_elapsed < 100000000) {
-        _loops *= 2;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
             _entry->callable ( arg0, arg1, arg2, arg3 );
@@ -182,8 +183,10 @@ static void starch_benchmark_one_count_above_u16( starch_count_above_u16_regentr
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
 
-    /* real benchmark, run for approx 1 second */
-    _loops = _loops * 1000000000 / _elapsed;
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
 
     _elapsed = 0;
     uint64_t _elapsed_min = UINT64_MAX;
@@ -281,12 +284,12 @@ static void starch_benchmark_one_count_above_u16_aligned( starch_count_above_u16
         return;
     }
 
-    /* pre-benchmark, find a loop count that takes at least 100ms */
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
     starch_benchmark_time _start, _end;
     uint64_t _elapsed = 0;
-    uint64_t _loops = 127;
-    while (_elapsed < 100000000) {
-        _loops *= 2;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
             _entry->callable ( arg0, arg1, arg2, arg3 );
@@ -294,8 +297,10 @@ static void starch_benchmark_one_count_above_u16_aligned( starch_count_above_u16
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
 
-    /* real benchmark, run for approx 1 second */
-    _loops = _loops * 1000000000 / _elapsed;
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
 
     _elapsed = 0;
     uint64_t _elapsed_min = UINT64_MAX;
@@ -346,14 +351,2180 @@ static void starch_benchmark_run_count_above_u16_aligned( const uint16_t * arg0,
     }
 }
 
+/* prototypes for benchmark helpers provided by user code */
+void starch_log_histogram_u16_benchmark (void);
+bool starch_log_histogram_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_log_histogram_u16_benchmark(void);
+
+static void starch_benchmark_one_log_histogram_u16( starch_log_histogram_u16_regentry * _entry, const uint16_t * arg0, unsigned arg1, uint32_t * arg2 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2 );
+
+    /* verify correctness of the output */
+    if (! starch_log_histogram_u16_benchmark_verify ( arg0, arg1, arg2 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "log_histogram_u16";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_log_histogram_u16( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 )
+{
+    for (starch_log_histogram_u16_regentry *_entry = starch_log_histogram_u16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_log_histogram_u16( _entry, arg0, arg1, arg2 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_sc16_benchmark (void);
+bool starch_magnitude_dc_sc16_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_sc16_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_sc16( starch_magnitude_dc_sc16_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_sc16_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_sc16";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_sc16( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 )
+{
+    for (starch_magnitude_dc_sc16_regentry *_entry = starch_magnitude_dc_sc16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_sc16( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_sc16_aligned_benchmark (void);
+bool starch_magnitude_dc_sc16_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_sc16_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_sc16_aligned( starch_magnitude_dc_sc16_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_sc16_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_sc16_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_sc16_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 )
+{
+    for (starch_magnitude_dc_sc16_aligned_regentry *_entry = starch_magnitude_dc_sc16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_sc16_aligned( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_sc16q11_benchmark (void);
+bool starch_magnitude_dc_sc16q11_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_sc16q11_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_sc16q11( starch_magnitude_dc_sc16q11_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_sc16q11_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_sc16q11";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_sc16q11( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 )
+{
+    for (starch_magnitude_dc_sc16q11_regentry *_entry = starch_magnitude_dc_sc16q11_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_sc16q11( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_sc16q11_aligned_benchmark (void);
+bool starch_magnitude_dc_sc16q11_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_sc16q11_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_sc16q11_aligned( starch_magnitude_dc_sc16q11_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_sc16q11_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_sc16q11_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_sc16q11_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 )
+{
+    for (starch_magnitude_dc_sc16q11_aligned_regentry *_entry = starch_magnitude_dc_sc16q11_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_sc16q11_aligned( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_uc8_benchmark (void);
+bool starch_magnitude_dc_uc8_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_uc8_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_uc8( starch_magnitude_dc_uc8_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_uc8_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_uc8";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_uc8( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 )
+{
+    for (starch_magnitude_dc_uc8_regentry *_entry = starch_magnitude_dc_uc8_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_uc8( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_dc_uc8_aligned_benchmark (void);
+bool starch_magnitude_dc_uc8_aligned_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_dc_uc8_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_dc_uc8_aligned( starch_magnitude_dc_uc8_aligned_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_dc_uc8_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_dc_uc8_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_dc_uc8_aligned( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 )
+{
+    for (starch_magnitude_dc_uc8_aligned_regentry *_entry = starch_magnitude_dc_uc8_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_dc_uc8_aligned( _entry, arg0, arg1, arg2, arg3 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_power_sc16_benchmark (void);
+bool starch_magnitude_power_sc16_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_power_sc16_benchmark(void);
+
+static void starch_benchmark_one_magnitude_power_sc16( starch_magnitude_power_sc16_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_power_sc16_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_sc16";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_power_sc16( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    for (starch_magnitude_power_sc16_regentry *_entry = starch_magnitude_power_sc16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_power_sc16( _entry, arg0, arg1, arg2, arg3, arg4 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_power_sc16_aligned_benchmark (void);
+bool starch_magnitude_power_sc16_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_power_sc16_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_power_sc16_aligned( starch_magnitude_power_sc16_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_power_sc16_aligned_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_sc16_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_power_sc16_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    for (starch_magnitude_power_sc16_aligned_regentry *_entry = starch_magnitude_power_sc16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_power_sc16_aligned( _entry, arg0, arg1, arg2, arg3, arg4 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_power_sc16q11_benchmark (void);
+bool starch_magnitude_power_sc16q11_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_power_sc16q11_benchmark(void);
+
+static void starch_benchmark_one_magnitude_power_sc16q11( starch_magnitude_power_sc16q11_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_power_sc16q11_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_sc16q11";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_power_sc16q11( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    for (starch_magnitude_power_sc16q11_regentry *_entry = starch_magnitude_power_sc16q11_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_power_sc16q11( _entry, arg0, arg1, arg2, arg3, arg4 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_power_sc16q11_aligned_benchmark (void);
+bool starch_magnitude_power_sc16q11_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_power_sc16q11_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_power_sc16q11_aligned( starch_magnitude_power_sc16q11_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_power_sc16q11_aligned_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_sc16q11_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_power_sc16q11_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    for (starch_magnitude_power_sc16q11_aligned_regentry *_entry = starch_magnitude_power_sc16q11_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_power_sc16q11_aligned( _entry, arg0, arg1, arg2, arg3, arg4 );
+    }
+}
+
 /* prototypes for benchmark helpers provided by user code */
 void starch_magnitude_power_uc8_benchmark (void);
 bool starch_magnitude_power_uc8_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_power_uc8_benchmark(void);
+void starch_magnitude_power_uc8_benchmark(void);
+
+static void starch_benchmark_one_magnitude_power_uc8( starch_magnitude_power_uc8_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_power_uc8_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_uc8";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_power_uc8( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    for (starch_magnitude_power_uc8_regentry *_entry = starch_magnitude_power_uc8_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_power_uc8( _entry, arg0, arg1, arg2, arg3, arg4 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_power_uc8_aligned_benchmark (void);
+bool starch_magnitude_power_uc8_aligned_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_power_uc8_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_power_uc8_aligned( starch_magnitude_power_uc8_aligned_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_power_uc8_aligned_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_uc8_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_power_uc8_aligned( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    for (starch_magnitude_power_uc8_aligned_regentry *_entry = starch_magnitude_power_uc8_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_power_uc8_aligned( _entry, arg0, arg1, arg2, arg3, arg4 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_power_uc8_u8_benchmark (void);
+bool starch_magnitude_power_uc8_u8_benchmark_verify ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_power_uc8_u8_benchmark(void);
+
+static void starch_benchmark_one_magnitude_power_uc8_u8( starch_magnitude_power_uc8_u8_regentry * _entry, const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_power_uc8_u8_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_uc8_u8";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_power_uc8_u8( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    for (starch_magnitude_power_uc8_u8_regentry *_entry = starch_magnitude_power_uc8_u8_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_power_uc8_u8( _entry, arg0, arg1, arg2, arg3, arg4 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_power_uc8_u8_aligned_benchmark (void);
+bool starch_magnitude_power_uc8_u8_aligned_benchmark_verify ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_power_uc8_u8_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_power_uc8_u8_aligned( starch_magnitude_power_uc8_u8_aligned_regentry * _entry, const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_power_uc8_u8_aligned_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_uc8_u8_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_power_uc8_u8_aligned( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+{
+    for (starch_magnitude_power_uc8_u8_aligned_regentry *_entry = starch_magnitude_power_uc8_u8_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_power_uc8_u8_aligned( _entry, arg0, arg1, arg2, arg3, arg4 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_sc16_benchmark (void);
+bool starch_magnitude_sc16_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_sc16_benchmark(void);
+
+static void starch_benchmark_one_magnitude_sc16( starch_magnitude_sc16_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_sc16_benchmark_verify ( arg0, arg1, arg2 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_sc16( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    for (starch_magnitude_sc16_regentry *_entry = starch_magnitude_sc16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_sc16( _entry, arg0, arg1, arg2 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_sc16_aligned_benchmark (void);
+bool starch_magnitude_sc16_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_sc16_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_sc16_aligned( starch_magnitude_sc16_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_sc16_aligned_benchmark_verify ( arg0, arg1, arg2 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_sc16_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    for (starch_magnitude_sc16_aligned_regentry *_entry = starch_magnitude_sc16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_sc16_aligned( _entry, arg0, arg1, arg2 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_sc16q11_benchmark (void);
+bool starch_magnitude_sc16q11_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_sc16q11_benchmark(void);
+
+static void starch_benchmark_one_magnitude_sc16q11( starch_magnitude_sc16q11_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_sc16q11_benchmark_verify ( arg0, arg1, arg2 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16q11";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_sc16q11( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    for (starch_magnitude_sc16q11_regentry *_entry = starch_magnitude_sc16q11_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_sc16q11( _entry, arg0, arg1, arg2 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_sc16q11_aligned_benchmark (void);
+bool starch_magnitude_sc16q11_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_sc16q11_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_sc16q11_aligned( starch_magnitude_sc16q11_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_sc16q11_aligned_benchmark_verify ( arg0, arg1, arg2 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16q11_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_sc16q11_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    for (starch_magnitude_sc16q11_aligned_regentry *_entry = starch_magnitude_sc16q11_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_sc16q11_aligned( _entry, arg0, arg1, arg2 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_uc8_benchmark (void);
+bool starch_magnitude_uc8_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_uc8_benchmark(void);
 
-static void starch_benchmark_one_magnitude_power_uc8( starch_magnitude_power_uc8_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+static void starch_benchmark_one_magnitude_uc8( starch_magnitude_uc8_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -380,10 +2551,238 @@ static void starch_benchmark_one_magnitude_power_uc8( starch_magnitude_power_uc8
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        _entry->callable ( arg0, arg1, arg2 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_power_uc8_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+    if (! starch_magnitude_uc8_benchmark_verify ( arg0, arg1, arg2 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_uc8";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_uc8( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    for (starch_magnitude_uc8_regentry *_entry = starch_magnitude_uc8_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_uc8( _entry, arg0, arg1, arg2 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_magnitude_uc8_aligned_benchmark (void);
+bool starch_magnitude_uc8_aligned_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_magnitude_uc8_aligned_benchmark(void);
+
+static void starch_benchmark_one_magnitude_uc8_aligned( starch_magnitude_uc8_aligned_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2 );
+
+    /* verify correctness of the output */
+    if (! starch_magnitude_uc8_aligned_benchmark_verify ( arg0, arg1, arg2 )) {
+        fprintf(stderr, "skipped (verification failed)\n");
+        starch_benchmark_validation_failed = true;
+        return;
+    }
+    if (starch_benchmark_validate_only) {
+        fprintf(stderr, "validation ok\n");
+        return;
+    }
+
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
+    starch_benchmark_time _start, _end;
+    uint64_t _elapsed = 0;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        _elapsed = starch_benchmark_elapsed(&_start, &_end);
+    }
+
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
+
+    _elapsed = 0;
+    uint64_t _elapsed_min = UINT64_MAX;
+    uint64_t _elapsed_max = 0;
+    for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
+        starch_benchmark_get_time(&_start);
+        for (uint64_t _loop = 0; _loop < _loops; ++_loop)
+            _entry->callable ( arg0, arg1, arg2 );
+        starch_benchmark_get_time(&_end);
+        uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
+        if (_elapsed_one < _elapsed_min)
+            _elapsed_min = _elapsed_one;
+        if (_elapsed_one > _elapsed_max)
+            _elapsed_max = _elapsed_one;
+        _elapsed += _elapsed_one;
+    }
+
+    uint64_t _per_loop;
+    if (starch_benchmark_iterations > 2)
+        _per_loop = (_elapsed - _elapsed_min - _elapsed_max) / _loops / (starch_benchmark_iterations - 2);
+    else
+        _per_loop = _elapsed / _loops / starch_benchmark_iterations;
+
+    fprintf(stderr, "%" PRIu64 " ns/call\n", _per_loop);
+
+    if (starch_benchmark_result_count >= starch_benchmark_result_size) {
+        if (!starch_benchmark_result_size)
+            starch_benchmark_result_size = 64;
+        else
+            starch_benchmark_result_size *= 2;
+        starch_benchmark_results = realloc(starch_benchmark_results, starch_benchmark_result_size * sizeof(*starch_benchmark_results));
+        if (!starch_benchmark_results) {
+            fprintf(stderr, "realloc: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_uc8_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
+    starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
+    ++starch_benchmark_result_count;
+}
+
+static void starch_benchmark_run_magnitude_uc8_aligned( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
+{
+    for (starch_magnitude_uc8_aligned_regentry *_entry = starch_magnitude_uc8_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_magnitude_uc8_aligned( _entry, arg0, arg1, arg2 );
+    }
+}
+
+/* prototypes for benchmark helpers provided by user code */
+void starch_mean_power_u16_benchmark (void);
+bool starch_mean_power_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+
+/* prototype the benchmarking function so that we can build with -Wmissing-declarations */
+void starch_mean_power_u16_benchmark(void);
+
+static void starch_benchmark_one_mean_power_u16( starch_mean_power_u16_regentry * _entry, const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
+{
+    fprintf(stderr, "  %-40s  ", _entry->name);
+
+    /* test for support */
+    if (_entry->flavor_supported && !(_entry->flavor_supported())) {
+        fprintf(stderr, "unsupported\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_whitelist && !starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_whitelist)) {
+        fprintf(stderr, "skipped (not whitelisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_flavor_blacklist && starch_benchmark_flavor_in_list(_entry->flavor, starch_benchmark_flavor_blacklist)) {
+        fprintf(stderr, "skipped (blacklisted)\n");
+        return;
+    }
+
+    if (starch_benchmark_list_only) {
+        fprintf(stderr, "supported\n");
+        return;
+    }
+
+    /* initial warmup */
+    for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
+        _entry->callable ( arg0, arg1, arg2, arg3 );
+
+    /* verify correctness of the output */
+    if (! starch_mean_power_u16_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -393,21 +2792,23 @@ static void starch_benchmark_one_magnitude_power_uc8( starch_magnitude_power_uc8
         return;
     }
 
-    /* pre-benchmark, find a loop count that takes at least 100ms */
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
     starch_benchmark_time _start, _end;
     uint64_t _elapsed = 0;
-    uint64_t _loops = 127;
-    while (_elapsed < 100000000) {
-        _loops *= 2;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
 
-    /* real benchmark, run for approx 1 second */
-    _loops = _loops * 1000000000 / _elapsed;
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
 
     _elapsed = 0;
     uint64_t _elapsed_min = UINT64_MAX;
@@ -415,7 +2816,7 @@ static void starch_benchmark_one_magnitude_power_uc8( starch_magnitude_power_uc8
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -445,27 +2846,27 @@ static void starch_benchmark_one_magnitude_power_uc8( starch_magnitude_power_uc8
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_uc8";
+    starch_benchmark_results[starch_benchmark_result_count].name = "mean_power_u16";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_power_uc8( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+static void starch_benchmark_run_mean_power_u16( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
 {
-    for (starch_magnitude_power_uc8_regentry *_entry = starch_magnitude_power_uc8_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_power_uc8( _entry, arg0, arg1, arg2, arg3, arg4 );
+    for (starch_mean_power_u16_regentry *_entry = starch_mean_power_u16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_mean_power_u16( _entry, arg0, arg1, arg2, arg3 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_power_uc8_aligned_benchmark (void);
-bool starch_magnitude_power_uc8_aligned_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_mean_power_u16_aligned_benchmark (void);
+bool starch_mean_power_u16_aligned_benchmark_verify ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_power_uc8_aligned_benchmark(void);
+void starch_mean_power_u16_aligned_benchmark(void);
 
-static void starch_benchmark_one_magnitude_power_uc8_aligned( starch_magnitude_power_uc8_aligned_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+static void starch_benchmark_one_mean_power_u16_aligned( starch_mean_power_u16_aligned_regentry * _entry, const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -492,10 +2893,10 @@ static void starch_benchmark_one_magnitude_power_uc8_aligned( starch_magnitude_p
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+        _entry->callable ( arg0, arg1, arg2, arg3 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_power_uc8_aligned_benchmark_verify ( arg0, arg1, arg2, arg3, arg4 )) {
+    if (! starch_mean_power_u16_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -505,21 +2906,23 @@ static void starch_benchmark_one_magnitude_power_uc8_aligned( starch_magnitude_p
         return;
     }
 
-    /* pre-benchmark, find a loop count that takes at least 100ms */
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
     starch_benchmark_time _start, _end;
     uint64_t _elapsed = 0;
-    uint64_t _loops = 127;
-    while (_elapsed < 100000000) {
-        _loops *= 2;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
 
-    /* real benchmark, run for approx 1 second */
-    _loops = _loops * 1000000000 / _elapsed;
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
 
     _elapsed = 0;
     uint64_t _elapsed_min = UINT64_MAX;
@@ -527,7 +2930,7 @@ static void starch_benchmark_one_magnitude_power_uc8_aligned( starch_magnitude_p
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2, arg3, arg4 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -557,27 +2960,27 @@ static void starch_benchmark_one_magnitude_power_uc8_aligned( starch_magnitude_p
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_power_uc8_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].name = "mean_power_u16_aligned";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_power_uc8_aligned( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 )
+static void starch_benchmark_run_mean_power_u16_aligned( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
 {
-    for (starch_magnitude_power_uc8_aligned_regentry *_entry = starch_magnitude_power_uc8_aligned_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_power_uc8_aligned( _entry, arg0, arg1, arg2, arg3, arg4 );
+    for (starch_mean_power_u16_aligned_regentry *_entry = starch_mean_power_u16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_mean_power_u16_aligned( _entry, arg0, arg1, arg2, arg3 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_sc16_benchmark (void);
-bool starch_magnitude_sc16_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_preamble_correlate_u16_benchmark (void);
+bool starch_preamble_correlate_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_sc16_benchmark(void);
+void starch_preamble_correlate_u16_benchmark(void);
 
-static void starch_benchmark_one_magnitude_sc16( starch_magnitude_sc16_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_one_preamble_correlate_u16( starch_preamble_correlate_u16_regentry * _entry, const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -604,10 +3007,10 @@ static void starch_benchmark_one_magnitude_sc16( starch_magnitude_sc16_regentry
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2 );
+        _entry->callable ( arg0, arg1, arg2, arg3 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_sc16_benchmark_verify ( arg0, arg1, arg2 )) {
+    if (! starch_preamble_correlate_u16_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -617,21 +3020,23 @@ static void starch_benchmark_one_magnitude_sc16( starch_magnitude_sc16_regentry
         return;
     }
 
-    /* pre-benchmark, find a loop count that takes at least 100ms */
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
     starch_benchmark_time _start, _end;
     uint64_t _elapsed = 0;
-    uint64_t _loops = 127;
-    while (_elapsed < 100000000) {
-        _loops *= 2;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
 
-    /* real benchmark, run for approx 1 second */
-    _loops = _loops * 1000000000 / _elapsed;
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
 
     _elapsed = 0;
     uint64_t _elapsed_min = UINT64_MAX;
@@ -639,7 +3044,7 @@ static void starch_benchmark_one_magnitude_sc16( starch_magnitude_sc16_regentry
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -669,27 +3074,27 @@ static void starch_benchmark_one_magnitude_sc16( starch_magnitude_sc16_regentry
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16";
+    starch_benchmark_results[starch_benchmark_result_count].name = "preamble_correlate_u16";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_sc16( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_run_preamble_correlate_u16( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 )
 {
-    for (starch_magnitude_sc16_regentry *_entry = starch_magnitude_sc16_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_sc16( _entry, arg0, arg1, arg2 );
+    for (starch_preamble_correlate_u16_regentry *_entry = starch_preamble_correlate_u16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_preamble_correlate_u16( _entry, arg0, arg1, arg2, arg3 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_sc16_aligned_benchmark (void);
-bool starch_magnitude_sc16_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_preamble_correlate_u16_aligned_benchmark (void);
+bool starch_preamble_correlate_u16_aligned_benchmark_verify ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_sc16_aligned_benchmark(void);
+void starch_preamble_correlate_u16_aligned_benchmark(void);
 
-static void starch_benchmark_one_magnitude_sc16_aligned( starch_magnitude_sc16_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_one_preamble_correlate_u16_aligned( starch_preamble_correlate_u16_aligned_regentry * _entry, const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -716,10 +3121,10 @@ static void starch_benchmark_one_magnitude_sc16_aligned( starch_magnitude_sc16_a
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2 );
+        _entry->callable ( arg0, arg1, arg2, arg3 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_sc16_aligned_benchmark_verify ( arg0, arg1, arg2 )) {
+    if (! starch_preamble_correlate_u16_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -729,21 +3134,23 @@ static void starch_benchmark_one_magnitude_sc16_aligned( starch_magnitude_sc16_a
         return;
     }
 
-    /* pre-benchmark, find a loop count that takes at least 100ms */
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
     starch_benchmark_time _start, _end;
     uint64_t _elapsed = 0;
-    uint64_t _loops = 127;
-    while (_elapsed < 100000000) {
-        _loops *= 2;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
 
-    /* real benchmark, run for approx 1 second */
-    _loops = _loops * 1000000000 / _elapsed;
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
 
     _elapsed = 0;
     uint64_t _elapsed_min = UINT64_MAX;
@@ -751,7 +3158,7 @@ static void starch_benchmark_one_magnitude_sc16_aligned( starch_magnitude_sc16_a
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -781,27 +3188,27 @@ static void starch_benchmark_one_magnitude_sc16_aligned( starch_magnitude_sc16_a
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].name = "preamble_correlate_u16_aligned";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_sc16_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_run_preamble_correlate_u16_aligned( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 )
 {
-    for (starch_magnitude_sc16_aligned_regentry *_entry = starch_magnitude_sc16_aligned_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_sc16_aligned( _entry, arg0, arg1, arg2 );
+    for (starch_preamble_correlate_u16_aligned_regentry *_entry = starch_preamble_correlate_u16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_preamble_correlate_u16_aligned( _entry, arg0, arg1, arg2, arg3 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_sc16q11_benchmark (void);
-bool starch_magnitude_sc16q11_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_preamble_scan_u16_benchmark (void);
+bool starch_preamble_scan_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_sc16q11_benchmark(void);
+void starch_preamble_scan_u16_benchmark(void);
 
-static void starch_benchmark_one_magnitude_sc16q11( starch_magnitude_sc16q11_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_one_preamble_scan_u16( starch_preamble_scan_u16_regentry * _entry, const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -828,10 +3235,10 @@ static void starch_benchmark_one_magnitude_sc16q11( starch_magnitude_sc16q11_reg
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2 );
+        _entry->callable ( arg0, arg1, arg2, arg3 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_sc16q11_benchmark_verify ( arg0, arg1, arg2 )) {
+    if (! starch_preamble_scan_u16_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -841,21 +3248,23 @@ static void starch_benchmark_one_magnitude_sc16q11( starch_magnitude_sc16q11_reg
         return;
     }
 
-    /* pre-benchmark, find a loop count that takes at least 100ms */
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
     starch_benchmark_time _start, _end;
     uint64_t _elapsed = 0;
-    uint64_t _loops = 127;
-    while (_elapsed < 100000000) {
-        _loops *= 2;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
 
-    /* real benchmark, run for approx 1 second */
-    _loops = _loops * 1000000000 / _elapsed;
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
 
     _elapsed = 0;
     uint64_t _elapsed_min = UINT64_MAX;
@@ -863,7 +3272,7 @@ static void starch_benchmark_one_magnitude_sc16q11( starch_magnitude_sc16q11_reg
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -893,27 +3302,27 @@ static void starch_benchmark_one_magnitude_sc16q11( starch_magnitude_sc16q11_reg
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16q11";
+    starch_benchmark_results[starch_benchmark_result_count].name = "preamble_scan_u16";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_sc16q11( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_run_preamble_scan_u16( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 )
 {
-    for (starch_magnitude_sc16q11_regentry *_entry = starch_magnitude_sc16q11_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_sc16q11( _entry, arg0, arg1, arg2 );
+    for (starch_preamble_scan_u16_regentry *_entry = starch_preamble_scan_u16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_preamble_scan_u16( _entry, arg0, arg1, arg2, arg3 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_sc16q11_aligned_benchmark (void);
-bool starch_magnitude_sc16q11_aligned_benchmark_verify ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_preamble_scan_u16_aligned_benchmark (void);
+bool starch_preamble_scan_u16_aligned_benchmark_verify ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_sc16q11_aligned_benchmark(void);
+void starch_preamble_scan_u16_aligned_benchmark(void);
 
-static void starch_benchmark_one_magnitude_sc16q11_aligned( starch_magnitude_sc16q11_aligned_regentry * _entry, const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_one_preamble_scan_u16_aligned( starch_preamble_scan_u16_aligned_regentry * _entry, const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -940,10 +3349,10 @@ static void starch_benchmark_one_magnitude_sc16q11_aligned( starch_magnitude_sc1
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2 );
+        _entry->callable ( arg0, arg1, arg2, arg3 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_sc16q11_aligned_benchmark_verify ( arg0, arg1, arg2 )) {
+    if (! starch_preamble_scan_u16_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -953,21 +3362,23 @@ static void starch_benchmark_one_magnitude_sc16q11_aligned( starch_magnitude_sc1
         return;
     }
 
-    /* pre-benchmark, find a loop count that takes at least 100ms */
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
     starch_benchmark_time _start, _end;
     uint64_t _elapsed = 0;
-    uint64_t _loops = 127;
-    while (_elapsed < 100000000) {
-        _loops *= 2;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
 
-    /* real benchmark, run for approx 1 second */
-    _loops = _loops * 1000000000 / _elapsed;
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
 
     _elapsed = 0;
     uint64_t _elapsed_min = UINT64_MAX;
@@ -975,7 +3386,7 @@ static void starch_benchmark_one_magnitude_sc16q11_aligned( starch_magnitude_sc1
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -1005,27 +3416,27 @@ static void starch_benchmark_one_magnitude_sc16q11_aligned( starch_magnitude_sc1
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_sc16q11_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].name = "preamble_scan_u16_aligned";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_sc16q11_aligned( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_run_preamble_scan_u16_aligned( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 )
 {
-    for (starch_magnitude_sc16q11_aligned_regentry *_entry = starch_magnitude_sc16q11_aligned_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_sc16q11_aligned( _entry, arg0, arg1, arg2 );
+    for (starch_preamble_scan_u16_aligned_regentry *_entry = starch_preamble_scan_u16_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_preamble_scan_u16_aligned( _entry, arg0, arg1, arg2, arg3 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_uc8_benchmark (void);
-bool starch_magnitude_uc8_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_preamble_scan_u8_benchmark (void);
+bool starch_preamble_scan_u8_benchmark_verify ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_uc8_benchmark(void);
+void starch_preamble_scan_u8_benchmark(void);
 
-static void starch_benchmark_one_magnitude_uc8( starch_magnitude_uc8_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_one_preamble_scan_u8( starch_preamble_scan_u8_regentry * _entry, const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -1052,10 +3463,10 @@ static void starch_benchmark_one_magnitude_uc8( starch_magnitude_uc8_regentry *
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2 );
+        _entry->callable ( arg0, arg1, arg2, arg3 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_uc8_benchmark_verify ( arg0, arg1, arg2 )) {
+    if (! starch_preamble_scan_u8_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -1065,21 +3476,23 @@ static void starch_benchmark_one_magnitude_uc8( starch_magnitude_uc8_regentry *
         return;
     }
 
-    /* pre-benchmark, find a loop count that takes at least 100ms */
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
     starch_benchmark_time _start, _end;
     uint64_t _elapsed = 0;
-    uint64_t _loops = 127;
-    while (_elapsed < 100000000) {
-        _loops *= 2;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
 
-    /* real benchmark, run for approx 1 second */
-    _loops = _loops * 1000000000 / _elapsed;
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
 
     _elapsed = 0;
     uint64_t _elapsed_min = UINT64_MAX;
@@ -1087,7 +3500,7 @@ static void starch_benchmark_one_magnitude_uc8( starch_magnitude_uc8_regentry *
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -1117,27 +3530,27 @@ static void starch_benchmark_one_magnitude_uc8( starch_magnitude_uc8_regentry *
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_uc8";
+    starch_benchmark_results[starch_benchmark_result_count].name = "preamble_scan_u8";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_uc8( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_run_preamble_scan_u8( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 )
 {
-    for (starch_magnitude_uc8_regentry *_entry = starch_magnitude_uc8_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_uc8( _entry, arg0, arg1, arg2 );
+    for (starch_preamble_scan_u8_regentry *_entry = starch_preamble_scan_u8_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_preamble_scan_u8( _entry, arg0, arg1, arg2, arg3 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_magnitude_uc8_aligned_benchmark (void);
-bool starch_magnitude_uc8_aligned_benchmark_verify ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_preamble_scan_u8_aligned_benchmark (void);
+bool starch_preamble_scan_u8_aligned_benchmark_verify ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_magnitude_uc8_aligned_benchmark(void);
+void starch_preamble_scan_u8_aligned_benchmark(void);
 
-static void starch_benchmark_one_magnitude_uc8_aligned( starch_magnitude_uc8_aligned_regentry * _entry, const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_one_preamble_scan_u8_aligned( starch_preamble_scan_u8_aligned_regentry * _entry, const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -1164,10 +3577,10 @@ static void starch_benchmark_one_magnitude_uc8_aligned( starch_magnitude_uc8_ali
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2 );
+        _entry->callable ( arg0, arg1, arg2, arg3 );
 
     /* verify correctness of the output */
-    if (! starch_magnitude_uc8_aligned_benchmark_verify ( arg0, arg1, arg2 )) {
+    if (! starch_preamble_scan_u8_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -1177,21 +3590,23 @@ static void starch_benchmark_one_magnitude_uc8_aligned( starch_magnitude_uc8_ali
         return;
     }
 
-    /* pre-benchmark, find a loop count that takes at least 100ms */
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
     starch_benchmark_time _start, _end;
     uint64_t _elapsed = 0;
-    uint64_t _loops = 127;
-    while (_elapsed < 100000000) {
-        _loops *= 2;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
 
-    /* real benchmark, run for approx 1 second */
-    _loops = _loops * 1000000000 / _elapsed;
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
 
     _elapsed = 0;
     uint64_t _elapsed_min = UINT64_MAX;
@@ -1199,7 +3614,7 @@ static void starch_benchmark_one_magnitude_uc8_aligned( starch_magnitude_uc8_ali
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2 );
+            _entry->callable ( arg0, arg1, arg2, arg3 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -1229,27 +3644,27 @@ static void starch_benchmark_one_magnitude_uc8_aligned( starch_magnitude_uc8_ali
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "magnitude_uc8_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].name = "preamble_scan_u8_aligned";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_magnitude_uc8_aligned( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 )
+static void starch_benchmark_run_preamble_scan_u8_aligned( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 )
 {
-    for (starch_magnitude_uc8_aligned_regentry *_entry = starch_magnitude_uc8_aligned_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_magnitude_uc8_aligned( _entry, arg0, arg1, arg2 );
+    for (starch_preamble_scan_u8_aligned_regentry *_entry = starch_preamble_scan_u8_aligned_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_preamble_scan_u8_aligned( _entry, arg0, arg1, arg2, arg3 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_mean_power_u16_benchmark (void);
-bool starch_mean_power_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_resample_polyphase_u16_benchmark (void);
+bool starch_resample_polyphase_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_mean_power_u16_benchmark(void);
+void starch_resample_polyphase_u16_benchmark(void);
 
-static void starch_benchmark_one_mean_power_u16( starch_mean_power_u16_regentry * _entry, const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
+static void starch_benchmark_one_resample_polyphase_u16( starch_resample_polyphase_u16_regentry * _entry, const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -1276,10 +3691,10 @@ static void starch_benchmark_one_mean_power_u16( starch_mean_power_u16_regentry
 
     /* initial warmup */
     for (unsigned _loop = 0; _loop < starch_benchmark_warmup_loops; ++_loop)
-        _entry->callable ( arg0, arg1, arg2, arg3 );
+        _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7 );
 
     /* verify correctness of the output */
-    if (! starch_mean_power_u16_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+    if (! starch_resample_polyphase_u16_benchmark_verify ( arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -1289,21 +3704,23 @@ static void starch_benchmark_one_mean_power_u16( starch_mean_power_u16_regentry
         return;
     }
 
-    /* pre-benchmark, find a loop count that takes at least 100ms */
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
     starch_benchmark_time _start, _end;
     uint64_t _elapsed = 0;
-    uint64_t _loops = 127;
-    while (_elapsed < 100000000) {
-        _loops *= 2;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2, arg3 );
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7 );
         starch_benchmark_get_time(&_end);
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
 
-    /* real benchmark, run for approx 1 second */
-    _loops = _loops * 1000000000 / _elapsed;
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
 
     _elapsed = 0;
     uint64_t _elapsed_min = UINT64_MAX;
@@ -1311,7 +3728,7 @@ static void starch_benchmark_one_mean_power_u16( starch_mean_power_u16_regentry
     for (unsigned _iter = 0; _iter < starch_benchmark_iterations; ++_iter) {
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
-            _entry->callable ( arg0, arg1, arg2, arg3 );
+            _entry->callable ( arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7 );
         starch_benchmark_get_time(&_end);
         uint64_t _elapsed_one = starch_benchmark_elapsed(&_start, &_end);
         if (_elapsed_one < _elapsed_min)
@@ -1341,27 +3758,27 @@ static void starch_benchmark_one_mean_power_u16( starch_mean_power_u16_regentry
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "mean_power_u16";
+    starch_benchmark_results[starch_benchmark_result_count].name = "resample_polyphase_u16";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_mean_power_u16( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
+static void starch_benchmark_run_resample_polyphase_u16( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 )
 {
-    for (starch_mean_power_u16_regentry *_entry = starch_mean_power_u16_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_mean_power_u16( _entry, arg0, arg1, arg2, arg3 );
+    for (starch_resample_polyphase_u16_regentry *_entry = starch_resample_polyphase_u16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_resample_polyphase_u16( _entry, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7 );
     }
 }
 
 /* prototypes for benchmark helpers provided by user code */
-void starch_mean_power_u16_aligned_benchmark (void);
-bool starch_mean_power_u16_aligned_benchmark_verify ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_slice_phases_u16_benchmark (void);
+bool starch_slice_phases_u16_benchmark_verify ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
 
 /* prototype the benchmarking function so that we can build with -Wmissing-declarations */
-void starch_mean_power_u16_aligned_benchmark(void);
+void starch_slice_phases_u16_benchmark(void);
 
-static void starch_benchmark_one_mean_power_u16_aligned( starch_mean_power_u16_aligned_regentry * _entry, const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
+static void starch_benchmark_one_slice_phases_u16( starch_slice_phases_u16_regentry * _entry, const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 )
 {
     fprintf(stderr, "  %-40s  ", _entry->name);
 
@@ -1391,7 +3808,7 @@ static void starch_benchmark_one_mean_power_u16_aligned( starch_mean_power_u16_a
         _entry->callable ( arg0, arg1, arg2, arg3 );
 
     /* verify correctness of the output */
-    if (! starch_mean_power_u16_aligned_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
+    if (! starch_slice_phases_u16_benchmark_verify ( arg0, arg1, arg2, arg3 )) {
         fprintf(stderr, "skipped (verification failed)\n");
         starch_benchmark_validation_failed = true;
         return;
@@ -1401,12 +3818,12 @@ static void starch_benchmark_one_mean_power_u16_aligned( starch_mean_power_u16_a
         return;
     }
 
-    /* pre-benchmark, find a loop count that takes at least 100ms */
+    /* pre-benchmark, find a loop count that takes at least 1/10 of the target time */
     starch_benchmark_time _start, _end;
     uint64_t _elapsed = 0;
-    uint64_t _loops = 127;
-    while (_elapsed < 100000000) {
-        _loops *= 2;
+    uint64_t _loops = 0;
+    while (_elapsed < starch_benchmark_target_ns / 10) {
+        _loops = (_loops ? _loops * 2 : 1);
         starch_benchmark_get_time(&_start);
         for (uint64_t _loop = 0; _loop < _loops; ++_loop)
             _entry->callable ( arg0, arg1, arg2, arg3 );
@@ -1414,8 +3831,10 @@ static void starch_benchmark_one_mean_power_u16_aligned( starch_mean_power_u16_a
         _elapsed = starch_benchmark_elapsed(&_start, &_end);
     }
 
-    /* real benchmark, run for approx 1 second */
-    _loops = _loops * 1000000000 / _elapsed;
+    /* real benchmark, run for approx the target time */
+    _loops = _loops * starch_benchmark_target_ns / _elapsed;
+    if (!_loops)
+        _loops = 1;
 
     _elapsed = 0;
     uint64_t _elapsed_min = UINT64_MAX;
@@ -1453,16 +3872,16 @@ static void starch_benchmark_one_mean_power_u16_aligned( starch_mean_power_u16_a
         }
     }
 
-    starch_benchmark_results[starch_benchmark_result_count].name = "mean_power_u16_aligned";
+    starch_benchmark_results[starch_benchmark_result_count].name = "slice_phases_u16";
     starch_benchmark_results[starch_benchmark_result_count].impl = _entry->name;
     starch_benchmark_results[starch_benchmark_result_count].ns = _per_loop;
     ++starch_benchmark_result_count;
 }
 
-static void starch_benchmark_run_mean_power_u16_aligned( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 )
+static void starch_benchmark_run_slice_phases_u16( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 )
 {
-    for (starch_mean_power_u16_aligned_regentry *_entry = starch_mean_power_u16_aligned_registry; _entry->name; ++_entry) {
-        starch_benchmark_one_mean_power_u16_aligned( _entry, arg0, arg1, arg2, arg3 );
+    for (starch_slice_phases_u16_regentry *_entry = starch_slice_phases_u16_registry; _entry->name; ++_entry) {
+        starch_benchmark_one_slice_phases_u16( _entry, arg0, arg1, arg2, arg3 );
     }
 }
 
@@ -1481,11 +3900,23 @@ static void starch_benchmark_run_mean_power_u16_aligned( const uint16_t * arg0,
 #define STARCH_BENCHMARK_FREE(_ptr) starch_benchmark_aligned_free(_ptr)
 
 #include "../benchmark/count_above_u16_benchmark.c"
+#include "../benchmark/log_histogram_u16_benchmark.c"
+#include "../benchmark/magnitude_dc_sc16_benchmark.c"
+#include "../benchmark/magnitude_dc_sc16q11_benchmark.c"
+#include "../benchmark/magnitude_dc_uc8_benchmark.c"
+#include "../benchmark/magnitude_power_sc16_benchmark.c"
+#include "../benchmark/magnitude_power_sc16q11_benchmark.c"
 #include "../benchmark/magnitude_power_uc8_benchmark.c"
+#include "../benchmark/magnitude_power_uc8_u8_benchmark.c"
 #include "../benchmark/magnitude_sc16_benchmark.c"
 #include "../benchmark/magnitude_sc16q11_benchmark.c"
 #include "../benchmark/magnitude_uc8_benchmark.c"
 #include "../benchmark/mean_power_u16_benchmark.c"
+#include "../benchmark/preamble_correlate_u16_benchmark.c"
+#include "../benchmark/preamble_scan_u16_benchmark.c"
+#include "../benchmark/preamble_scan_u8_benchmark.c"
+#include "../benchmark/resample_polyphase_u16_benchmark.c"
+#include "../benchmark/slice_phases_u16_benchmark.c"
 
 #undef STARCH_ALIGNMENT
 #undef STARCH_ALIGNED
@@ -1510,11 +3941,20 @@ static void starch_benchmark_run_mean_power_u16_aligned( const uint16_t * arg0,
 #define STARCH_BENCHMARK_FREE(_ptr) starch_benchmark_aligned_free(_ptr)
 
 #include "../benchmark/count_above_u16_benchmark.c"
+#include "../benchmark/magnitude_dc_sc16_benchmark.c"
+#include "../benchmark/magnitude_dc_sc16q11_benchmark.c"
+#include "../benchmark/magnitude_dc_uc8_benchmark.c"
+#include "../benchmark/magnitude_power_sc16_benchmark.c"
+#include "../benchmark/magnitude_power_sc16q11_benchmark.c"
 #include "../benchmark/magnitude_power_uc8_benchmark.c"
+#include "../benchmark/magnitude_power_uc8_u8_benchmark.c"
 #include "../benchmark/magnitude_sc16_benchmark.c"
 #include "../benchmark/magnitude_sc16q11_benchmark.c"
 #include "../benchmark/magnitude_uc8_benchmark.c"
 #include "../benchmark/mean_power_u16_benchmark.c"
+#include "../benchmark/preamble_correlate_u16_benchmark.c"
+#include "../benchmark/preamble_scan_u16_benchmark.c"
+#include "../benchmark/preamble_scan_u8_benchmark.c"
 
 static void starch_benchmark_all_count_above_u16(void)
 {
@@ -1526,6 +3966,61 @@ static void starch_benchmark_all_count_above_u16_aligned(void)
     fprintf(stderr, "==== count_above_u16_aligned ===\n");
     starch_count_above_u16_aligned_benchmark ();
 }
+static void starch_benchmark_all_log_histogram_u16(void)
+{
+    fprintf(stderr, "==== log_histogram_u16 ===\n");
+    starch_log_histogram_u16_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_sc16(void)
+{
+    fprintf(stderr, "==== magnitude_dc_sc16 ===\n");
+    starch_magnitude_dc_sc16_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_sc16_aligned(void)
+{
+    fprintf(stderr, "==== magnitude_dc_sc16_aligned ===\n");
+    starch_magnitude_dc_sc16_aligned_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_sc16q11(void)
+{
+    fprintf(stderr, "==== magnitude_dc_sc16q11 ===\n");
+    starch_magnitude_dc_sc16q11_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_sc16q11_aligned(void)
+{
+    fprintf(stderr, "==== magnitude_dc_sc16q11_aligned ===\n");
+    starch_magnitude_dc_sc16q11_aligned_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_uc8(void)
+{
+    fprintf(stderr, "==== magnitude_dc_uc8 ===\n");
+    starch_magnitude_dc_uc8_benchmark ();
+}
+static void starch_benchmark_all_magnitude_dc_uc8_aligned(void)
+{
+    fprintf(stderr, "==== magnitude_dc_uc8_aligned ===\n");
+    starch_magnitude_dc_uc8_aligned_benchmark ();
+}
+static void starch_benchmark_all_magnitude_power_sc16(void)
+{
+    fprintf(stderr, "==== magnitude_power_sc16 ===\n");
+    starch_magnitude_power_sc16_benchmark ();
+}
+static void starch_benchmark_all_magnitude_power_sc16_aligned(void)
+{
+    fprintf(stderr, "==== magnitude_power_sc16_aligned ===\n");
+    starch_magnitude_power_sc16_aligned_benchmark ();
+}
+static void starch_benchmark_all_magnitude_power_sc16q11(void)
+{
+    fprintf(stderr, "==== magnitude_power_sc16q11 ===\n");
+    starch_magnitude_power_sc16q11_benchmark ();
+}
+static void starch_benchmark_all_magnitude_power_sc16q11_aligned(void)
+{
+    fprintf(stderr, "==== magnitude_power_sc16q11_aligned ===\n");
+    starch_magnitude_power_sc16q11_aligned_benchmark ();
+}
 static void starch_benchmark_all_magnitude_power_uc8(void)
 {
     fprintf(stderr, "==== magnitude_power_uc8 ===\n");
@@ -1536,6 +4031,16 @@ static void starch_benchmark_all_magnitude_power_uc8_aligned(void)
     fprintf(stderr, "==== magnitude_power_uc8_aligned ===\n");
     starch_magnitude_power_uc8_aligned_benchmark ();
 }
+static void starch_benchmark_all_magnitude_power_uc8_u8(void)
+{
+    fprintf(stderr, "==== magnitude_power_uc8_u8 ===\n");
+    starch_magnitude_power_uc8_u8_benchmark ();
+}
+static void starch_benchmark_all_magnitude_power_uc8_u8_aligned(void)
+{
+    fprintf(stderr, "==== magnitude_power_uc8_u8_aligned ===\n");
+    starch_magnitude_power_uc8_u8_aligned_benchmark ();
+}
 static void starch_benchmark_all_magnitude_sc16(void)
 {
     fprintf(stderr, "==== magnitude_sc16 ===\n");
@@ -1576,6 +4081,46 @@ static void starch_benchmark_all_mean_power_u16_aligned(void)
     fprintf(stderr, "==== mean_power_u16_aligned ===\n");
     starch_mean_power_u16_aligned_benchmark ();
 }
+static void starch_benchmark_all_preamble_correlate_u16(void)
+{
+    fprintf(stderr, "==== preamble_correlate_u16 ===\n");
+    starch_preamble_correlate_u16_benchmark ();
+}
+static void starch_benchmark_all_preamble_correlate_u16_aligned(void)
+{
+    fprintf(stderr, "==== preamble_correlate_u16_aligned ===\n");
+    starch_preamble_correlate_u16_aligned_benchmark ();
+}
+static void starch_benchmark_all_preamble_scan_u16(void)
+{
+    fprintf(stderr, "==== preamble_scan_u16 ===\n");
+    starch_preamble_scan_u16_benchmark ();
+}
+static void starch_benchmark_all_preamble_scan_u16_aligned(void)
+{
+    fprintf(stderr, "==== preamble_scan_u16_aligned ===\n");
+    starch_preamble_scan_u16_aligned_benchmark ();
+}
+static void starch_benchmark_all_preamble_scan_u8(void)
+{
+    fprintf(stderr, "==== preamble_scan_u8 ===\n");
+    starch_preamble_scan_u8_benchmark ();
+}
+static void starch_benchmark_all_preamble_scan_u8_aligned(void)
+{
+    fprintf(stderr, "==== preamble_scan_u8_aligned ===\n");
+    starch_preamble_scan_u8_aligned_benchmark ();
+}
+static void starch_benchmark_all_resample_polyphase_u16(void)
+{
+    fprintf(stderr, "==== resample_polyphase_u16 ===\n");
+    starch_resample_polyphase_u16_benchmark ();
+}
+static void starch_benchmark_all_slice_phases_u16(void)
+{
+    fprintf(stderr, "==== slice_phases_u16 ===\n");
+    starch_slice_phases_u16_benchmark ();
+}
 
 static int starch_benchmark_compare_result(const void *a, const void *b)
 {
@@ -1611,6 +4156,8 @@ static void starch_benchmark_usage(const char *argv0)
         "  -i ITERS         Run benchmark ITERS times and use the mean. If ITERS > 2, ignore\n"
         "                   the smallest and largest runs when calculating the mean.\n"
         "                     (default: 1 iteration)\n"
+        "  -T MILLIS        Run each benchmark iteration for approximately MILLIS ms\n"
+        "                     (default: 1000ms)\n"
         "  FUNCTION         Run benchmarks for these functions only\n"
         "                     (default: benchmark all functions)\n"
         "\n"
@@ -1631,8 +4178,21 @@ static void starch_benchmark_usage(const char *argv0)
         "Supported functions: "
           "count_above_u16 "
           "count_above_u16_aligned "
+          "log_histogram_u16 "
+          "magnitude_dc_sc16 "
+          "magnitude_dc_sc16_aligned "
+          "magnitude_dc_sc16q11 "
+          "magnitude_dc_sc16q11_aligned "
+          "magnitude_dc_uc8 "
+          "magnitude_dc_uc8_aligned "
+          "magnitude_power_sc16 "
+          "magnitude_power_sc16_aligned "
+          "magnitude_power_sc16q11 "
+          "magnitude_power_sc16q11_aligned "
           "magnitude_power_uc8 "
           "magnitude_power_uc8_aligned "
+          "magnitude_power_uc8_u8 "
+          "magnitude_power_uc8_u8_aligned "
           "magnitude_sc16 "
           "magnitude_sc16_aligned "
           "magnitude_sc16q11 "
@@ -1641,6 +4201,14 @@ static void starch_benchmark_usage(const char *argv0)
           "magnitude_uc8_aligned "
           "mean_power_u16 "
           "mean_power_u16_aligned "
+          "preamble_correlate_u16 "
+          "preamble_correlate_u16_aligned "
+          "preamble_scan_u16 "
+          "preamble_scan_u16_aligned "
+          "preamble_scan_u8 "
+          "preamble_scan_u8_aligned "
+          "resample_polyphase_u16 "
+          "slice_phases_u16 "
           "\n", argv0);
 }
 
@@ -1657,13 +4225,18 @@ static void starch_benchmark_append_flavor(const char *flavor, starch_benchmark_
     *list = newnode;
 }
 
+#ifdef STARCH_BENCHMARK_NO_MAIN
+/* built as a library; the including app calls this directly */
+int starch_benchmark_main (int argc, char **argv)
+#else
 int main(int argc, char **argv)
+#endif
 {
     int specific = 0;
     const char *output_path = NULL;
 
     int opt;
-    while ((opt = getopt(argc, argv, "r:o:F:N:i:lhtV")) != -1) {
+    while ((opt = getopt(argc, argv, "r:o:F:N:i:T:lhtV")) != -1) {
         switch (opt) {
         case 'r':
             if (starch_read_wisdom(optarg) < 0) {
@@ -1705,6 +4278,12 @@ int main(int argc, char **argv)
             starch_benchmark_iterations = atoi(optarg);
             break;
 
+        case 'T':
+            starch_benchmark_target_ns = strtoull(optarg, NULL, 10) * 1000000;
+            if (!starch_benchmark_target_ns)
+                starch_benchmark_target_ns = 1000000;
+            break;
+
         case 'V':
             starch_benchmark_validate_only = true;
             break;
@@ -1736,6 +4315,61 @@ int main(int argc, char **argv)
             starch_benchmark_all_count_above_u16_aligned();
             continue;
         }
+        if (!strcmp(argv[i], "log_histogram_u16")) {
+            specific = 1;
+            starch_benchmark_all_log_histogram_u16();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_sc16")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_sc16();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_sc16_aligned")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_sc16_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_sc16q11")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_sc16q11();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_sc16q11_aligned")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_sc16q11_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_uc8")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_uc8();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_dc_uc8_aligned")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_dc_uc8_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_power_sc16")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_power_sc16();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_power_sc16_aligned")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_power_sc16_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_power_sc16q11")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_power_sc16q11();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_power_sc16q11_aligned")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_power_sc16q11_aligned();
+            continue;
+        }
         if (!strcmp(argv[i], "magnitude_power_uc8")) {
             specific = 1;
             starch_benchmark_all_magnitude_power_uc8();
@@ -1746,6 +4380,16 @@ int main(int argc, char **argv)
             starch_benchmark_all_magnitude_power_uc8_aligned();
             continue;
         }
+        if (!strcmp(argv[i], "magnitude_power_uc8_u8")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_power_uc8_u8();
+            continue;
+        }
+        if (!strcmp(argv[i], "magnitude_power_uc8_u8_aligned")) {
+            specific = 1;
+            starch_benchmark_all_magnitude_power_uc8_u8_aligned();
+            continue;
+        }
         if (!strcmp(argv[i], "magnitude_sc16")) {
             specific = 1;
             starch_benchmark_all_magnitude_sc16();
@@ -1786,6 +4430,46 @@ int main(int argc, char **argv)
             starch_benchmark_all_mean_power_u16_aligned();
             continue;
         }
+        if (!strcmp(argv[i], "preamble_correlate_u16")) {
+            specific = 1;
+            starch_benchmark_all_preamble_correlate_u16();
+            continue;
+        }
+        if (!strcmp(argv[i], "preamble_correlate_u16_aligned")) {
+            specific = 1;
+            starch_benchmark_all_preamble_correlate_u16_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "preamble_scan_u16")) {
+            specific = 1;
+            starch_benchmark_all_preamble_scan_u16();
+            continue;
+        }
+        if (!strcmp(argv[i], "preamble_scan_u16_aligned")) {
+            specific = 1;
+            starch_benchmark_all_preamble_scan_u16_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "preamble_scan_u8")) {
+            specific = 1;
+            starch_benchmark_all_preamble_scan_u8();
+            continue;
+        }
+        if (!strcmp(argv[i], "preamble_scan_u8_aligned")) {
+            specific = 1;
+            starch_benchmark_all_preamble_scan_u8_aligned();
+            continue;
+        }
+        if (!strcmp(argv[i], "resample_polyphase_u16")) {
+            specific = 1;
+            starch_benchmark_all_resample_polyphase_u16();
+            continue;
+        }
+        if (!strcmp(argv[i], "slice_phases_u16")) {
+            specific = 1;
+            starch_benchmark_all_slice_phases_u16();
+            continue;
+        }
 
         fprintf(stderr, "%s: unrecognized function name: %s\n", argv[0], argv[i]);
         return 2;
@@ -1794,8 +4478,21 @@ int main(int argc, char **argv)
     if (!specific) {
         starch_benchmark_all_count_above_u16();
         starch_benchmark_all_count_above_u16_aligned();
+        starch_benchmark_all_log_histogram_u16();
+        starch_benchmark_all_magnitude_dc_sc16();
+        starch_benchmark_all_magnitude_dc_sc16_aligned();
+        starch_benchmark_all_magnitude_dc_sc16q11();
+        starch_benchmark_all_magnitude_dc_sc16q11_aligned();
+        starch_benchmark_all_magnitude_dc_uc8();
+        starch_benchmark_all_magnitude_dc_uc8_aligned();
+        starch_benchmark_all_magnitude_power_sc16();
+        starch_benchmark_all_magnitude_power_sc16_aligned();
+        starch_benchmark_all_magnitude_power_sc16q11();
+        starch_benchmark_all_magnitude_power_sc16q11_aligned();
         starch_benchmark_all_magnitude_power_uc8();
         starch_benchmark_all_magnitude_power_uc8_aligned();
+        starch_benchmark_all_magnitude_power_uc8_u8();
+        starch_benchmark_all_magnitude_power_uc8_u8_aligned();
         starch_benchmark_all_magnitude_sc16();
         starch_benchmark_all_magnitude_sc16_aligned();
         starch_benchmark_all_magnitude_sc16q11();
@@ -1804,6 +4501,14 @@ int main(int argc, char **argv)
         starch_benchmark_all_magnitude_uc8_aligned();
         starch_benchmark_all_mean_power_u16();
         starch_benchmark_all_mean_power_u16_aligned();
+        starch_benchmark_all_preamble_correlate_u16();
+        starch_benchmark_all_preamble_correlate_u16_aligned();
+        starch_benchmark_all_preamble_scan_u16();
+        starch_benchmark_all_preamble_scan_u16_aligned();
+        starch_benchmark_all_preamble_scan_u8();
+        starch_benchmark_all_preamble_scan_u8_aligned();
+        starch_benchmark_all_resample_polyphase_u16();
+        starch_benchmark_all_slice_phases_u16();
     }
 
     if (output_path) {
@@ -178,10 +178,10 @@ starch_count_above_u16_aligned_regentry starch_count_above_u16_aligned_registry[
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_power_uc8 */
+/* dispatcher / registry for log_histogram_u16 */
 
-starch_magnitude_power_uc8_regentry * starch_magnitude_power_uc8_select() {
-    for (starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_registry;
+starch_log_histogram_u16_regentry * starch_log_histogram_u16_select() {
+    for (starch_log_histogram_u16_regentry *entry = starch_log_histogram_u16_registry;
          entry->name;
          ++entry)
     {
@@ -192,22 +192,22 @@ starch_magnitude_power_uc8_regentry * starch_magnitude_power_uc8_select() {
     return NULL;
 }
 
-static void starch_magnitude_power_uc8_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
-    starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_select();
+static void starch_log_histogram_u16_dispatch ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 ) {
+    starch_log_histogram_u16_regentry *entry = starch_log_histogram_u16_select();
     if (!entry)
         abort();
 
-    starch_magnitude_power_uc8 = entry->callable;
-    starch_magnitude_power_uc8 ( arg0, arg1, arg2, arg3, arg4 );
+    starch_log_histogram_u16 = entry->callable;
+    starch_log_histogram_u16 ( arg0, arg1, arg2 );
 }
 
-starch_magnitude_power_uc8_ptr starch_magnitude_power_uc8 = starch_magnitude_power_uc8_dispatch;
+starch_log_histogram_u16_ptr starch_log_histogram_u16 = starch_log_histogram_u16_dispatch;
 
-void starch_magnitude_power_uc8_set_wisdom (const char * const * received_wisdom)
+void starch_log_histogram_u16_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_power_uc8_regentry *entry;
-    for (entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
+    starch_log_histogram_u16_regentry *entry;
+    for (entry = starch_log_histogram_u16_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -219,60 +219,58 @@ void starch_magnitude_power_uc8_set_wisdom (const char * const * received_wisdom
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_uc8_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_log_histogram_u16_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_power_uc8_registry, entry - starch_magnitude_power_uc8_registry, sizeof(starch_magnitude_power_uc8_regentry), starch_regentry_rank_compare);
+    qsort(starch_log_histogram_u16_registry, entry - starch_log_histogram_u16_registry, sizeof(starch_log_histogram_u16_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_power_uc8 = starch_magnitude_power_uc8_dispatch;
+    starch_log_histogram_u16 = starch_log_histogram_u16_dispatch;
 }
 
-starch_magnitude_power_uc8_regentry starch_magnitude_power_uc8_registry[] = {
+starch_log_histogram_u16_regentry starch_log_histogram_u16_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 6, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 0, "float_bits_lanes_armv8_neon_simd", "armv8_neon_simd", starch_log_histogram_u16_float_bits_lanes_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "clz_lanes_generic", "generic", starch_log_histogram_u16_clz_lanes_generic, NULL },
+    { 2, "clz_armv8_neon_simd", "armv8_neon_simd", starch_log_histogram_u16_clz_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "clz_lanes_armv8_neon_simd", "armv8_neon_simd", starch_log_histogram_u16_clz_lanes_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "clz_generic", "generic", starch_log_histogram_u16_clz_generic, NULL },
+    { 5, "float_bits_lanes_generic", "generic", starch_log_histogram_u16_float_bits_lanes_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 6, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 0, "float_bits_lanes_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_log_histogram_u16_float_bits_lanes_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "clz_lanes_generic", "generic", starch_log_histogram_u16_clz_lanes_generic, NULL },
+    { 2, "clz_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_log_histogram_u16_clz_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "clz_lanes_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_log_histogram_u16_clz_lanes_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "clz_generic", "generic", starch_log_histogram_u16_clz_generic, NULL },
+    { 5, "float_bits_lanes_generic", "generic", starch_log_histogram_u16_float_bits_lanes_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 1, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
-    { 2, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 0, "float_bits_lanes_generic", "generic", starch_log_histogram_u16_float_bits_lanes_generic, NULL },
+    { 1, "clz_generic", "generic", starch_log_histogram_u16_clz_generic, NULL },
+    { 2, "clz_lanes_generic", "generic", starch_log_histogram_u16_clz_lanes_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_twopass_x86_avx2, cpu_supports_avx2 },
-    { 1, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 2, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_x86_avx2, cpu_supports_avx2 },
-    { 3, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 4, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
-    { 5, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 0, "float_bits_lanes_x86_avx2", "x86_avx2", starch_log_histogram_u16_float_bits_lanes_x86_avx2, cpu_supports_avx2 },
+    { 1, "float_bits_lanes_generic", "generic", starch_log_histogram_u16_float_bits_lanes_generic, NULL },
+    { 2, "clz_x86_avx2", "x86_avx2", starch_log_histogram_u16_clz_x86_avx2, cpu_supports_avx2 },
+    { 3, "clz_lanes_x86_avx2", "x86_avx2", starch_log_histogram_u16_clz_lanes_x86_avx2, cpu_supports_avx2 },
+    { 4, "clz_generic", "generic", starch_log_histogram_u16_clz_generic, NULL },
+    { 5, "clz_lanes_generic", "generic", starch_log_histogram_u16_clz_lanes_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_power_uc8_aligned */
+/* dispatcher / registry for magnitude_dc_sc16 */
 
-starch_magnitude_power_uc8_aligned_regentry * starch_magnitude_power_uc8_aligned_select() {
-    for (starch_magnitude_power_uc8_aligned_regentry *entry = starch_magnitude_power_uc8_aligned_registry;
+starch_magnitude_dc_sc16_regentry * starch_magnitude_dc_sc16_select() {
+    for (starch_magnitude_dc_sc16_regentry *entry = starch_magnitude_dc_sc16_registry;
          entry->name;
          ++entry)
     {
@@ -283,22 +281,22 @@ starch_magnitude_power_uc8_aligned_regentry * starch_magnitude_power_uc8_aligned
     return NULL;
 }
 
-static void starch_magnitude_power_uc8_aligned_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
-    starch_magnitude_power_uc8_aligned_regentry *entry = starch_magnitude_power_uc8_aligned_select();
+static void starch_magnitude_dc_sc16_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 ) {
+    starch_magnitude_dc_sc16_regentry *entry = starch_magnitude_dc_sc16_select();
     if (!entry)
         abort();
 
-    starch_magnitude_power_uc8_aligned = entry->callable;
-    starch_magnitude_power_uc8_aligned ( arg0, arg1, arg2, arg3, arg4 );
+    starch_magnitude_dc_sc16 = entry->callable;
+    starch_magnitude_dc_sc16 ( arg0, arg1, arg2, arg3 );
 }
 
-starch_magnitude_power_uc8_aligned_ptr starch_magnitude_power_uc8_aligned = starch_magnitude_power_uc8_aligned_dispatch;
+starch_magnitude_dc_sc16_ptr starch_magnitude_dc_sc16 = starch_magnitude_dc_sc16_dispatch;
 
-void starch_magnitude_power_uc8_aligned_set_wisdom (const char * const * received_wisdom)
+void starch_magnitude_dc_sc16_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_power_uc8_aligned_regentry *entry;
-    for (entry = starch_magnitude_power_uc8_aligned_registry; entry->name; ++entry) {
+    starch_magnitude_dc_sc16_regentry *entry;
+    for (entry = starch_magnitude_dc_sc16_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -310,71 +308,53 @@ void starch_magnitude_power_uc8_aligned_set_wisdom (const char * const * receive
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_uc8_aligned_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_sc16_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_power_uc8_aligned_registry, entry - starch_magnitude_power_uc8_aligned_registry, sizeof(starch_magnitude_power_uc8_aligned_regentry), starch_regentry_rank_compare);
+    qsort(starch_magnitude_dc_sc16_registry, entry - starch_magnitude_dc_sc16_registry, sizeof(starch_magnitude_dc_sc16_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_power_uc8_aligned = starch_magnitude_power_uc8_aligned_dispatch;
+    starch_magnitude_dc_sc16 = starch_magnitude_dc_sc16_dispatch;
 }
 
-starch_magnitude_power_uc8_aligned_regentry starch_magnitude_power_uc8_aligned_registry[] = {
+starch_magnitude_dc_sc16_regentry starch_magnitude_dc_sc16_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "twopass_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "lookup_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "lookup_unroll_4_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 6, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 7, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 8, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 9, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 10, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16_exact_float_s32_generic, NULL },
+    { 2, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_s32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16_exact_float_s32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "exact_float_generic", "generic", starch_magnitude_dc_sc16_exact_float_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "twopass_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "lookup_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "lookup_unroll_4_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 6, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 7, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 8, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 9, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 10, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16_exact_float_s32_generic, NULL },
+    { 2, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_s32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_exact_float_s32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_float_generic", "generic", starch_magnitude_dc_sc16_exact_float_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 1, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
-    { 2, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 0, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16_exact_float_s32_generic, NULL },
+    { 1, "exact_float_generic", "generic", starch_magnitude_dc_sc16_exact_float_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "twopass_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_twopass_x86_avx2, cpu_supports_avx2 },
-    { 1, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
-    { 2, "lookup_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_lookup_x86_avx2, cpu_supports_avx2 },
-    { 3, "lookup_unroll_4_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 4, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_twopass_x86_avx2, cpu_supports_avx2 },
-    { 5, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_x86_avx2, cpu_supports_avx2 },
-    { 6, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 7, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
-    { 8, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 0, "exact_float_s32_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16_exact_float_s32_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16_exact_float_s32_generic, NULL },
+    { 2, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 3, "exact_float_generic", "generic", starch_magnitude_dc_sc16_exact_float_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_sc16 */
+/* dispatcher / registry for magnitude_dc_sc16_aligned */
 
-starch_magnitude_sc16_regentry * starch_magnitude_sc16_select() {
-    for (starch_magnitude_sc16_regentry *entry = starch_magnitude_sc16_registry;
+starch_magnitude_dc_sc16_aligned_regentry * starch_magnitude_dc_sc16_aligned_select() {
+    for (starch_magnitude_dc_sc16_aligned_regentry *entry = starch_magnitude_dc_sc16_aligned_registry;
          entry->name;
          ++entry)
     {
@@ -385,22 +365,22 @@ starch_magnitude_sc16_regentry * starch_magnitude_sc16_select() {
     return NULL;
 }
 
-static void starch_magnitude_sc16_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
-    starch_magnitude_sc16_regentry *entry = starch_magnitude_sc16_select();
+static void starch_magnitude_dc_sc16_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 ) {
+    starch_magnitude_dc_sc16_aligned_regentry *entry = starch_magnitude_dc_sc16_aligned_select();
     if (!entry)
         abort();
 
-    starch_magnitude_sc16 = entry->callable;
-    starch_magnitude_sc16 ( arg0, arg1, arg2 );
+    starch_magnitude_dc_sc16_aligned = entry->callable;
+    starch_magnitude_dc_sc16_aligned ( arg0, arg1, arg2, arg3 );
 }
 
-starch_magnitude_sc16_ptr starch_magnitude_sc16 = starch_magnitude_sc16_dispatch;
+starch_magnitude_dc_sc16_aligned_ptr starch_magnitude_dc_sc16_aligned = starch_magnitude_dc_sc16_aligned_dispatch;
 
-void starch_magnitude_sc16_set_wisdom (const char * const * received_wisdom)
+void starch_magnitude_dc_sc16_aligned_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_sc16_regentry *entry;
-    for (entry = starch_magnitude_sc16_registry; entry->name; ++entry) {
+    starch_magnitude_dc_sc16_aligned_regentry *entry;
+    for (entry = starch_magnitude_dc_sc16_aligned_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -412,53 +392,61 @@ void starch_magnitude_sc16_set_wisdom (const char * const * received_wisdom)
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_sc16_aligned_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_sc16_registry, entry - starch_magnitude_sc16_registry, sizeof(starch_magnitude_sc16_regentry), starch_regentry_rank_compare);
+    qsort(starch_magnitude_dc_sc16_aligned_registry, entry - starch_magnitude_dc_sc16_aligned_registry, sizeof(starch_magnitude_dc_sc16_aligned_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_sc16 = starch_magnitude_sc16_dispatch;
+    starch_magnitude_dc_sc16_aligned = starch_magnitude_dc_sc16_aligned_dispatch;
 }
 
-starch_magnitude_sc16_regentry starch_magnitude_sc16_registry[] = {
+starch_magnitude_dc_sc16_aligned_regentry starch_magnitude_dc_sc16_aligned_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_sc16_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16_exact_float_s32_generic, NULL },
+    { 2, "exact_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_sc16_aligned_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_s32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_sc16_aligned_exact_float_s32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "exact_float_s32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16_exact_float_s32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "exact_float_generic", "generic", starch_magnitude_dc_sc16_exact_float_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16_exact_float_s32_generic, NULL },
+    { 2, "exact_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_aligned_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_s32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_aligned_exact_float_s32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "exact_float_s32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_exact_float_s32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "exact_float_generic", "generic", starch_magnitude_dc_sc16_exact_float_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16_exact_float_s32_generic, NULL },
+    { 1, "exact_float_generic", "generic", starch_magnitude_dc_sc16_exact_float_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 3, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "exact_float_s32_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_sc16_aligned_exact_float_s32_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16_exact_float_s32_generic, NULL },
+    { 2, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_sc16_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 3, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 4, "exact_float_s32_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16_exact_float_s32_x86_avx2, cpu_supports_avx2 },
+    { 5, "exact_float_generic", "generic", starch_magnitude_dc_sc16_exact_float_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_sc16_aligned */
+/* dispatcher / registry for magnitude_dc_sc16q11 */
 
-starch_magnitude_sc16_aligned_regentry * starch_magnitude_sc16_aligned_select() {
-    for (starch_magnitude_sc16_aligned_regentry *entry = starch_magnitude_sc16_aligned_registry;
+starch_magnitude_dc_sc16q11_regentry * starch_magnitude_dc_sc16q11_select() {
+    for (starch_magnitude_dc_sc16q11_regentry *entry = starch_magnitude_dc_sc16q11_registry;
          entry->name;
          ++entry)
     {
@@ -469,22 +457,22 @@ starch_magnitude_sc16_aligned_regentry * starch_magnitude_sc16_aligned_select()
     return NULL;
 }
 
-static void starch_magnitude_sc16_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
-    starch_magnitude_sc16_aligned_regentry *entry = starch_magnitude_sc16_aligned_select();
+static void starch_magnitude_dc_sc16q11_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 ) {
+    starch_magnitude_dc_sc16q11_regentry *entry = starch_magnitude_dc_sc16q11_select();
     if (!entry)
         abort();
 
-    starch_magnitude_sc16_aligned = entry->callable;
-    starch_magnitude_sc16_aligned ( arg0, arg1, arg2 );
+    starch_magnitude_dc_sc16q11 = entry->callable;
+    starch_magnitude_dc_sc16q11 ( arg0, arg1, arg2, arg3 );
 }
 
-starch_magnitude_sc16_aligned_ptr starch_magnitude_sc16_aligned = starch_magnitude_sc16_aligned_dispatch;
+starch_magnitude_dc_sc16q11_ptr starch_magnitude_dc_sc16q11 = starch_magnitude_dc_sc16q11_dispatch;
 
-void starch_magnitude_sc16_aligned_set_wisdom (const char * const * received_wisdom)
+void starch_magnitude_dc_sc16q11_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_sc16_aligned_regentry *entry;
-    for (entry = starch_magnitude_sc16_aligned_registry; entry->name; ++entry) {
+    starch_magnitude_dc_sc16q11_regentry *entry;
+    for (entry = starch_magnitude_dc_sc16q11_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -496,61 +484,53 @@ void starch_magnitude_sc16_aligned_set_wisdom (const char * const * received_wis
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16_aligned_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_sc16q11_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_sc16_aligned_registry, entry - starch_magnitude_sc16_aligned_registry, sizeof(starch_magnitude_sc16_aligned_regentry), starch_regentry_rank_compare);
+    qsort(starch_magnitude_dc_sc16q11_registry, entry - starch_magnitude_dc_sc16q11_registry, sizeof(starch_magnitude_dc_sc16q11_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_sc16_aligned = starch_magnitude_sc16_aligned_dispatch;
+    starch_magnitude_dc_sc16q11 = starch_magnitude_dc_sc16q11_dispatch;
 }
 
-starch_magnitude_sc16_aligned_regentry starch_magnitude_sc16_aligned_registry[] = {
+starch_magnitude_dc_sc16q11_regentry starch_magnitude_dc_sc16q11_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16_aligned_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "exact_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16_aligned_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 6, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 7, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_s32_generic, NULL },
+    { 2, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16q11_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_s32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16q11_exact_float_s32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "exact_float_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16_aligned_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "exact_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16_aligned_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 6, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 7, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_s32_generic, NULL },
+    { 2, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_s32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_exact_float_s32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_float_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_s32_generic, NULL },
+    { 1, "exact_float_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
-    { 2, "exact_u32_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16_aligned_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 3, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 4, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
-    { 5, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+    { 0, "exact_float_s32_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16q11_exact_float_s32_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_s32_generic, NULL },
+    { 2, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 3, "exact_float_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_sc16q11 */
+/* dispatcher / registry for magnitude_dc_sc16q11_aligned */
 
-starch_magnitude_sc16q11_regentry * starch_magnitude_sc16q11_select() {
-    for (starch_magnitude_sc16q11_regentry *entry = starch_magnitude_sc16q11_registry;
+starch_magnitude_dc_sc16q11_aligned_regentry * starch_magnitude_dc_sc16q11_aligned_select() {
+    for (starch_magnitude_dc_sc16q11_aligned_regentry *entry = starch_magnitude_dc_sc16q11_aligned_registry;
          entry->name;
          ++entry)
     {
@@ -561,22 +541,22 @@ starch_magnitude_sc16q11_regentry * starch_magnitude_sc16q11_select() {
     return NULL;
 }
 
-static void starch_magnitude_sc16q11_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
-    starch_magnitude_sc16q11_regentry *entry = starch_magnitude_sc16q11_select();
+static void starch_magnitude_dc_sc16q11_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 ) {
+    starch_magnitude_dc_sc16q11_aligned_regentry *entry = starch_magnitude_dc_sc16q11_aligned_select();
     if (!entry)
         abort();
 
-    starch_magnitude_sc16q11 = entry->callable;
-    starch_magnitude_sc16q11 ( arg0, arg1, arg2 );
+    starch_magnitude_dc_sc16q11_aligned = entry->callable;
+    starch_magnitude_dc_sc16q11_aligned ( arg0, arg1, arg2, arg3 );
 }
 
-starch_magnitude_sc16q11_ptr starch_magnitude_sc16q11 = starch_magnitude_sc16q11_dispatch;
+starch_magnitude_dc_sc16q11_aligned_ptr starch_magnitude_dc_sc16q11_aligned = starch_magnitude_dc_sc16q11_aligned_dispatch;
 
-void starch_magnitude_sc16q11_set_wisdom (const char * const * received_wisdom)
+void starch_magnitude_dc_sc16q11_aligned_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_sc16q11_regentry *entry;
-    for (entry = starch_magnitude_sc16q11_registry; entry->name; ++entry) {
+    starch_magnitude_dc_sc16q11_aligned_regentry *entry;
+    for (entry = starch_magnitude_dc_sc16q11_aligned_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -588,67 +568,61 @@ void starch_magnitude_sc16q11_set_wisdom (const char * const * received_wisdom)
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16q11_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_sc16q11_aligned_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_sc16q11_registry, entry - starch_magnitude_sc16q11_registry, sizeof(starch_magnitude_sc16q11_regentry), starch_regentry_rank_compare);
+    qsort(starch_magnitude_dc_sc16q11_aligned_registry, entry - starch_magnitude_dc_sc16q11_aligned_registry, sizeof(starch_magnitude_dc_sc16q11_aligned_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_sc16q11 = starch_magnitude_sc16q11_dispatch;
+    starch_magnitude_dc_sc16q11_aligned = starch_magnitude_dc_sc16q11_aligned_dispatch;
 }
 
-starch_magnitude_sc16q11_regentry starch_magnitude_sc16q11_registry[] = {
+starch_magnitude_dc_sc16q11_aligned_regentry starch_magnitude_dc_sc16q11_aligned_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 2, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "11bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "12bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_12bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 6, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 7, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 8, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_sc16q11_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_s32_generic, NULL },
+    { 2, "exact_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_sc16q11_aligned_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_s32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_sc16q11_aligned_exact_float_s32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16q11_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "exact_float_s32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16q11_exact_float_s32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "exact_float_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 2, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "11bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_11bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "12bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_12bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 6, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 7, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 8, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_s32_generic, NULL },
+    { 2, "exact_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_aligned_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_s32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_aligned_exact_float_s32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "exact_float_s32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_exact_float_s32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "exact_float_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 2, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 3, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_s32_generic, NULL },
+    { 1, "exact_float_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 2, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 3, "11bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_11bit_table_x86_avx2, cpu_supports_avx2 },
-    { 4, "12bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_12bit_table_x86_avx2, cpu_supports_avx2 },
-    { 5, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 6, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 7, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "exact_float_s32_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_sc16q11_aligned_exact_float_s32_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_float_s32_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_s32_generic, NULL },
+    { 2, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_sc16q11_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 3, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 4, "exact_float_s32_x86_avx2", "x86_avx2", starch_magnitude_dc_sc16q11_exact_float_s32_x86_avx2, cpu_supports_avx2 },
+    { 5, "exact_float_generic", "generic", starch_magnitude_dc_sc16q11_exact_float_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_sc16q11_aligned */
+/* dispatcher / registry for magnitude_dc_uc8 */
 
-starch_magnitude_sc16q11_aligned_regentry * starch_magnitude_sc16q11_aligned_select() {
-    for (starch_magnitude_sc16q11_aligned_regentry *entry = starch_magnitude_sc16q11_aligned_registry;
+starch_magnitude_dc_uc8_regentry * starch_magnitude_dc_uc8_select() {
+    for (starch_magnitude_dc_uc8_regentry *entry = starch_magnitude_dc_uc8_registry;
          entry->name;
          ++entry)
     {
@@ -659,22 +633,22 @@ starch_magnitude_sc16q11_aligned_regentry * starch_magnitude_sc16q11_aligned_sel
     return NULL;
 }
 
-static void starch_magnitude_sc16q11_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
-    starch_magnitude_sc16q11_aligned_regentry *entry = starch_magnitude_sc16q11_aligned_select();
+static void starch_magnitude_dc_uc8_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 ) {
+    starch_magnitude_dc_uc8_regentry *entry = starch_magnitude_dc_uc8_select();
     if (!entry)
         abort();
 
-    starch_magnitude_sc16q11_aligned = entry->callable;
-    starch_magnitude_sc16q11_aligned ( arg0, arg1, arg2 );
+    starch_magnitude_dc_uc8 = entry->callable;
+    starch_magnitude_dc_uc8 ( arg0, arg1, arg2, arg3 );
 }
 
-starch_magnitude_sc16q11_aligned_ptr starch_magnitude_sc16q11_aligned = starch_magnitude_sc16q11_aligned_dispatch;
+starch_magnitude_dc_uc8_ptr starch_magnitude_dc_uc8 = starch_magnitude_dc_uc8_dispatch;
 
-void starch_magnitude_sc16q11_aligned_set_wisdom (const char * const * received_wisdom)
+void starch_magnitude_dc_uc8_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_sc16q11_aligned_regentry *entry;
-    for (entry = starch_magnitude_sc16q11_aligned_registry; entry->name; ++entry) {
+    starch_magnitude_dc_uc8_regentry *entry;
+    for (entry = starch_magnitude_dc_uc8_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -686,68 +660,1267 @@ void starch_magnitude_sc16q11_aligned_set_wisdom (const char * const * received_
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16q11_aligned_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_uc8_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_sc16q11_aligned_registry, entry - starch_magnitude_sc16q11_aligned_registry, sizeof(starch_magnitude_sc16q11_aligned_regentry), starch_regentry_rank_compare);
+    qsort(starch_magnitude_dc_uc8_registry, entry - starch_magnitude_dc_uc8_registry, sizeof(starch_magnitude_dc_uc8_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_sc16q11_aligned = starch_magnitude_sc16q11_aligned_dispatch;
+    starch_magnitude_dc_uc8 = starch_magnitude_dc_uc8_dispatch;
 }
 
-starch_magnitude_sc16q11_aligned_regentry starch_magnitude_sc16q11_aligned_registry[] = {
+starch_magnitude_dc_uc8_regentry starch_magnitude_dc_uc8_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 2, "exact_u32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "exact_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "11bit_table_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "12bit_table_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_12bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 6, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 7, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 8, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 9, "11bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 10, "12bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_12bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 11, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 12, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 13, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_dc_uc8_exact_u32_generic, NULL },
+    { 2, "exact_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_uc8_exact_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_uc8_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "exact_generic", "generic", starch_magnitude_dc_uc8_exact_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 2, "exact_u32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "exact_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "11bit_table_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_11bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "12bit_table_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_12bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 6, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 7, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 8, "11bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_11bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 9, "12bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_12bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 10, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 11, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 12, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 13, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_dc_uc8_exact_u32_generic, NULL },
+    { 2, "exact_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_generic", "generic", starch_magnitude_dc_uc8_exact_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
-    { 2, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
-    { 3, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+    { 0, "exact_u32_generic", "generic", starch_magnitude_dc_uc8_exact_u32_generic, NULL },
+    { 1, "exact_generic", "generic", starch_magnitude_dc_uc8_exact_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
-    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
-    { 2, "exact_u32_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 3, "11bit_table_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_11bit_table_x86_avx2, cpu_supports_avx2 },
-    { 4, "12bit_table_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_12bit_table_x86_avx2, cpu_supports_avx2 },
-    { 5, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_u32_x86_avx2, cpu_supports_avx2 },
-    { 6, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 0, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_dc_uc8_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_dc_uc8_exact_u32_generic, NULL },
+    { 2, "exact_x86_avx2", "x86_avx2", starch_magnitude_dc_uc8_exact_x86_avx2, cpu_supports_avx2 },
+    { 3, "exact_generic", "generic", starch_magnitude_dc_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_dc_uc8_aligned */
+
+starch_magnitude_dc_uc8_aligned_regentry * starch_magnitude_dc_uc8_aligned_select() {
+    for (starch_magnitude_dc_uc8_aligned_regentry *entry = starch_magnitude_dc_uc8_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_dc_uc8_aligned_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 ) {
+    starch_magnitude_dc_uc8_aligned_regentry *entry = starch_magnitude_dc_uc8_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_dc_uc8_aligned = entry->callable;
+    starch_magnitude_dc_uc8_aligned ( arg0, arg1, arg2, arg3 );
+}
+
+starch_magnitude_dc_uc8_aligned_ptr starch_magnitude_dc_uc8_aligned = starch_magnitude_dc_uc8_aligned_dispatch;
+
+void starch_magnitude_dc_uc8_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_dc_uc8_aligned_regentry *entry;
+    for (entry = starch_magnitude_dc_uc8_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_dc_uc8_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_dc_uc8_aligned_registry, entry - starch_magnitude_dc_uc8_aligned_registry, sizeof(starch_magnitude_dc_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_dc_uc8_aligned = starch_magnitude_dc_uc8_aligned_dispatch;
+}
+
+starch_magnitude_dc_uc8_aligned_regentry starch_magnitude_dc_uc8_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_uc8_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_dc_uc8_exact_u32_generic, NULL },
+    { 2, "exact_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_uc8_aligned_exact_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_u32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_dc_uc8_aligned_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "exact_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_uc8_exact_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_uc8_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_dc_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "exact_generic", "generic", starch_magnitude_dc_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_dc_uc8_exact_u32_generic, NULL },
+    { 2, "exact_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_aligned_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_u32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_aligned_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_dc_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "exact_generic", "generic", starch_magnitude_dc_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "exact_u32_generic", "generic", starch_magnitude_dc_uc8_exact_u32_generic, NULL },
+    { 1, "exact_generic", "generic", starch_magnitude_dc_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "exact_u32_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_uc8_aligned_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_dc_uc8_exact_u32_generic, NULL },
+    { 2, "exact_x86_avx2_aligned", "x86_avx2", starch_magnitude_dc_uc8_aligned_exact_x86_avx2, cpu_supports_avx2 },
+    { 3, "exact_x86_avx2", "x86_avx2", starch_magnitude_dc_uc8_exact_x86_avx2, cpu_supports_avx2 },
+    { 4, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_dc_uc8_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 5, "exact_generic", "generic", starch_magnitude_dc_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_power_sc16 */
+
+starch_magnitude_power_sc16_regentry * starch_magnitude_power_sc16_select() {
+    for (starch_magnitude_power_sc16_regentry *entry = starch_magnitude_power_sc16_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_power_sc16_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
+    starch_magnitude_power_sc16_regentry *entry = starch_magnitude_power_sc16_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_power_sc16 = entry->callable;
+    starch_magnitude_power_sc16 ( arg0, arg1, arg2, arg3, arg4 );
+}
+
+starch_magnitude_power_sc16_ptr starch_magnitude_power_sc16 = starch_magnitude_power_sc16_dispatch;
+
+void starch_magnitude_power_sc16_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_power_sc16_regentry *entry;
+    for (entry = starch_magnitude_power_sc16_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_sc16_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_power_sc16_registry, entry - starch_magnitude_power_sc16_registry, sizeof(starch_magnitude_power_sc16_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_power_sc16 = starch_magnitude_power_sc16_dispatch;
+}
+
+starch_magnitude_power_sc16_regentry starch_magnitude_power_sc16_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "twopass_generic", "generic", starch_magnitude_power_sc16_twopass_generic, NULL },
+    { 2, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "exact_float_generic", "generic", starch_magnitude_power_sc16_exact_float_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "twopass_generic", "generic", starch_magnitude_power_sc16_twopass_generic, NULL },
+    { 2, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_float_generic", "generic", starch_magnitude_power_sc16_exact_float_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_magnitude_power_sc16_twopass_generic, NULL },
+    { 1, "exact_float_generic", "generic", starch_magnitude_power_sc16_exact_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_sc16_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_power_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "twopass_generic", "generic", starch_magnitude_power_sc16_twopass_generic, NULL },
+    { 3, "exact_float_generic", "generic", starch_magnitude_power_sc16_exact_float_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_power_sc16_aligned */
+
+starch_magnitude_power_sc16_aligned_regentry * starch_magnitude_power_sc16_aligned_select() {
+    for (starch_magnitude_power_sc16_aligned_regentry *entry = starch_magnitude_power_sc16_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_power_sc16_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
+    starch_magnitude_power_sc16_aligned_regentry *entry = starch_magnitude_power_sc16_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_power_sc16_aligned = entry->callable;
+    starch_magnitude_power_sc16_aligned ( arg0, arg1, arg2, arg3, arg4 );
+}
+
+starch_magnitude_power_sc16_aligned_ptr starch_magnitude_power_sc16_aligned = starch_magnitude_power_sc16_aligned_dispatch;
+
+void starch_magnitude_power_sc16_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_power_sc16_aligned_regentry *entry;
+    for (entry = starch_magnitude_power_sc16_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_sc16_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_power_sc16_aligned_registry, entry - starch_magnitude_power_sc16_aligned_registry, sizeof(starch_magnitude_power_sc16_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_power_sc16_aligned = starch_magnitude_power_sc16_aligned_dispatch;
+}
+
+starch_magnitude_power_sc16_aligned_regentry starch_magnitude_power_sc16_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_sc16_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "twopass_generic", "generic", starch_magnitude_power_sc16_twopass_generic, NULL },
+    { 2, "twopass_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_sc16_aligned_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_sc16_aligned_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "exact_float_generic", "generic", starch_magnitude_power_sc16_exact_float_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_sc16_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "twopass_generic", "generic", starch_magnitude_power_sc16_twopass_generic, NULL },
+    { 2, "twopass_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_sc16_aligned_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_sc16_aligned_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "exact_float_generic", "generic", starch_magnitude_power_sc16_exact_float_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_magnitude_power_sc16_twopass_generic, NULL },
+    { 1, "exact_float_generic", "generic", starch_magnitude_power_sc16_exact_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_sc16_aligned_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_sc16_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_sc16_twopass_x86_avx2, cpu_supports_avx2 },
+    { 3, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_power_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 4, "twopass_generic", "generic", starch_magnitude_power_sc16_twopass_generic, NULL },
+    { 5, "exact_float_generic", "generic", starch_magnitude_power_sc16_exact_float_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_power_sc16q11 */
+
+starch_magnitude_power_sc16q11_regentry * starch_magnitude_power_sc16q11_select() {
+    for (starch_magnitude_power_sc16q11_regentry *entry = starch_magnitude_power_sc16q11_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_power_sc16q11_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
+    starch_magnitude_power_sc16q11_regentry *entry = starch_magnitude_power_sc16q11_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_power_sc16q11 = entry->callable;
+    starch_magnitude_power_sc16q11 ( arg0, arg1, arg2, arg3, arg4 );
+}
+
+starch_magnitude_power_sc16q11_ptr starch_magnitude_power_sc16q11 = starch_magnitude_power_sc16q11_dispatch;
+
+void starch_magnitude_power_sc16q11_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_power_sc16q11_regentry *entry;
+    for (entry = starch_magnitude_power_sc16q11_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_sc16q11_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_power_sc16q11_registry, entry - starch_magnitude_power_sc16q11_registry, sizeof(starch_magnitude_power_sc16q11_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_power_sc16q11 = starch_magnitude_power_sc16q11_dispatch;
+}
+
+starch_magnitude_power_sc16q11_regentry starch_magnitude_power_sc16q11_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "twopass_generic", "generic", starch_magnitude_power_sc16q11_twopass_generic, NULL },
+    { 2, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16q11_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16q11_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "11bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16q11_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "exact_float_generic", "generic", starch_magnitude_power_sc16q11_exact_float_generic, NULL },
+    { 6, "11bit_table_generic", "generic", starch_magnitude_power_sc16q11_11bit_table_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "twopass_generic", "generic", starch_magnitude_power_sc16q11_twopass_generic, NULL },
+    { 2, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16q11_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16q11_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "11bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16q11_11bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "exact_float_generic", "generic", starch_magnitude_power_sc16q11_exact_float_generic, NULL },
+    { 6, "11bit_table_generic", "generic", starch_magnitude_power_sc16q11_11bit_table_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_magnitude_power_sc16q11_twopass_generic, NULL },
+    { 1, "exact_float_generic", "generic", starch_magnitude_power_sc16q11_exact_float_generic, NULL },
+    { 2, "11bit_table_generic", "generic", starch_magnitude_power_sc16q11_11bit_table_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_sc16q11_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_power_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "11bit_table_x86_avx2", "x86_avx2", starch_magnitude_power_sc16q11_11bit_table_x86_avx2, cpu_supports_avx2 },
+    { 3, "twopass_generic", "generic", starch_magnitude_power_sc16q11_twopass_generic, NULL },
+    { 4, "exact_float_generic", "generic", starch_magnitude_power_sc16q11_exact_float_generic, NULL },
+    { 5, "11bit_table_generic", "generic", starch_magnitude_power_sc16q11_11bit_table_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_power_sc16q11_aligned */
+
+starch_magnitude_power_sc16q11_aligned_regentry * starch_magnitude_power_sc16q11_aligned_select() {
+    for (starch_magnitude_power_sc16q11_aligned_regentry *entry = starch_magnitude_power_sc16q11_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_power_sc16q11_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
+    starch_magnitude_power_sc16q11_aligned_regentry *entry = starch_magnitude_power_sc16q11_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_power_sc16q11_aligned = entry->callable;
+    starch_magnitude_power_sc16q11_aligned ( arg0, arg1, arg2, arg3, arg4 );
+}
+
+starch_magnitude_power_sc16q11_aligned_ptr starch_magnitude_power_sc16q11_aligned = starch_magnitude_power_sc16q11_aligned_dispatch;
+
+void starch_magnitude_power_sc16q11_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_power_sc16q11_aligned_regentry *entry;
+    for (entry = starch_magnitude_power_sc16q11_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_sc16q11_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_power_sc16q11_aligned_registry, entry - starch_magnitude_power_sc16q11_aligned_registry, sizeof(starch_magnitude_power_sc16q11_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_power_sc16q11_aligned = starch_magnitude_power_sc16q11_aligned_dispatch;
+}
+
+starch_magnitude_power_sc16q11_aligned_regentry starch_magnitude_power_sc16q11_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_sc16q11_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "twopass_generic", "generic", starch_magnitude_power_sc16q11_twopass_generic, NULL },
+    { 2, "twopass_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_sc16q11_aligned_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_sc16q11_aligned_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "11bit_table_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_sc16q11_aligned_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16q11_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16q11_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "11bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16q11_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 8, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 9, "exact_float_generic", "generic", starch_magnitude_power_sc16q11_exact_float_generic, NULL },
+    { 10, "11bit_table_generic", "generic", starch_magnitude_power_sc16q11_11bit_table_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_sc16q11_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "twopass_generic", "generic", starch_magnitude_power_sc16q11_twopass_generic, NULL },
+    { 2, "twopass_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_sc16q11_aligned_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_sc16q11_aligned_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "11bit_table_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_sc16q11_aligned_11bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16q11_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16q11_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "11bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16q11_11bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 8, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 9, "exact_float_generic", "generic", starch_magnitude_power_sc16q11_exact_float_generic, NULL },
+    { 10, "11bit_table_generic", "generic", starch_magnitude_power_sc16q11_11bit_table_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_magnitude_power_sc16q11_twopass_generic, NULL },
+    { 1, "exact_float_generic", "generic", starch_magnitude_power_sc16q11_exact_float_generic, NULL },
+    { 2, "11bit_table_generic", "generic", starch_magnitude_power_sc16q11_11bit_table_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_sc16q11_aligned_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_sc16q11_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 2, "11bit_table_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_sc16q11_aligned_11bit_table_x86_avx2, cpu_supports_avx2 },
+    { 3, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_sc16q11_twopass_x86_avx2, cpu_supports_avx2 },
+    { 4, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_power_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 5, "11bit_table_x86_avx2", "x86_avx2", starch_magnitude_power_sc16q11_11bit_table_x86_avx2, cpu_supports_avx2 },
+    { 6, "twopass_generic", "generic", starch_magnitude_power_sc16q11_twopass_generic, NULL },
+    { 7, "exact_float_generic", "generic", starch_magnitude_power_sc16q11_exact_float_generic, NULL },
+    { 8, "11bit_table_generic", "generic", starch_magnitude_power_sc16q11_11bit_table_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_power_uc8 */
+
+starch_magnitude_power_uc8_regentry * starch_magnitude_power_uc8_select() {
+    for (starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_power_uc8_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
+    starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_power_uc8 = entry->callable;
+    starch_magnitude_power_uc8 ( arg0, arg1, arg2, arg3, arg4 );
+}
+
+starch_magnitude_power_uc8_ptr starch_magnitude_power_uc8 = starch_magnitude_power_uc8_dispatch;
+
+void starch_magnitude_power_uc8_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_power_uc8_regentry *entry;
+    for (entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_uc8_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_power_uc8_registry, entry - starch_magnitude_power_uc8_registry, sizeof(starch_magnitude_power_uc8_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_power_uc8 = starch_magnitude_power_uc8_dispatch;
+}
+
+starch_magnitude_power_uc8_regentry starch_magnitude_power_uc8_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 6, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 6, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 1, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 2, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 2, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_x86_avx2, cpu_supports_avx2 },
+    { 3, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 4, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 5, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_power_uc8_aligned */
+
+starch_magnitude_power_uc8_aligned_regentry * starch_magnitude_power_uc8_aligned_select() {
+    for (starch_magnitude_power_uc8_aligned_regentry *entry = starch_magnitude_power_uc8_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_power_uc8_aligned_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
+    starch_magnitude_power_uc8_aligned_regentry *entry = starch_magnitude_power_uc8_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_power_uc8_aligned = entry->callable;
+    starch_magnitude_power_uc8_aligned ( arg0, arg1, arg2, arg3, arg4 );
+}
+
+starch_magnitude_power_uc8_aligned_ptr starch_magnitude_power_uc8_aligned = starch_magnitude_power_uc8_aligned_dispatch;
+
+void starch_magnitude_power_uc8_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_power_uc8_aligned_regentry *entry;
+    for (entry = starch_magnitude_power_uc8_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_uc8_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_power_uc8_aligned_registry, entry - starch_magnitude_power_uc8_aligned_registry, sizeof(starch_magnitude_power_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_power_uc8_aligned = starch_magnitude_power_uc8_aligned_dispatch;
+}
+
+starch_magnitude_power_uc8_aligned_regentry starch_magnitude_power_uc8_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "twopass_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "lookup_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "lookup_unroll_4_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 8, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 9, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 10, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "twopass_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "lookup_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "lookup_unroll_4_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_aligned_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 8, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 9, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 10, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 1, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 2, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "twopass_generic", "generic", starch_magnitude_power_uc8_twopass_generic, NULL },
+    { 2, "lookup_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_lookup_x86_avx2, cpu_supports_avx2 },
+    { 3, "lookup_unroll_4_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_aligned_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 4, "twopass_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_twopass_x86_avx2, cpu_supports_avx2 },
+    { 5, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_x86_avx2, cpu_supports_avx2 },
+    { 6, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 7, "lookup_generic", "generic", starch_magnitude_power_uc8_lookup_generic, NULL },
+    { 8, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_lookup_unroll_4_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_power_uc8_u8 */
+
+starch_magnitude_power_uc8_u8_regentry * starch_magnitude_power_uc8_u8_select() {
+    for (starch_magnitude_power_uc8_u8_regentry *entry = starch_magnitude_power_uc8_u8_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_power_uc8_u8_dispatch ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
+    starch_magnitude_power_uc8_u8_regentry *entry = starch_magnitude_power_uc8_u8_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_power_uc8_u8 = entry->callable;
+    starch_magnitude_power_uc8_u8 ( arg0, arg1, arg2, arg3, arg4 );
+}
+
+starch_magnitude_power_uc8_u8_ptr starch_magnitude_power_uc8_u8 = starch_magnitude_power_uc8_u8_dispatch;
+
+void starch_magnitude_power_uc8_u8_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_power_uc8_u8_regentry *entry;
+    for (entry = starch_magnitude_power_uc8_u8_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_uc8_u8_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_power_uc8_u8_registry, entry - starch_magnitude_power_uc8_u8_registry, sizeof(starch_magnitude_power_uc8_u8_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_power_uc8_u8 = starch_magnitude_power_uc8_u8_dispatch;
+}
+
+starch_magnitude_power_uc8_u8_regentry starch_magnitude_power_uc8_u8_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_u8_lookup_unroll_4_generic, NULL },
+    { 1, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_u8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 2, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_u8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_u8_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "lookup_generic", "generic", starch_magnitude_power_uc8_u8_lookup_generic, NULL },
+    { 5, "exact_float_generic", "generic", starch_magnitude_power_uc8_u8_exact_float_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_u8_lookup_unroll_4_generic, NULL },
+    { 1, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_u8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 2, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_u8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_u8_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "lookup_generic", "generic", starch_magnitude_power_uc8_u8_lookup_generic, NULL },
+    { 5, "exact_float_generic", "generic", starch_magnitude_power_uc8_u8_exact_float_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_u8_lookup_unroll_4_generic, NULL },
+    { 1, "lookup_generic", "generic", starch_magnitude_power_uc8_u8_lookup_generic, NULL },
+    { 2, "exact_float_generic", "generic", starch_magnitude_power_uc8_u8_exact_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_u8_lookup_unroll_4_generic, NULL },
+    { 1, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_u8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 2, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_u8_lookup_x86_avx2, cpu_supports_avx2 },
+    { 3, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_u8_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 4, "lookup_generic", "generic", starch_magnitude_power_uc8_u8_lookup_generic, NULL },
+    { 5, "exact_float_generic", "generic", starch_magnitude_power_uc8_u8_exact_float_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_power_uc8_u8_aligned */
+
+starch_magnitude_power_uc8_u8_aligned_regentry * starch_magnitude_power_uc8_u8_aligned_select() {
+    for (starch_magnitude_power_uc8_u8_aligned_regentry *entry = starch_magnitude_power_uc8_u8_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_power_uc8_u8_aligned_dispatch ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 ) {
+    starch_magnitude_power_uc8_u8_aligned_regentry *entry = starch_magnitude_power_uc8_u8_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_power_uc8_u8_aligned = entry->callable;
+    starch_magnitude_power_uc8_u8_aligned ( arg0, arg1, arg2, arg3, arg4 );
+}
+
+starch_magnitude_power_uc8_u8_aligned_ptr starch_magnitude_power_uc8_u8_aligned = starch_magnitude_power_uc8_u8_aligned_dispatch;
+
+void starch_magnitude_power_uc8_u8_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_power_uc8_u8_aligned_regentry *entry;
+    for (entry = starch_magnitude_power_uc8_u8_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_power_uc8_u8_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_power_uc8_u8_aligned_registry, entry - starch_magnitude_power_uc8_u8_aligned_registry, sizeof(starch_magnitude_power_uc8_u8_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_power_uc8_u8_aligned = starch_magnitude_power_uc8_u8_aligned_dispatch;
+}
+
+starch_magnitude_power_uc8_u8_aligned_regentry starch_magnitude_power_uc8_u8_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_u8_lookup_unroll_4_generic, NULL },
+    { 1, "lookup_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_u8_aligned_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 2, "lookup_unroll_4_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_u8_aligned_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_power_uc8_u8_aligned_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_u8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_u8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_power_uc8_u8_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "lookup_generic", "generic", starch_magnitude_power_uc8_u8_lookup_generic, NULL },
+    { 8, "exact_float_generic", "generic", starch_magnitude_power_uc8_u8_exact_float_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_u8_lookup_unroll_4_generic, NULL },
+    { 1, "lookup_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_u8_aligned_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 2, "lookup_unroll_4_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_u8_aligned_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_u8_aligned_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_u8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_u8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_power_uc8_u8_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "lookup_generic", "generic", starch_magnitude_power_uc8_u8_lookup_generic, NULL },
+    { 8, "exact_float_generic", "generic", starch_magnitude_power_uc8_u8_exact_float_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_u8_lookup_unroll_4_generic, NULL },
+    { 1, "lookup_generic", "generic", starch_magnitude_power_uc8_u8_lookup_generic, NULL },
+    { 2, "exact_float_generic", "generic", starch_magnitude_power_uc8_u8_exact_float_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "lookup_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_u8_lookup_x86_avx2, cpu_supports_avx2 },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_power_uc8_u8_lookup_unroll_4_generic, NULL },
+    { 2, "lookup_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_u8_aligned_lookup_x86_avx2, cpu_supports_avx2 },
+    { 3, "lookup_unroll_4_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_u8_aligned_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 4, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_power_uc8_u8_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 5, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_u8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 6, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_power_uc8_u8_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 7, "lookup_generic", "generic", starch_magnitude_power_uc8_u8_lookup_generic, NULL },
+    { 8, "exact_float_generic", "generic", starch_magnitude_power_uc8_u8_exact_float_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_sc16 */
+
+starch_magnitude_sc16_regentry * starch_magnitude_sc16_select() {
+    for (starch_magnitude_sc16_regentry *entry = starch_magnitude_sc16_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_sc16_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
+    starch_magnitude_sc16_regentry *entry = starch_magnitude_sc16_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_sc16 = entry->callable;
+    starch_magnitude_sc16 ( arg0, arg1, arg2 );
+}
+
+starch_magnitude_sc16_ptr starch_magnitude_sc16 = starch_magnitude_sc16_dispatch;
+
+void starch_magnitude_sc16_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_sc16_regentry *entry;
+    for (entry = starch_magnitude_sc16_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_sc16_registry, entry - starch_magnitude_sc16_registry, sizeof(starch_magnitude_sc16_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_sc16 = starch_magnitude_sc16_dispatch;
+}
+
+starch_magnitude_sc16_regentry starch_magnitude_sc16_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 2, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 2, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 2, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 3, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_sc16_aligned */
+
+starch_magnitude_sc16_aligned_regentry * starch_magnitude_sc16_aligned_select() {
+    for (starch_magnitude_sc16_aligned_regentry *entry = starch_magnitude_sc16_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_sc16_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
+    starch_magnitude_sc16_aligned_regentry *entry = starch_magnitude_sc16_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_sc16_aligned = entry->callable;
+    starch_magnitude_sc16_aligned ( arg0, arg1, arg2 );
+}
+
+starch_magnitude_sc16_aligned_ptr starch_magnitude_sc16_aligned = starch_magnitude_sc16_aligned_dispatch;
+
+void starch_magnitude_sc16_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_sc16_aligned_regentry *entry;
+    for (entry = starch_magnitude_sc16_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_sc16_aligned_registry, entry - starch_magnitude_sc16_aligned_registry, sizeof(starch_magnitude_sc16_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_sc16_aligned = starch_magnitude_sc16_aligned_dispatch;
+}
+
+starch_magnitude_sc16_aligned_regentry starch_magnitude_sc16_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 2, "exact_u32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16_aligned_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16_aligned_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 2, "exact_u32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16_aligned_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16_aligned_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16_exact_float_generic, NULL },
+    { 2, "exact_u32_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16_aligned_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 3, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 4, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 5, "exact_u32_generic", "generic", starch_magnitude_sc16_exact_u32_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_sc16q11 */
+
+starch_magnitude_sc16q11_regentry * starch_magnitude_sc16q11_select() {
+    for (starch_magnitude_sc16q11_regentry *entry = starch_magnitude_sc16q11_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_sc16q11_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
+    starch_magnitude_sc16q11_regentry *entry = starch_magnitude_sc16q11_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_sc16q11 = entry->callable;
+    starch_magnitude_sc16q11 ( arg0, arg1, arg2 );
+}
+
+starch_magnitude_sc16q11_ptr starch_magnitude_sc16q11 = starch_magnitude_sc16q11_dispatch;
+
+void starch_magnitude_sc16q11_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_sc16q11_regentry *entry;
+    for (entry = starch_magnitude_sc16q11_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16q11_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_sc16q11_registry, entry - starch_magnitude_sc16q11_registry, sizeof(starch_magnitude_sc16q11_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_sc16q11 = starch_magnitude_sc16q11_dispatch;
+}
+
+starch_magnitude_sc16q11_regentry starch_magnitude_sc16q11_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 2, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "11bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "12bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_12bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 7, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 8, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 2, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "11bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_11bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "12bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_12bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 7, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 8, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 2, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 3, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 2, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 3, "11bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_11bit_table_x86_avx2, cpu_supports_avx2 },
+    { 4, "12bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_12bit_table_x86_avx2, cpu_supports_avx2 },
+    { 5, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 6, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 7, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_sc16q11_aligned */
+
+starch_magnitude_sc16q11_aligned_regentry * starch_magnitude_sc16q11_aligned_select() {
+    for (starch_magnitude_sc16q11_aligned_regentry *entry = starch_magnitude_sc16q11_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_sc16q11_aligned_dispatch ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 ) {
+    starch_magnitude_sc16q11_aligned_regentry *entry = starch_magnitude_sc16q11_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_sc16q11_aligned = entry->callable;
+    starch_magnitude_sc16q11_aligned ( arg0, arg1, arg2 );
+}
+
+starch_magnitude_sc16q11_aligned_ptr starch_magnitude_sc16q11_aligned = starch_magnitude_sc16q11_aligned_dispatch;
+
+void starch_magnitude_sc16q11_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_sc16q11_aligned_regentry *entry;
+    for (entry = starch_magnitude_sc16q11_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_sc16q11_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_sc16q11_aligned_registry, entry - starch_magnitude_sc16q11_aligned_registry, sizeof(starch_magnitude_sc16q11_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_sc16q11_aligned = starch_magnitude_sc16q11_aligned_dispatch;
+}
+
+starch_magnitude_sc16q11_aligned_regentry starch_magnitude_sc16q11_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 2, "exact_u32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "exact_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "11bit_table_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "12bit_table_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_12bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_sc16q11_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "exact_u32_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 8, "exact_float_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_exact_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 9, "11bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_11bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 10, "12bit_table_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_sc16q11_12bit_table_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 11, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 12, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 13, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 2, "exact_u32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "exact_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "11bit_table_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_11bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "12bit_table_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_aligned_12bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "exact_u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "exact_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_exact_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 8, "11bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_11bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 9, "12bit_table_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_12bit_table_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 10, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 11, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 12, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 13, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 1, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
+    { 2, "11bit_table_generic", "generic", starch_magnitude_sc16q11_11bit_table_generic, NULL },
+    { 3, "12bit_table_generic", "generic", starch_magnitude_sc16q11_12bit_table_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "exact_float_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_exact_float_x86_avx2, cpu_supports_avx2 },
+    { 1, "exact_float_generic", "generic", starch_magnitude_sc16q11_exact_float_generic, NULL },
+    { 2, "exact_u32_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 3, "11bit_table_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_11bit_table_x86_avx2, cpu_supports_avx2 },
+    { 4, "12bit_table_x86_avx2_aligned", "x86_avx2", starch_magnitude_sc16q11_aligned_12bit_table_x86_avx2, cpu_supports_avx2 },
+    { 5, "exact_u32_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_u32_x86_avx2, cpu_supports_avx2 },
+    { 6, "exact_float_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_exact_float_x86_avx2, cpu_supports_avx2 },
     { 7, "11bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_11bit_table_x86_avx2, cpu_supports_avx2 },
     { 8, "12bit_table_x86_avx2", "x86_avx2", starch_magnitude_sc16q11_12bit_table_x86_avx2, cpu_supports_avx2 },
     { 9, "exact_u32_generic", "generic", starch_magnitude_sc16q11_exact_u32_generic, NULL },
@@ -757,10 +1930,742 @@ starch_magnitude_sc16q11_aligned_regentry starch_magnitude_sc16q11_aligned_regis
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_uc8 */
+/* dispatcher / registry for magnitude_uc8 */
+
+starch_magnitude_uc8_regentry * starch_magnitude_uc8_select() {
+    for (starch_magnitude_uc8_regentry *entry = starch_magnitude_uc8_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_uc8_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 ) {
+    starch_magnitude_uc8_regentry *entry = starch_magnitude_uc8_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_uc8 = entry->callable;
+    starch_magnitude_uc8 ( arg0, arg1, arg2 );
+}
+
+starch_magnitude_uc8_ptr starch_magnitude_uc8 = starch_magnitude_uc8_dispatch;
+
+void starch_magnitude_uc8_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_uc8_regentry *entry;
+    for (entry = starch_magnitude_uc8_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_uc8_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_uc8_registry, entry - starch_magnitude_uc8_registry, sizeof(starch_magnitude_uc8_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_uc8 = starch_magnitude_uc8_dispatch;
+}
+
+starch_magnitude_uc8_regentry starch_magnitude_uc8_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "exact_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_exact_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 6, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 6, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 1, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 2, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "lookup_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_x86_avx2, cpu_supports_avx2 },
+    { 3, "exact_x86_avx2", "x86_avx2", starch_magnitude_uc8_exact_x86_avx2, cpu_supports_avx2 },
+    { 4, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 5, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for magnitude_uc8_aligned */
+
+starch_magnitude_uc8_aligned_regentry * starch_magnitude_uc8_aligned_select() {
+    for (starch_magnitude_uc8_aligned_regentry *entry = starch_magnitude_uc8_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_magnitude_uc8_aligned_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 ) {
+    starch_magnitude_uc8_aligned_regentry *entry = starch_magnitude_uc8_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_magnitude_uc8_aligned = entry->callable;
+    starch_magnitude_uc8_aligned ( arg0, arg1, arg2 );
+}
+
+starch_magnitude_uc8_aligned_ptr starch_magnitude_uc8_aligned = starch_magnitude_uc8_aligned_dispatch;
+
+void starch_magnitude_uc8_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_magnitude_uc8_aligned_regentry *entry;
+    for (entry = starch_magnitude_uc8_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_uc8_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_magnitude_uc8_aligned_registry, entry - starch_magnitude_uc8_aligned_registry, sizeof(starch_magnitude_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_magnitude_uc8_aligned = starch_magnitude_uc8_aligned_dispatch;
+}
+
+starch_magnitude_uc8_aligned_regentry starch_magnitude_uc8_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "lookup_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "lookup_unroll_4_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "exact_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_exact_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 8, "exact_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_exact_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 9, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 10, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "lookup_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "lookup_unroll_4_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "exact_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "exact_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 8, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 9, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 10, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 1, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 2, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
+    { 2, "lookup_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_lookup_x86_avx2, cpu_supports_avx2 },
+    { 3, "lookup_unroll_4_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
+    { 4, "exact_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_exact_x86_avx2, cpu_supports_avx2 },
+    { 5, "lookup_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_x86_avx2, cpu_supports_avx2 },
+    { 6, "exact_x86_avx2", "x86_avx2", starch_magnitude_uc8_exact_x86_avx2, cpu_supports_avx2 },
+    { 7, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
+    { 8, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for mean_power_u16 */
+
+starch_mean_power_u16_regentry * starch_mean_power_u16_select() {
+    for (starch_mean_power_u16_regentry *entry = starch_mean_power_u16_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_mean_power_u16_dispatch ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 ) {
+    starch_mean_power_u16_regentry *entry = starch_mean_power_u16_select();
+    if (!entry)
+        abort();
+
+    starch_mean_power_u16 = entry->callable;
+    starch_mean_power_u16 ( arg0, arg1, arg2, arg3 );
+}
+
+starch_mean_power_u16_ptr starch_mean_power_u16 = starch_mean_power_u16_dispatch;
+
+void starch_mean_power_u16_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_mean_power_u16_regentry *entry;
+    for (entry = starch_mean_power_u16_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_mean_power_u16_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_mean_power_u16_registry, entry - starch_mean_power_u16_registry, sizeof(starch_mean_power_u16_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_mean_power_u16 = starch_mean_power_u16_dispatch;
+}
+
+starch_mean_power_u16_regentry starch_mean_power_u16_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "u32_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 2, "float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "u64_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u64_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "neon_float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_neon_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 6, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 2, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "u64_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u64_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "neon_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_neon_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 6, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 1, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 2, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "u32_x86_avx2", "x86_avx2", starch_mean_power_u16_u32_x86_avx2, cpu_supports_avx2 },
+    { 1, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 2, "float_x86_avx2", "x86_avx2", starch_mean_power_u16_float_x86_avx2, cpu_supports_avx2 },
+    { 3, "u64_x86_avx2", "x86_avx2", starch_mean_power_u16_u64_x86_avx2, cpu_supports_avx2 },
+    { 4, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 5, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for mean_power_u16_aligned */
+
+starch_mean_power_u16_aligned_regentry * starch_mean_power_u16_aligned_select() {
+    for (starch_mean_power_u16_aligned_regentry *entry = starch_mean_power_u16_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_mean_power_u16_aligned_dispatch ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 ) {
+    starch_mean_power_u16_aligned_regentry *entry = starch_mean_power_u16_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_mean_power_u16_aligned = entry->callable;
+    starch_mean_power_u16_aligned ( arg0, arg1, arg2, arg3 );
+}
+
+starch_mean_power_u16_aligned_ptr starch_mean_power_u16_aligned = starch_mean_power_u16_aligned_dispatch;
+
+void starch_mean_power_u16_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_mean_power_u16_aligned_regentry *entry;
+    for (entry = starch_mean_power_u16_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_mean_power_u16_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_mean_power_u16_aligned_registry, entry - starch_mean_power_u16_aligned_registry, sizeof(starch_mean_power_u16_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_mean_power_u16_aligned = starch_mean_power_u16_aligned_dispatch;
+}
+
+starch_mean_power_u16_aligned_regentry starch_mean_power_u16_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "u32_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 2, "float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "u32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_u32_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "u64_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_u64_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "neon_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_neon_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "u64_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u64_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 8, "neon_float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_neon_float_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 9, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 10, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "u32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 2, "float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "u64_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_u64_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "neon_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_neon_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "u64_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u64_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 8, "neon_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_neon_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 9, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 10, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 1, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 2, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "u32_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_u32_x86_avx2, cpu_supports_avx2 },
+    { 1, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 2, "float_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_float_x86_avx2, cpu_supports_avx2 },
+    { 3, "u64_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_u64_x86_avx2, cpu_supports_avx2 },
+    { 4, "float_x86_avx2", "x86_avx2", starch_mean_power_u16_float_x86_avx2, cpu_supports_avx2 },
+    { 5, "u32_x86_avx2", "x86_avx2", starch_mean_power_u16_u32_x86_avx2, cpu_supports_avx2 },
+    { 6, "u64_x86_avx2", "x86_avx2", starch_mean_power_u16_u64_x86_avx2, cpu_supports_avx2 },
+    { 7, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
+    { 8, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for preamble_correlate_u16 */
+
+starch_preamble_correlate_u16_regentry * starch_preamble_correlate_u16_select() {
+    for (starch_preamble_correlate_u16_regentry *entry = starch_preamble_correlate_u16_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_preamble_correlate_u16_dispatch ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 ) {
+    starch_preamble_correlate_u16_regentry *entry = starch_preamble_correlate_u16_select();
+    if (!entry)
+        abort();
+
+    starch_preamble_correlate_u16 = entry->callable;
+    starch_preamble_correlate_u16 ( arg0, arg1, arg2, arg3 );
+}
+
+starch_preamble_correlate_u16_ptr starch_preamble_correlate_u16 = starch_preamble_correlate_u16_dispatch;
+
+void starch_preamble_correlate_u16_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_preamble_correlate_u16_regentry *entry;
+    for (entry = starch_preamble_correlate_u16_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_preamble_correlate_u16_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_preamble_correlate_u16_registry, entry - starch_preamble_correlate_u16_registry, sizeof(starch_preamble_correlate_u16_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_preamble_correlate_u16 = starch_preamble_correlate_u16_dispatch;
+}
+
+starch_preamble_correlate_u16_regentry starch_preamble_correlate_u16_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_preamble_correlate_u16_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "twopass_generic", "generic", starch_preamble_correlate_u16_twopass_generic, NULL },
+    { 2, "scalar_armv8_neon_simd", "armv8_neon_simd", starch_preamble_correlate_u16_scalar_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "scalar_generic", "generic", starch_preamble_correlate_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_correlate_u16_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "twopass_generic", "generic", starch_preamble_correlate_u16_twopass_generic, NULL },
+    { 2, "scalar_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_correlate_u16_scalar_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "scalar_generic", "generic", starch_preamble_correlate_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_preamble_correlate_u16_twopass_generic, NULL },
+    { 1, "scalar_generic", "generic", starch_preamble_correlate_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2", "x86_avx2", starch_preamble_correlate_u16_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "twopass_generic", "generic", starch_preamble_correlate_u16_twopass_generic, NULL },
+    { 2, "scalar_x86_avx2", "x86_avx2", starch_preamble_correlate_u16_scalar_x86_avx2, cpu_supports_avx2 },
+    { 3, "scalar_generic", "generic", starch_preamble_correlate_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for preamble_correlate_u16_aligned */
+
+starch_preamble_correlate_u16_aligned_regentry * starch_preamble_correlate_u16_aligned_select() {
+    for (starch_preamble_correlate_u16_aligned_regentry *entry = starch_preamble_correlate_u16_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_preamble_correlate_u16_aligned_dispatch ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 ) {
+    starch_preamble_correlate_u16_aligned_regentry *entry = starch_preamble_correlate_u16_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_preamble_correlate_u16_aligned = entry->callable;
+    starch_preamble_correlate_u16_aligned ( arg0, arg1, arg2, arg3 );
+}
+
+starch_preamble_correlate_u16_aligned_ptr starch_preamble_correlate_u16_aligned = starch_preamble_correlate_u16_aligned_dispatch;
+
+void starch_preamble_correlate_u16_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_preamble_correlate_u16_aligned_regentry *entry;
+    for (entry = starch_preamble_correlate_u16_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_preamble_correlate_u16_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_preamble_correlate_u16_aligned_registry, entry - starch_preamble_correlate_u16_aligned_registry, sizeof(starch_preamble_correlate_u16_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_preamble_correlate_u16_aligned = starch_preamble_correlate_u16_aligned_dispatch;
+}
+
+starch_preamble_correlate_u16_aligned_regentry starch_preamble_correlate_u16_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "twopass_armv8_neon_simd_aligned", "armv8_neon_simd", starch_preamble_correlate_u16_aligned_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "twopass_generic", "generic", starch_preamble_correlate_u16_twopass_generic, NULL },
+    { 2, "scalar_armv8_neon_simd_aligned", "armv8_neon_simd", starch_preamble_correlate_u16_aligned_scalar_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "scalar_armv8_neon_simd", "armv8_neon_simd", starch_preamble_correlate_u16_scalar_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_preamble_correlate_u16_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "scalar_generic", "generic", starch_preamble_correlate_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "twopass_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_preamble_correlate_u16_aligned_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "twopass_generic", "generic", starch_preamble_correlate_u16_twopass_generic, NULL },
+    { 2, "scalar_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_preamble_correlate_u16_aligned_scalar_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "scalar_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_correlate_u16_scalar_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_correlate_u16_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "scalar_generic", "generic", starch_preamble_correlate_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_preamble_correlate_u16_twopass_generic, NULL },
+    { 1, "scalar_generic", "generic", starch_preamble_correlate_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2_aligned", "x86_avx2", starch_preamble_correlate_u16_aligned_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "twopass_generic", "generic", starch_preamble_correlate_u16_twopass_generic, NULL },
+    { 2, "scalar_x86_avx2_aligned", "x86_avx2", starch_preamble_correlate_u16_aligned_scalar_x86_avx2, cpu_supports_avx2 },
+    { 3, "scalar_x86_avx2", "x86_avx2", starch_preamble_correlate_u16_scalar_x86_avx2, cpu_supports_avx2 },
+    { 4, "twopass_x86_avx2", "x86_avx2", starch_preamble_correlate_u16_twopass_x86_avx2, cpu_supports_avx2 },
+    { 5, "scalar_generic", "generic", starch_preamble_correlate_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for preamble_scan_u16 */
+
+starch_preamble_scan_u16_regentry * starch_preamble_scan_u16_select() {
+    for (starch_preamble_scan_u16_regentry *entry = starch_preamble_scan_u16_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_preamble_scan_u16_dispatch ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 ) {
+    starch_preamble_scan_u16_regentry *entry = starch_preamble_scan_u16_select();
+    if (!entry)
+        abort();
+
+    starch_preamble_scan_u16 = entry->callable;
+    starch_preamble_scan_u16 ( arg0, arg1, arg2, arg3 );
+}
+
+starch_preamble_scan_u16_ptr starch_preamble_scan_u16 = starch_preamble_scan_u16_dispatch;
+
+void starch_preamble_scan_u16_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_preamble_scan_u16_regentry *entry;
+    for (entry = starch_preamble_scan_u16_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_preamble_scan_u16_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_preamble_scan_u16_registry, entry - starch_preamble_scan_u16_registry, sizeof(starch_preamble_scan_u16_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_preamble_scan_u16 = starch_preamble_scan_u16_dispatch;
+}
+
+starch_preamble_scan_u16_regentry starch_preamble_scan_u16_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u16_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "twopass_generic", "generic", starch_preamble_scan_u16_twopass_generic, NULL },
+    { 2, "scalar_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u16_scalar_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u16_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "scalar_generic", "generic", starch_preamble_scan_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u16_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "twopass_generic", "generic", starch_preamble_scan_u16_twopass_generic, NULL },
+    { 2, "scalar_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u16_scalar_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u16_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "scalar_generic", "generic", starch_preamble_scan_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_preamble_scan_u16_twopass_generic, NULL },
+    { 1, "scalar_generic", "generic", starch_preamble_scan_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2", "x86_avx2", starch_preamble_scan_u16_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "twopass_generic", "generic", starch_preamble_scan_u16_twopass_generic, NULL },
+    { 2, "scalar_x86_avx2", "x86_avx2", starch_preamble_scan_u16_scalar_x86_avx2, cpu_supports_avx2 },
+    { 3, "scalar_generic", "generic", starch_preamble_scan_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for preamble_scan_u16_aligned */
+
+starch_preamble_scan_u16_aligned_regentry * starch_preamble_scan_u16_aligned_select() {
+    for (starch_preamble_scan_u16_aligned_regentry *entry = starch_preamble_scan_u16_aligned_registry;
+         entry->name;
+         ++entry)
+    {
+        if (entry->flavor_supported && !(entry->flavor_supported()))
+            continue;
+        return entry;
+    }
+    return NULL;
+}
+
+static void starch_preamble_scan_u16_aligned_dispatch ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 ) {
+    starch_preamble_scan_u16_aligned_regentry *entry = starch_preamble_scan_u16_aligned_select();
+    if (!entry)
+        abort();
+
+    starch_preamble_scan_u16_aligned = entry->callable;
+    starch_preamble_scan_u16_aligned ( arg0, arg1, arg2, arg3 );
+}
+
+starch_preamble_scan_u16_aligned_ptr starch_preamble_scan_u16_aligned = starch_preamble_scan_u16_aligned_dispatch;
+
+void starch_preamble_scan_u16_aligned_set_wisdom (const char * const * received_wisdom)
+{
+    /* re-rank the registry based on received wisdom */
+    starch_preamble_scan_u16_aligned_regentry *entry;
+    for (entry = starch_preamble_scan_u16_aligned_registry; entry->name; ++entry) {
+        const char * const *search;
+        for (search = received_wisdom; *search; ++search) {
+            if (!strcmp(*search, entry->name)) {
+                break;
+            }
+        }
+        if (*search) {
+            /* matches an entry in the wisdom list, order by position in the list */
+            entry->rank = search - received_wisdom;
+        } else {
+            /* no match, rank after all possible matches, retaining existing order */
+            entry->rank = (search - received_wisdom) + (entry - starch_preamble_scan_u16_aligned_registry);
+        }
+    }
+
+    /* re-sort based on the new ranking */
+    qsort(starch_preamble_scan_u16_aligned_registry, entry - starch_preamble_scan_u16_aligned_registry, sizeof(starch_preamble_scan_u16_aligned_regentry), starch_regentry_rank_compare);
+
+    /* reset the implementation pointer so the next call will re-select */
+    starch_preamble_scan_u16_aligned = starch_preamble_scan_u16_aligned_dispatch;
+}
+
+starch_preamble_scan_u16_aligned_regentry starch_preamble_scan_u16_aligned_registry[] = {
+  
+#ifdef STARCH_MIX_AARCH64
+    { 0, "neon_armv8_neon_simd_aligned", "armv8_neon_simd", starch_preamble_scan_u16_aligned_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "twopass_generic", "generic", starch_preamble_scan_u16_twopass_generic, NULL },
+    { 2, "scalar_armv8_neon_simd_aligned", "armv8_neon_simd", starch_preamble_scan_u16_aligned_scalar_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "twopass_armv8_neon_simd_aligned", "armv8_neon_simd", starch_preamble_scan_u16_aligned_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "scalar_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u16_scalar_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u16_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "neon_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u16_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "scalar_generic", "generic", starch_preamble_scan_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_AARCH64 */
+  
+#ifdef STARCH_MIX_ARM
+    { 0, "neon_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_preamble_scan_u16_aligned_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "twopass_generic", "generic", starch_preamble_scan_u16_twopass_generic, NULL },
+    { 2, "scalar_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_preamble_scan_u16_aligned_scalar_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "twopass_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_preamble_scan_u16_aligned_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "scalar_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u16_scalar_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u16_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u16_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "scalar_generic", "generic", starch_preamble_scan_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_ARM */
+  
+#ifdef STARCH_MIX_GENERIC
+    { 0, "twopass_generic", "generic", starch_preamble_scan_u16_twopass_generic, NULL },
+    { 1, "scalar_generic", "generic", starch_preamble_scan_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_GENERIC */
+  
+#ifdef STARCH_MIX_X86
+    { 0, "twopass_x86_avx2_aligned", "x86_avx2", starch_preamble_scan_u16_aligned_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "twopass_generic", "generic", starch_preamble_scan_u16_twopass_generic, NULL },
+    { 2, "scalar_x86_avx2_aligned", "x86_avx2", starch_preamble_scan_u16_aligned_scalar_x86_avx2, cpu_supports_avx2 },
+    { 3, "scalar_x86_avx2", "x86_avx2", starch_preamble_scan_u16_scalar_x86_avx2, cpu_supports_avx2 },
+    { 4, "twopass_x86_avx2", "x86_avx2", starch_preamble_scan_u16_twopass_x86_avx2, cpu_supports_avx2 },
+    { 5, "scalar_generic", "generic", starch_preamble_scan_u16_scalar_generic, NULL },
+#endif /* STARCH_MIX_X86 */
+    { 0, NULL, NULL, NULL, NULL }
+};
+
+/* dispatcher / registry for preamble_scan_u8 */
 
-starch_magnitude_uc8_regentry * starch_magnitude_uc8_select() {
-    for (starch_magnitude_uc8_regentry *entry = starch_magnitude_uc8_registry;
+starch_preamble_scan_u8_regentry * starch_preamble_scan_u8_select() {
+    for (starch_preamble_scan_u8_regentry *entry = starch_preamble_scan_u8_registry;
          entry->name;
          ++entry)
     {
@@ -771,22 +2676,22 @@ starch_magnitude_uc8_regentry * starch_magnitude_uc8_select() {
     return NULL;
 }
 
-static void starch_magnitude_uc8_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 ) {
-    starch_magnitude_uc8_regentry *entry = starch_magnitude_uc8_select();
+static void starch_preamble_scan_u8_dispatch ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 ) {
+    starch_preamble_scan_u8_regentry *entry = starch_preamble_scan_u8_select();
     if (!entry)
         abort();
 
-    starch_magnitude_uc8 = entry->callable;
-    starch_magnitude_uc8 ( arg0, arg1, arg2 );
+    starch_preamble_scan_u8 = entry->callable;
+    starch_preamble_scan_u8 ( arg0, arg1, arg2, arg3 );
 }
 
-starch_magnitude_uc8_ptr starch_magnitude_uc8 = starch_magnitude_uc8_dispatch;
+starch_preamble_scan_u8_ptr starch_preamble_scan_u8 = starch_preamble_scan_u8_dispatch;
 
-void starch_magnitude_uc8_set_wisdom (const char * const * received_wisdom)
+void starch_preamble_scan_u8_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_uc8_regentry *entry;
-    for (entry = starch_magnitude_uc8_registry; entry->name; ++entry) {
+    starch_preamble_scan_u8_regentry *entry;
+    for (entry = starch_preamble_scan_u8_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -798,60 +2703,53 @@ void starch_magnitude_uc8_set_wisdom (const char * const * received_wisdom)
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_uc8_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_preamble_scan_u8_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_uc8_registry, entry - starch_magnitude_uc8_registry, sizeof(starch_magnitude_uc8_regentry), starch_regentry_rank_compare);
+    qsort(starch_preamble_scan_u8_registry, entry - starch_preamble_scan_u8_registry, sizeof(starch_preamble_scan_u8_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_uc8 = starch_magnitude_uc8_dispatch;
+    starch_preamble_scan_u8 = starch_preamble_scan_u8_dispatch;
 }
 
-starch_magnitude_uc8_regentry starch_magnitude_uc8_registry[] = {
+starch_preamble_scan_u8_regentry starch_preamble_scan_u8_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "exact_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_exact_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 6, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "neon_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u8_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "twopass_generic", "generic", starch_preamble_scan_u8_twopass_generic, NULL },
+    { 2, "scalar_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u8_scalar_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "scalar_generic", "generic", starch_preamble_scan_u8_scalar_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "exact_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 6, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u8_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "twopass_generic", "generic", starch_preamble_scan_u8_twopass_generic, NULL },
+    { 2, "scalar_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u8_scalar_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "scalar_generic", "generic", starch_preamble_scan_u8_scalar_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 1, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 2, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "twopass_generic", "generic", starch_preamble_scan_u8_twopass_generic, NULL },
+    { 1, "scalar_generic", "generic", starch_preamble_scan_u8_scalar_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_x86_avx2, cpu_supports_avx2 },
-    { 3, "exact_x86_avx2", "x86_avx2", starch_magnitude_uc8_exact_x86_avx2, cpu_supports_avx2 },
-    { 4, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 5, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "twopass_x86_avx2", "x86_avx2", starch_preamble_scan_u8_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "twopass_generic", "generic", starch_preamble_scan_u8_twopass_generic, NULL },
+    { 2, "scalar_x86_avx2", "x86_avx2", starch_preamble_scan_u8_scalar_x86_avx2, cpu_supports_avx2 },
+    { 3, "scalar_generic", "generic", starch_preamble_scan_u8_scalar_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for magnitude_uc8_aligned */
+/* dispatcher / registry for preamble_scan_u8_aligned */
 
-starch_magnitude_uc8_aligned_regentry * starch_magnitude_uc8_aligned_select() {
-    for (starch_magnitude_uc8_aligned_regentry *entry = starch_magnitude_uc8_aligned_registry;
+starch_preamble_scan_u8_aligned_regentry * starch_preamble_scan_u8_aligned_select() {
+    for (starch_preamble_scan_u8_aligned_regentry *entry = starch_preamble_scan_u8_aligned_registry;
          entry->name;
          ++entry)
     {
@@ -862,22 +2760,22 @@ starch_magnitude_uc8_aligned_regentry * starch_magnitude_uc8_aligned_select() {
     return NULL;
 }
 
-static void starch_magnitude_uc8_aligned_dispatch ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 ) {
-    starch_magnitude_uc8_aligned_regentry *entry = starch_magnitude_uc8_aligned_select();
+static void starch_preamble_scan_u8_aligned_dispatch ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 ) {
+    starch_preamble_scan_u8_aligned_regentry *entry = starch_preamble_scan_u8_aligned_select();
     if (!entry)
         abort();
 
-    starch_magnitude_uc8_aligned = entry->callable;
-    starch_magnitude_uc8_aligned ( arg0, arg1, arg2 );
+    starch_preamble_scan_u8_aligned = entry->callable;
+    starch_preamble_scan_u8_aligned ( arg0, arg1, arg2, arg3 );
 }
 
-starch_magnitude_uc8_aligned_ptr starch_magnitude_uc8_aligned = starch_magnitude_uc8_aligned_dispatch;
+starch_preamble_scan_u8_aligned_ptr starch_preamble_scan_u8_aligned = starch_preamble_scan_u8_aligned_dispatch;
 
-void starch_magnitude_uc8_aligned_set_wisdom (const char * const * received_wisdom)
+void starch_preamble_scan_u8_aligned_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_magnitude_uc8_aligned_regentry *entry;
-    for (entry = starch_magnitude_uc8_aligned_registry; entry->name; ++entry) {
+    starch_preamble_scan_u8_aligned_regentry *entry;
+    for (entry = starch_preamble_scan_u8_aligned_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -889,71 +2787,61 @@ void starch_magnitude_uc8_aligned_set_wisdom (const char * const * received_wisd
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_magnitude_uc8_aligned_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_preamble_scan_u8_aligned_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_magnitude_uc8_aligned_registry, entry - starch_magnitude_uc8_aligned_registry, sizeof(starch_magnitude_uc8_aligned_regentry), starch_regentry_rank_compare);
+    qsort(starch_preamble_scan_u8_aligned_registry, entry - starch_preamble_scan_u8_aligned_registry, sizeof(starch_preamble_scan_u8_aligned_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_magnitude_uc8_aligned = starch_magnitude_uc8_aligned_dispatch;
+    starch_preamble_scan_u8_aligned = starch_preamble_scan_u8_aligned_dispatch;
 }
 
-starch_magnitude_uc8_aligned_regentry starch_magnitude_uc8_aligned_registry[] = {
+starch_preamble_scan_u8_aligned_regentry starch_preamble_scan_u8_aligned_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "neon_vrsqrte_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "lookup_unroll_4_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "exact_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_exact_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "neon_vrsqrte_armv8_neon_simd_aligned", "armv8_neon_simd", starch_magnitude_uc8_aligned_neon_vrsqrte_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 6, "lookup_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 7, "lookup_unroll_4_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_lookup_unroll_4_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 8, "exact_armv8_neon_simd", "armv8_neon_simd", starch_magnitude_uc8_exact_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 9, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 10, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "neon_armv8_neon_simd_aligned", "armv8_neon_simd", starch_preamble_scan_u8_aligned_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "twopass_generic", "generic", starch_preamble_scan_u8_twopass_generic, NULL },
+    { 2, "scalar_armv8_neon_simd_aligned", "armv8_neon_simd", starch_preamble_scan_u8_aligned_scalar_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "twopass_armv8_neon_simd_aligned", "armv8_neon_simd", starch_preamble_scan_u8_aligned_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "scalar_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u8_scalar_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "twopass_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u8_twopass_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 6, "neon_armv8_neon_simd", "armv8_neon_simd", starch_preamble_scan_u8_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 7, "scalar_generic", "generic", starch_preamble_scan_u8_scalar_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "neon_vrsqrte_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "lookup_unroll_4_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "exact_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_magnitude_uc8_aligned_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "lookup_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 6, "lookup_unroll_4_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_lookup_unroll_4_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 7, "exact_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_exact_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 8, "neon_vrsqrte_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_magnitude_uc8_neon_vrsqrte_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 9, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 10, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "neon_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_preamble_scan_u8_aligned_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "twopass_generic", "generic", starch_preamble_scan_u8_twopass_generic, NULL },
+    { 2, "scalar_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_preamble_scan_u8_aligned_scalar_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "twopass_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_preamble_scan_u8_aligned_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "scalar_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u8_scalar_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "twopass_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u8_twopass_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 6, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_preamble_scan_u8_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 7, "scalar_generic", "generic", starch_preamble_scan_u8_scalar_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 1, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 2, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "twopass_generic", "generic", starch_preamble_scan_u8_twopass_generic, NULL },
+    { 1, "scalar_generic", "generic", starch_preamble_scan_u8_scalar_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "lookup_unroll_4_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 1, "lookup_unroll_4_generic", "generic", starch_magnitude_uc8_lookup_unroll_4_generic, NULL },
-    { 2, "lookup_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_lookup_x86_avx2, cpu_supports_avx2 },
-    { 3, "lookup_unroll_4_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_lookup_unroll_4_x86_avx2, cpu_supports_avx2 },
-    { 4, "exact_x86_avx2_aligned", "x86_avx2", starch_magnitude_uc8_aligned_exact_x86_avx2, cpu_supports_avx2 },
-    { 5, "lookup_x86_avx2", "x86_avx2", starch_magnitude_uc8_lookup_x86_avx2, cpu_supports_avx2 },
-    { 6, "exact_x86_avx2", "x86_avx2", starch_magnitude_uc8_exact_x86_avx2, cpu_supports_avx2 },
-    { 7, "lookup_generic", "generic", starch_magnitude_uc8_lookup_generic, NULL },
-    { 8, "exact_generic", "generic", starch_magnitude_uc8_exact_generic, NULL },
+    { 0, "twopass_x86_avx2", "x86_avx2", starch_preamble_scan_u8_twopass_x86_avx2, cpu_supports_avx2 },
+    { 1, "twopass_generic", "generic", starch_preamble_scan_u8_twopass_generic, NULL },
+    { 2, "scalar_x86_avx2_aligned", "x86_avx2", starch_preamble_scan_u8_aligned_scalar_x86_avx2, cpu_supports_avx2 },
+    { 3, "twopass_x86_avx2_aligned", "x86_avx2", starch_preamble_scan_u8_aligned_twopass_x86_avx2, cpu_supports_avx2 },
+    { 4, "scalar_x86_avx2", "x86_avx2", starch_preamble_scan_u8_scalar_x86_avx2, cpu_supports_avx2 },
+    { 5, "scalar_generic", "generic", starch_preamble_scan_u8_scalar_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for mean_power_u16 */
+/* dispatcher / registry for resample_polyphase_u16 */
 
-starch_mean_power_u16_regentry * starch_mean_power_u16_select() {
-    for (starch_mean_power_u16_regentry *entry = starch_mean_power_u16_registry;
+starch_resample_polyphase_u16_regentry * starch_resample_polyphase_u16_select() {
+    for (starch_resample_polyphase_u16_regentry *entry = starch_resample_polyphase_u16_registry;
          entry->name;
          ++entry)
     {
@@ -964,22 +2852,22 @@ starch_mean_power_u16_regentry * starch_mean_power_u16_select() {
     return NULL;
 }
 
-static void starch_mean_power_u16_dispatch ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 ) {
-    starch_mean_power_u16_regentry *entry = starch_mean_power_u16_select();
+static void starch_resample_polyphase_u16_dispatch ( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 ) {
+    starch_resample_polyphase_u16_regentry *entry = starch_resample_polyphase_u16_select();
     if (!entry)
         abort();
 
-    starch_mean_power_u16 = entry->callable;
-    starch_mean_power_u16 ( arg0, arg1, arg2, arg3 );
+    starch_resample_polyphase_u16 = entry->callable;
+    starch_resample_polyphase_u16 ( arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7 );
 }
 
-starch_mean_power_u16_ptr starch_mean_power_u16 = starch_mean_power_u16_dispatch;
+starch_resample_polyphase_u16_ptr starch_resample_polyphase_u16 = starch_resample_polyphase_u16_dispatch;
 
-void starch_mean_power_u16_set_wisdom (const char * const * received_wisdom)
+void starch_resample_polyphase_u16_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_mean_power_u16_regentry *entry;
-    for (entry = starch_mean_power_u16_registry; entry->name; ++entry) {
+    starch_resample_polyphase_u16_regentry *entry;
+    for (entry = starch_resample_polyphase_u16_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -991,60 +2879,53 @@ void starch_mean_power_u16_set_wisdom (const char * const * received_wisdom)
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_mean_power_u16_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_resample_polyphase_u16_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_mean_power_u16_registry, entry - starch_mean_power_u16_registry, sizeof(starch_mean_power_u16_regentry), starch_regentry_rank_compare);
+    qsort(starch_resample_polyphase_u16_registry, entry - starch_resample_polyphase_u16_registry, sizeof(starch_resample_polyphase_u16_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_mean_power_u16 = starch_mean_power_u16_dispatch;
+    starch_resample_polyphase_u16 = starch_resample_polyphase_u16_dispatch;
 }
 
-starch_mean_power_u16_regentry starch_mean_power_u16_registry[] = {
+starch_resample_polyphase_u16_regentry starch_resample_polyphase_u16_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "u32_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
-    { 2, "float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "u64_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u64_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "neon_float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_neon_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 6, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 0, "neon_vfma_armv8_neon_simd", "armv8_neon_simd", starch_resample_polyphase_u16_neon_vfma_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "generic_generic", "generic", starch_resample_polyphase_u16_generic_generic, NULL },
+    { 2, "generic_armv8_neon_simd", "armv8_neon_simd", starch_resample_polyphase_u16_generic_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "unroll8_armv8_neon_simd", "armv8_neon_simd", starch_resample_polyphase_u16_unroll8_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "unroll8_generic", "generic", starch_resample_polyphase_u16_unroll8_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
-    { 2, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "u64_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u64_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "neon_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_neon_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 6, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 0, "neon_vfma_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_resample_polyphase_u16_neon_vfma_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "generic_generic", "generic", starch_resample_polyphase_u16_generic_generic, NULL },
+    { 2, "generic_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_resample_polyphase_u16_generic_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "unroll8_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_resample_polyphase_u16_unroll8_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "unroll8_generic", "generic", starch_resample_polyphase_u16_unroll8_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
-    { 1, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 2, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 0, "generic_generic", "generic", starch_resample_polyphase_u16_generic_generic, NULL },
+    { 1, "unroll8_generic", "generic", starch_resample_polyphase_u16_unroll8_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "u32_x86_avx2", "x86_avx2", starch_mean_power_u16_u32_x86_avx2, cpu_supports_avx2 },
-    { 1, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
-    { 2, "float_x86_avx2", "x86_avx2", starch_mean_power_u16_float_x86_avx2, cpu_supports_avx2 },
-    { 3, "u64_x86_avx2", "x86_avx2", starch_mean_power_u16_u64_x86_avx2, cpu_supports_avx2 },
-    { 4, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 5, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 0, "generic_x86_avx2", "x86_avx2", starch_resample_polyphase_u16_generic_x86_avx2, cpu_supports_avx2 },
+    { 1, "generic_generic", "generic", starch_resample_polyphase_u16_generic_generic, NULL },
+    { 2, "unroll8_x86_avx2", "x86_avx2", starch_resample_polyphase_u16_unroll8_x86_avx2, cpu_supports_avx2 },
+    { 3, "unroll8_generic", "generic", starch_resample_polyphase_u16_unroll8_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
 
-/* dispatcher / registry for mean_power_u16_aligned */
+/* dispatcher / registry for slice_phases_u16 */
 
-starch_mean_power_u16_aligned_regentry * starch_mean_power_u16_aligned_select() {
-    for (starch_mean_power_u16_aligned_regentry *entry = starch_mean_power_u16_aligned_registry;
+starch_slice_phases_u16_regentry * starch_slice_phases_u16_select() {
+    for (starch_slice_phases_u16_regentry *entry = starch_slice_phases_u16_registry;
          entry->name;
          ++entry)
     {
@@ -1055,22 +2936,22 @@ starch_mean_power_u16_aligned_regentry * starch_mean_power_u16_aligned_select()
     return NULL;
 }
 
-static void starch_mean_power_u16_aligned_dispatch ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 ) {
-    starch_mean_power_u16_aligned_regentry *entry = starch_mean_power_u16_aligned_select();
+static void starch_slice_phases_u16_dispatch ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 ) {
+    starch_slice_phases_u16_regentry *entry = starch_slice_phases_u16_select();
     if (!entry)
         abort();
 
-    starch_mean_power_u16_aligned = entry->callable;
-    starch_mean_power_u16_aligned ( arg0, arg1, arg2, arg3 );
+    starch_slice_phases_u16 = entry->callable;
+    starch_slice_phases_u16 ( arg0, arg1, arg2, arg3 );
 }
 
-starch_mean_power_u16_aligned_ptr starch_mean_power_u16_aligned = starch_mean_power_u16_aligned_dispatch;
+starch_slice_phases_u16_ptr starch_slice_phases_u16 = starch_slice_phases_u16_dispatch;
 
-void starch_mean_power_u16_aligned_set_wisdom (const char * const * received_wisdom)
+void starch_slice_phases_u16_set_wisdom (const char * const * received_wisdom)
 {
     /* re-rank the registry based on received wisdom */
-    starch_mean_power_u16_aligned_regentry *entry;
-    for (entry = starch_mean_power_u16_aligned_registry; entry->name; ++entry) {
+    starch_slice_phases_u16_regentry *entry;
+    for (entry = starch_slice_phases_u16_registry; entry->name; ++entry) {
         const char * const *search;
         for (search = received_wisdom; *search; ++search) {
             if (!strcmp(*search, entry->name)) {
@@ -1082,63 +2963,52 @@ void starch_mean_power_u16_aligned_set_wisdom (const char * const * received_wis
             entry->rank = search - received_wisdom;
         } else {
             /* no match, rank after all possible matches, retaining existing order */
-            entry->rank = (search - received_wisdom) + (entry - starch_mean_power_u16_aligned_registry);
+            entry->rank = (search - received_wisdom) + (entry - starch_slice_phases_u16_registry);
         }
     }
 
     /* re-sort based on the new ranking */
-    qsort(starch_mean_power_u16_aligned_registry, entry - starch_mean_power_u16_aligned_registry, sizeof(starch_mean_power_u16_aligned_regentry), starch_regentry_rank_compare);
+    qsort(starch_slice_phases_u16_registry, entry - starch_slice_phases_u16_registry, sizeof(starch_slice_phases_u16_regentry), starch_regentry_rank_compare);
 
     /* reset the implementation pointer so the next call will re-select */
-    starch_mean_power_u16_aligned = starch_mean_power_u16_aligned_dispatch;
+    starch_slice_phases_u16 = starch_slice_phases_u16_dispatch;
 }
 
-starch_mean_power_u16_aligned_regentry starch_mean_power_u16_aligned_registry[] = {
+starch_slice_phases_u16_regentry starch_slice_phases_u16_registry[] = {
   
 #ifdef STARCH_MIX_AARCH64
-    { 0, "u32_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
-    { 2, "float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 3, "u32_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_u32_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 4, "u64_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_u64_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 5, "neon_float_armv8_neon_simd_aligned", "armv8_neon_simd", starch_mean_power_u16_aligned_neon_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 6, "float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 7, "u64_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_u64_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 8, "neon_float_armv8_neon_simd", "armv8_neon_simd", starch_mean_power_u16_neon_float_armv8_neon_simd, cpu_supports_armv8_simd },
-    { 9, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 10, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 0, "neon_armv8_neon_simd", "armv8_neon_simd", starch_slice_phases_u16_neon_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 1, "hybrid_generic", "generic", starch_slice_phases_u16_hybrid_generic, NULL },
+    { 2, "scalar_armv8_neon_simd", "armv8_neon_simd", starch_slice_phases_u16_scalar_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 3, "dense_armv8_neon_simd", "armv8_neon_simd", starch_slice_phases_u16_dense_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 4, "hybrid_armv8_neon_simd", "armv8_neon_simd", starch_slice_phases_u16_hybrid_armv8_neon_simd, cpu_supports_armv8_simd },
+    { 5, "scalar_generic", "generic", starch_slice_phases_u16_scalar_generic, NULL },
+    { 6, "dense_generic", "generic", starch_slice_phases_u16_dense_generic, NULL },
 #endif /* STARCH_MIX_AARCH64 */
   
 #ifdef STARCH_MIX_ARM
-    { 0, "u32_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 1, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
-    { 2, "float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 3, "u64_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_u64_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 4, "neon_float_armv7a_neon_vfpv4_aligned", "armv7a_neon_vfpv4", starch_mean_power_u16_aligned_neon_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 5, "float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 6, "u32_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u32_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 7, "u64_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_u64_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 8, "neon_float_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_mean_power_u16_neon_float_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
-    { 9, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 10, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
+    { 0, "neon_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_slice_phases_u16_neon_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 1, "hybrid_generic", "generic", starch_slice_phases_u16_hybrid_generic, NULL },
+    { 2, "scalar_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_slice_phases_u16_scalar_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 3, "dense_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_slice_phases_u16_dense_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 4, "hybrid_armv7a_neon_vfpv4", "armv7a_neon_vfpv4", starch_slice_phases_u16_hybrid_armv7a_neon_vfpv4, cpu_supports_armv7_neon_vfpv4 },
+    { 5, "scalar_generic", "generic", starch_slice_phases_u16_scalar_generic, NULL },
+    { 6, "dense_generic", "generic", starch_slice_phases_u16_dense_generic, NULL },
 #endif /* STARCH_MIX_ARM */
   
 #ifdef STARCH_MIX_GENERIC
-    { 0, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
-    { 1, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 2, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 0, "hybrid_generic", "generic", starch_slice_phases_u16_hybrid_generic, NULL },
+    { 1, "scalar_generic", "generic", starch_slice_phases_u16_scalar_generic, NULL },
+    { 2, "dense_generic", "generic", starch_slice_phases_u16_dense_generic, NULL },
 #endif /* STARCH_MIX_GENERIC */
   
 #ifdef STARCH_MIX_X86
-    { 0, "u32_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_u32_x86_avx2, cpu_supports_avx2 },
-    { 1, "u32_generic", "generic", starch_mean_power_u16_u32_generic, NULL },
-    { 2, "float_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_float_x86_avx2, cpu_supports_avx2 },
-    { 3, "u64_x86_avx2_aligned", "x86_avx2", starch_mean_power_u16_aligned_u64_x86_avx2, cpu_supports_avx2 },
-    { 4, "float_x86_avx2", "x86_avx2", starch_mean_power_u16_float_x86_avx2, cpu_supports_avx2 },
-    { 5, "u32_x86_avx2", "x86_avx2", starch_mean_power_u16_u32_x86_avx2, cpu_supports_avx2 },
-    { 6, "u64_x86_avx2", "x86_avx2", starch_mean_power_u16_u64_x86_avx2, cpu_supports_avx2 },
-    { 7, "float_generic", "generic", starch_mean_power_u16_float_generic, NULL },
-    { 8, "u64_generic", "generic", starch_mean_power_u16_u64_generic, NULL },
+    { 0, "hybrid_x86_avx2", "x86_avx2", starch_slice_phases_u16_hybrid_x86_avx2, cpu_supports_avx2 },
+    { 1, "hybrid_generic", "generic", starch_slice_phases_u16_hybrid_generic, NULL },
+    { 2, "scalar_x86_avx2", "x86_avx2", starch_slice_phases_u16_scalar_x86_avx2, cpu_supports_avx2 },
+    { 3, "dense_x86_avx2", "x86_avx2", starch_slice_phases_u16_dense_x86_avx2, cpu_supports_avx2 },
+    { 4, "scalar_generic", "generic", starch_slice_phases_u16_scalar_generic, NULL },
+    { 5, "dense_generic", "generic", starch_slice_phases_u16_dense_generic, NULL },
 #endif /* STARCH_MIX_X86 */
     { 0, NULL, NULL, NULL, NULL }
 };
@@ -1159,6 +3029,50 @@ int starch_read_wisdom (const char * path)
     for (starch_count_above_u16_aligned_regentry *entry = starch_count_above_u16_aligned_registry; entry->name; ++entry) {
         entry->rank = 0;
     }
+    int rank_log_histogram_u16 = 0;
+    for (starch_log_histogram_u16_regentry *entry = starch_log_histogram_u16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_sc16 = 0;
+    for (starch_magnitude_dc_sc16_regentry *entry = starch_magnitude_dc_sc16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_sc16_aligned = 0;
+    for (starch_magnitude_dc_sc16_aligned_regentry *entry = starch_magnitude_dc_sc16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_sc16q11 = 0;
+    for (starch_magnitude_dc_sc16q11_regentry *entry = starch_magnitude_dc_sc16q11_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_sc16q11_aligned = 0;
+    for (starch_magnitude_dc_sc16q11_aligned_regentry *entry = starch_magnitude_dc_sc16q11_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_uc8 = 0;
+    for (starch_magnitude_dc_uc8_regentry *entry = starch_magnitude_dc_uc8_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_dc_uc8_aligned = 0;
+    for (starch_magnitude_dc_uc8_aligned_regentry *entry = starch_magnitude_dc_uc8_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_power_sc16 = 0;
+    for (starch_magnitude_power_sc16_regentry *entry = starch_magnitude_power_sc16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_power_sc16_aligned = 0;
+    for (starch_magnitude_power_sc16_aligned_regentry *entry = starch_magnitude_power_sc16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_power_sc16q11 = 0;
+    for (starch_magnitude_power_sc16q11_regentry *entry = starch_magnitude_power_sc16q11_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_power_sc16q11_aligned = 0;
+    for (starch_magnitude_power_sc16q11_aligned_regentry *entry = starch_magnitude_power_sc16q11_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
     int rank_magnitude_power_uc8 = 0;
     for (starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
         entry->rank = 0;
@@ -1167,6 +3081,14 @@ int starch_read_wisdom (const char * path)
     for (starch_magnitude_power_uc8_aligned_regentry *entry = starch_magnitude_power_uc8_aligned_registry; entry->name; ++entry) {
         entry->rank = 0;
     }
+    int rank_magnitude_power_uc8_u8 = 0;
+    for (starch_magnitude_power_uc8_u8_regentry *entry = starch_magnitude_power_uc8_u8_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_magnitude_power_uc8_u8_aligned = 0;
+    for (starch_magnitude_power_uc8_u8_aligned_regentry *entry = starch_magnitude_power_uc8_u8_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
     int rank_magnitude_sc16 = 0;
     for (starch_magnitude_sc16_regentry *entry = starch_magnitude_sc16_registry; entry->name; ++entry) {
         entry->rank = 0;
@@ -1191,12 +3113,44 @@ int starch_read_wisdom (const char * path)
     for (starch_magnitude_uc8_aligned_regentry *entry = starch_magnitude_uc8_aligned_registry; entry->name; ++entry) {
         entry->rank = 0;
     }
-    int rank_mean_power_u16 = 0;
-    for (starch_mean_power_u16_regentry *entry = starch_mean_power_u16_registry; entry->name; ++entry) {
+    int rank_mean_power_u16 = 0;
+    for (starch_mean_power_u16_regentry *entry = starch_mean_power_u16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_mean_power_u16_aligned = 0;
+    for (starch_mean_power_u16_aligned_regentry *entry = starch_mean_power_u16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_preamble_correlate_u16 = 0;
+    for (starch_preamble_correlate_u16_regentry *entry = starch_preamble_correlate_u16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_preamble_correlate_u16_aligned = 0;
+    for (starch_preamble_correlate_u16_aligned_regentry *entry = starch_preamble_correlate_u16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_preamble_scan_u16 = 0;
+    for (starch_preamble_scan_u16_regentry *entry = starch_preamble_scan_u16_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_preamble_scan_u16_aligned = 0;
+    for (starch_preamble_scan_u16_aligned_regentry *entry = starch_preamble_scan_u16_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_preamble_scan_u8 = 0;
+    for (starch_preamble_scan_u8_regentry *entry = starch_preamble_scan_u8_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_preamble_scan_u8_aligned = 0;
+    for (starch_preamble_scan_u8_aligned_regentry *entry = starch_preamble_scan_u8_aligned_registry; entry->name; ++entry) {
+        entry->rank = 0;
+    }
+    int rank_resample_polyphase_u16 = 0;
+    for (starch_resample_polyphase_u16_regentry *entry = starch_resample_polyphase_u16_registry; entry->name; ++entry) {
         entry->rank = 0;
     }
-    int rank_mean_power_u16_aligned = 0;
-    for (starch_mean_power_u16_aligned_regentry *entry = starch_mean_power_u16_aligned_registry; entry->name; ++entry) {
+    int rank_slice_phases_u16 = 0;
+    for (starch_slice_phases_u16_regentry *entry = starch_slice_phases_u16_registry; entry->name; ++entry) {
         entry->rank = 0;
     }
 
@@ -1250,6 +3204,105 @@ int starch_read_wisdom (const char * path)
             }
             continue;
         }
+        if (!strcmp(name, "log_histogram_u16")) {
+            for (starch_log_histogram_u16_regentry *entry = starch_log_histogram_u16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_log_histogram_u16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_sc16")) {
+            for (starch_magnitude_dc_sc16_regentry *entry = starch_magnitude_dc_sc16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_sc16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_sc16_aligned")) {
+            for (starch_magnitude_dc_sc16_aligned_regentry *entry = starch_magnitude_dc_sc16_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_sc16_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_sc16q11")) {
+            for (starch_magnitude_dc_sc16q11_regentry *entry = starch_magnitude_dc_sc16q11_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_sc16q11;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_sc16q11_aligned")) {
+            for (starch_magnitude_dc_sc16q11_aligned_regentry *entry = starch_magnitude_dc_sc16q11_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_sc16q11_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_uc8")) {
+            for (starch_magnitude_dc_uc8_regentry *entry = starch_magnitude_dc_uc8_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_uc8;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_dc_uc8_aligned")) {
+            for (starch_magnitude_dc_uc8_aligned_regentry *entry = starch_magnitude_dc_uc8_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_dc_uc8_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_power_sc16")) {
+            for (starch_magnitude_power_sc16_regentry *entry = starch_magnitude_power_sc16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_power_sc16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_power_sc16_aligned")) {
+            for (starch_magnitude_power_sc16_aligned_regentry *entry = starch_magnitude_power_sc16_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_power_sc16_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_power_sc16q11")) {
+            for (starch_magnitude_power_sc16q11_regentry *entry = starch_magnitude_power_sc16q11_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_power_sc16q11;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_power_sc16q11_aligned")) {
+            for (starch_magnitude_power_sc16q11_aligned_regentry *entry = starch_magnitude_power_sc16q11_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_power_sc16q11_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
         if (!strcmp(name, "magnitude_power_uc8")) {
             for (starch_magnitude_power_uc8_regentry *entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
                 if (!strcmp(impl, entry->name)) {
@@ -1268,6 +3321,24 @@ int starch_read_wisdom (const char * path)
             }
             continue;
         }
+        if (!strcmp(name, "magnitude_power_uc8_u8")) {
+            for (starch_magnitude_power_uc8_u8_regentry *entry = starch_magnitude_power_uc8_u8_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_power_uc8_u8;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "magnitude_power_uc8_u8_aligned")) {
+            for (starch_magnitude_power_uc8_u8_aligned_regentry *entry = starch_magnitude_power_uc8_u8_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_magnitude_power_uc8_u8_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
         if (!strcmp(name, "magnitude_sc16")) {
             for (starch_magnitude_sc16_regentry *entry = starch_magnitude_sc16_registry; entry->name; ++entry) {
                 if (!strcmp(impl, entry->name)) {
@@ -1340,6 +3411,78 @@ int starch_read_wisdom (const char * path)
             }
             continue;
         }
+        if (!strcmp(name, "preamble_correlate_u16")) {
+            for (starch_preamble_correlate_u16_regentry *entry = starch_preamble_correlate_u16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_preamble_correlate_u16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "preamble_correlate_u16_aligned")) {
+            for (starch_preamble_correlate_u16_aligned_regentry *entry = starch_preamble_correlate_u16_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_preamble_correlate_u16_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "preamble_scan_u16")) {
+            for (starch_preamble_scan_u16_regentry *entry = starch_preamble_scan_u16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_preamble_scan_u16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "preamble_scan_u16_aligned")) {
+            for (starch_preamble_scan_u16_aligned_regentry *entry = starch_preamble_scan_u16_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_preamble_scan_u16_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "preamble_scan_u8")) {
+            for (starch_preamble_scan_u8_regentry *entry = starch_preamble_scan_u8_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_preamble_scan_u8;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "preamble_scan_u8_aligned")) {
+            for (starch_preamble_scan_u8_aligned_regentry *entry = starch_preamble_scan_u8_aligned_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_preamble_scan_u8_aligned;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "resample_polyphase_u16")) {
+            for (starch_resample_polyphase_u16_regentry *entry = starch_resample_polyphase_u16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_resample_polyphase_u16;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (!strcmp(name, "slice_phases_u16")) {
+            for (starch_slice_phases_u16_regentry *entry = starch_slice_phases_u16_registry; entry->name; ++entry) {
+                if (!strcmp(impl, entry->name)) {
+                    entry->rank = ++rank_slice_phases_u16;
+                    break;
+                }
+            }
+            continue;
+        }
     }
 
     if (ferror(fp)) {
@@ -1372,6 +3515,127 @@ int starch_read_wisdom (const char * path)
         /* reset the implementation pointer so the next call will re-select */
         starch_count_above_u16_aligned = starch_count_above_u16_aligned_dispatch;
     }
+    {
+        starch_log_histogram_u16_regentry *entry;
+        for (entry = starch_log_histogram_u16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_log_histogram_u16;
+        }
+        qsort(starch_log_histogram_u16_registry, entry - starch_log_histogram_u16_registry, sizeof(starch_log_histogram_u16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_log_histogram_u16 = starch_log_histogram_u16_dispatch;
+    }
+    {
+        starch_magnitude_dc_sc16_regentry *entry;
+        for (entry = starch_magnitude_dc_sc16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_sc16;
+        }
+        qsort(starch_magnitude_dc_sc16_registry, entry - starch_magnitude_dc_sc16_registry, sizeof(starch_magnitude_dc_sc16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_sc16 = starch_magnitude_dc_sc16_dispatch;
+    }
+    {
+        starch_magnitude_dc_sc16_aligned_regentry *entry;
+        for (entry = starch_magnitude_dc_sc16_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_sc16_aligned;
+        }
+        qsort(starch_magnitude_dc_sc16_aligned_registry, entry - starch_magnitude_dc_sc16_aligned_registry, sizeof(starch_magnitude_dc_sc16_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_sc16_aligned = starch_magnitude_dc_sc16_aligned_dispatch;
+    }
+    {
+        starch_magnitude_dc_sc16q11_regentry *entry;
+        for (entry = starch_magnitude_dc_sc16q11_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_sc16q11;
+        }
+        qsort(starch_magnitude_dc_sc16q11_registry, entry - starch_magnitude_dc_sc16q11_registry, sizeof(starch_magnitude_dc_sc16q11_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_sc16q11 = starch_magnitude_dc_sc16q11_dispatch;
+    }
+    {
+        starch_magnitude_dc_sc16q11_aligned_regentry *entry;
+        for (entry = starch_magnitude_dc_sc16q11_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_sc16q11_aligned;
+        }
+        qsort(starch_magnitude_dc_sc16q11_aligned_registry, entry - starch_magnitude_dc_sc16q11_aligned_registry, sizeof(starch_magnitude_dc_sc16q11_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_sc16q11_aligned = starch_magnitude_dc_sc16q11_aligned_dispatch;
+    }
+    {
+        starch_magnitude_dc_uc8_regentry *entry;
+        for (entry = starch_magnitude_dc_uc8_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_uc8;
+        }
+        qsort(starch_magnitude_dc_uc8_registry, entry - starch_magnitude_dc_uc8_registry, sizeof(starch_magnitude_dc_uc8_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_uc8 = starch_magnitude_dc_uc8_dispatch;
+    }
+    {
+        starch_magnitude_dc_uc8_aligned_regentry *entry;
+        for (entry = starch_magnitude_dc_uc8_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_dc_uc8_aligned;
+        }
+        qsort(starch_magnitude_dc_uc8_aligned_registry, entry - starch_magnitude_dc_uc8_aligned_registry, sizeof(starch_magnitude_dc_uc8_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_dc_uc8_aligned = starch_magnitude_dc_uc8_aligned_dispatch;
+    }
+    {
+        starch_magnitude_power_sc16_regentry *entry;
+        for (entry = starch_magnitude_power_sc16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_power_sc16;
+        }
+        qsort(starch_magnitude_power_sc16_registry, entry - starch_magnitude_power_sc16_registry, sizeof(starch_magnitude_power_sc16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_power_sc16 = starch_magnitude_power_sc16_dispatch;
+    }
+    {
+        starch_magnitude_power_sc16_aligned_regentry *entry;
+        for (entry = starch_magnitude_power_sc16_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_power_sc16_aligned;
+        }
+        qsort(starch_magnitude_power_sc16_aligned_registry, entry - starch_magnitude_power_sc16_aligned_registry, sizeof(starch_magnitude_power_sc16_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_power_sc16_aligned = starch_magnitude_power_sc16_aligned_dispatch;
+    }
+    {
+        starch_magnitude_power_sc16q11_regentry *entry;
+        for (entry = starch_magnitude_power_sc16q11_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_power_sc16q11;
+        }
+        qsort(starch_magnitude_power_sc16q11_registry, entry - starch_magnitude_power_sc16q11_registry, sizeof(starch_magnitude_power_sc16q11_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_power_sc16q11 = starch_magnitude_power_sc16q11_dispatch;
+    }
+    {
+        starch_magnitude_power_sc16q11_aligned_regentry *entry;
+        for (entry = starch_magnitude_power_sc16q11_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_power_sc16q11_aligned;
+        }
+        qsort(starch_magnitude_power_sc16q11_aligned_registry, entry - starch_magnitude_power_sc16q11_aligned_registry, sizeof(starch_magnitude_power_sc16q11_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_power_sc16q11_aligned = starch_magnitude_power_sc16q11_aligned_dispatch;
+    }
     {
         starch_magnitude_power_uc8_regentry *entry;
         for (entry = starch_magnitude_power_uc8_registry; entry->name; ++entry) {
@@ -1394,6 +3658,28 @@ int starch_read_wisdom (const char * path)
         /* reset the implementation pointer so the next call will re-select */
         starch_magnitude_power_uc8_aligned = starch_magnitude_power_uc8_aligned_dispatch;
     }
+    {
+        starch_magnitude_power_uc8_u8_regentry *entry;
+        for (entry = starch_magnitude_power_uc8_u8_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_power_uc8_u8;
+        }
+        qsort(starch_magnitude_power_uc8_u8_registry, entry - starch_magnitude_power_uc8_u8_registry, sizeof(starch_magnitude_power_uc8_u8_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_power_uc8_u8 = starch_magnitude_power_uc8_u8_dispatch;
+    }
+    {
+        starch_magnitude_power_uc8_u8_aligned_regentry *entry;
+        for (entry = starch_magnitude_power_uc8_u8_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_magnitude_power_uc8_u8_aligned;
+        }
+        qsort(starch_magnitude_power_uc8_u8_aligned_registry, entry - starch_magnitude_power_uc8_u8_aligned_registry, sizeof(starch_magnitude_power_uc8_u8_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_magnitude_power_uc8_u8_aligned = starch_magnitude_power_uc8_u8_aligned_dispatch;
+    }
     {
         starch_magnitude_sc16_regentry *entry;
         for (entry = starch_magnitude_sc16_registry; entry->name; ++entry) {
@@ -1482,6 +3768,94 @@ int starch_read_wisdom (const char * path)
         /* reset the implementation pointer so the next call will re-select */
         starch_mean_power_u16_aligned = starch_mean_power_u16_aligned_dispatch;
     }
+    {
+        starch_preamble_correlate_u16_regentry *entry;
+        for (entry = starch_preamble_correlate_u16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_preamble_correlate_u16;
+        }
+        qsort(starch_preamble_correlate_u16_registry, entry - starch_preamble_correlate_u16_registry, sizeof(starch_preamble_correlate_u16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_preamble_correlate_u16 = starch_preamble_correlate_u16_dispatch;
+    }
+    {
+        starch_preamble_correlate_u16_aligned_regentry *entry;
+        for (entry = starch_preamble_correlate_u16_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_preamble_correlate_u16_aligned;
+        }
+        qsort(starch_preamble_correlate_u16_aligned_registry, entry - starch_preamble_correlate_u16_aligned_registry, sizeof(starch_preamble_correlate_u16_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_preamble_correlate_u16_aligned = starch_preamble_correlate_u16_aligned_dispatch;
+    }
+    {
+        starch_preamble_scan_u16_regentry *entry;
+        for (entry = starch_preamble_scan_u16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_preamble_scan_u16;
+        }
+        qsort(starch_preamble_scan_u16_registry, entry - starch_preamble_scan_u16_registry, sizeof(starch_preamble_scan_u16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_preamble_scan_u16 = starch_preamble_scan_u16_dispatch;
+    }
+    {
+        starch_preamble_scan_u16_aligned_regentry *entry;
+        for (entry = starch_preamble_scan_u16_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_preamble_scan_u16_aligned;
+        }
+        qsort(starch_preamble_scan_u16_aligned_registry, entry - starch_preamble_scan_u16_aligned_registry, sizeof(starch_preamble_scan_u16_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_preamble_scan_u16_aligned = starch_preamble_scan_u16_aligned_dispatch;
+    }
+    {
+        starch_preamble_scan_u8_regentry *entry;
+        for (entry = starch_preamble_scan_u8_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_preamble_scan_u8;
+        }
+        qsort(starch_preamble_scan_u8_registry, entry - starch_preamble_scan_u8_registry, sizeof(starch_preamble_scan_u8_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_preamble_scan_u8 = starch_preamble_scan_u8_dispatch;
+    }
+    {
+        starch_preamble_scan_u8_aligned_regentry *entry;
+        for (entry = starch_preamble_scan_u8_aligned_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_preamble_scan_u8_aligned;
+        }
+        qsort(starch_preamble_scan_u8_aligned_registry, entry - starch_preamble_scan_u8_aligned_registry, sizeof(starch_preamble_scan_u8_aligned_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_preamble_scan_u8_aligned = starch_preamble_scan_u8_aligned_dispatch;
+    }
+    {
+        starch_resample_polyphase_u16_regentry *entry;
+        for (entry = starch_resample_polyphase_u16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_resample_polyphase_u16;
+        }
+        qsort(starch_resample_polyphase_u16_registry, entry - starch_resample_polyphase_u16_registry, sizeof(starch_resample_polyphase_u16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_resample_polyphase_u16 = starch_resample_polyphase_u16_dispatch;
+    }
+    {
+        starch_slice_phases_u16_regentry *entry;
+        for (entry = starch_slice_phases_u16_registry; entry->name; ++entry) {
+            if (!entry->rank)
+                entry->rank = ++rank_slice_phases_u16;
+        }
+        qsort(starch_slice_phases_u16_registry, entry - starch_slice_phases_u16_registry, sizeof(starch_slice_phases_u16_regentry), starch_regentry_rank_compare);
+
+        /* reset the implementation pointer so the next call will re-select */
+        starch_slice_phases_u16 = starch_slice_phases_u16_dispatch;
+    }
 
     return 0;
 }
@@ -15,11 +15,23 @@
 #define STARCH_IMPL_REQUIRES(_function,_impl,_feature) STARCH_IMPL(_function,_impl)
 
 #include "../impl/count_above_u16.c"
+#include "../impl/log_histogram_u16.c"
+#include "../impl/magnitude_dc_sc16.c"
+#include "../impl/magnitude_dc_sc16q11.c"
+#include "../impl/magnitude_dc_uc8.c"
+#include "../impl/magnitude_power_sc16.c"
+#include "../impl/magnitude_power_sc16q11.c"
 #include "../impl/magnitude_power_uc8.c"
+#include "../impl/magnitude_power_uc8_u8.c"
 #include "../impl/magnitude_sc16.c"
 #include "../impl/magnitude_sc16q11.c"
 #include "../impl/magnitude_uc8.c"
 #include "../impl/mean_power_u16.c"
+#include "../impl/preamble_correlate_u16.c"
+#include "../impl/preamble_scan_u16.c"
+#include "../impl/preamble_scan_u8.c"
+#include "../impl/resample_polyphase_u16.c"
+#include "../impl/slice_phases_u16.c"
 
 
 #undef STARCH_ALIGNMENT
@@ -35,9 +47,18 @@
 #define STARCH_IMPL_REQUIRES(_function,_impl,_feature) STARCH_IMPL(_function,_impl)
 
 #include "../impl/count_above_u16.c"
+#include "../impl/magnitude_dc_sc16.c"
+#include "../impl/magnitude_dc_sc16q11.c"
+#include "../impl/magnitude_dc_uc8.c"
+#include "../impl/magnitude_power_sc16.c"
+#include "../impl/magnitude_power_sc16q11.c"
 #include "../impl/magnitude_power_uc8.c"
+#include "../impl/magnitude_power_uc8_u8.c"
 #include "../impl/magnitude_sc16.c"
 #include "../impl/magnitude_sc16q11.c"
 #include "../impl/magnitude_uc8.c"
 #include "../impl/mean_power_u16.c"
+#include "../impl/preamble_correlate_u16.c"
+#include "../impl/preamble_scan_u16.c"
+#include "../impl/preamble_scan_u8.c"
 
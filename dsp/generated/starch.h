@@ -105,6 +105,36 @@ extern starch_magnitude_power_uc8_aligned_regentry starch_magnitude_power_uc8_al
 starch_magnitude_power_uc8_aligned_regentry * starch_magnitude_power_uc8_aligned_select();
 void starch_magnitude_power_uc8_aligned_set_wisdom( const char * const * received_wisdom );
 
+typedef void (* starch_magnitude_power_uc8_u8_ptr) ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+extern starch_magnitude_power_uc8_u8_ptr starch_magnitude_power_uc8_u8;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_magnitude_power_uc8_u8_ptr callable;
+    int (*flavor_supported)();
+} starch_magnitude_power_uc8_u8_regentry;
+
+extern starch_magnitude_power_uc8_u8_regentry starch_magnitude_power_uc8_u8_registry[];
+starch_magnitude_power_uc8_u8_regentry * starch_magnitude_power_uc8_u8_select();
+void starch_magnitude_power_uc8_u8_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_magnitude_power_uc8_u8_aligned_ptr) ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+extern starch_magnitude_power_uc8_u8_aligned_ptr starch_magnitude_power_uc8_u8_aligned;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_magnitude_power_uc8_u8_aligned_ptr callable;
+    int (*flavor_supported)();
+} starch_magnitude_power_uc8_u8_aligned_regentry;
+
+extern starch_magnitude_power_uc8_u8_aligned_regentry starch_magnitude_power_uc8_u8_aligned_registry[];
+starch_magnitude_power_uc8_u8_aligned_regentry * starch_magnitude_power_uc8_u8_aligned_select();
+void starch_magnitude_power_uc8_u8_aligned_set_wisdom( const char * const * received_wisdom );
+
 typedef void (* starch_magnitude_sc16_ptr) ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 extern starch_magnitude_sc16_ptr starch_magnitude_sc16;
 
@@ -165,6 +195,156 @@ extern starch_magnitude_sc16q11_aligned_regentry starch_magnitude_sc16q11_aligne
 starch_magnitude_sc16q11_aligned_regentry * starch_magnitude_sc16q11_aligned_select();
 void starch_magnitude_sc16q11_aligned_set_wisdom( const char * const * received_wisdom );
 
+typedef void (* starch_magnitude_power_sc16_ptr) ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+extern starch_magnitude_power_sc16_ptr starch_magnitude_power_sc16;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_magnitude_power_sc16_ptr callable;
+    int (*flavor_supported)();
+} starch_magnitude_power_sc16_regentry;
+
+extern starch_magnitude_power_sc16_regentry starch_magnitude_power_sc16_registry[];
+starch_magnitude_power_sc16_regentry * starch_magnitude_power_sc16_select();
+void starch_magnitude_power_sc16_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_magnitude_power_sc16_aligned_ptr) ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+extern starch_magnitude_power_sc16_aligned_ptr starch_magnitude_power_sc16_aligned;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_magnitude_power_sc16_aligned_ptr callable;
+    int (*flavor_supported)();
+} starch_magnitude_power_sc16_aligned_regentry;
+
+extern starch_magnitude_power_sc16_aligned_regentry starch_magnitude_power_sc16_aligned_registry[];
+starch_magnitude_power_sc16_aligned_regentry * starch_magnitude_power_sc16_aligned_select();
+void starch_magnitude_power_sc16_aligned_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_magnitude_power_sc16q11_ptr) ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+extern starch_magnitude_power_sc16q11_ptr starch_magnitude_power_sc16q11;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_magnitude_power_sc16q11_ptr callable;
+    int (*flavor_supported)();
+} starch_magnitude_power_sc16q11_regentry;
+
+extern starch_magnitude_power_sc16q11_regentry starch_magnitude_power_sc16q11_registry[];
+starch_magnitude_power_sc16q11_regentry * starch_magnitude_power_sc16q11_select();
+void starch_magnitude_power_sc16q11_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_magnitude_power_sc16q11_aligned_ptr) ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+extern starch_magnitude_power_sc16q11_aligned_ptr starch_magnitude_power_sc16q11_aligned;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_magnitude_power_sc16q11_aligned_ptr callable;
+    int (*flavor_supported)();
+} starch_magnitude_power_sc16q11_aligned_regentry;
+
+extern starch_magnitude_power_sc16q11_aligned_regentry starch_magnitude_power_sc16q11_aligned_registry[];
+starch_magnitude_power_sc16q11_aligned_regentry * starch_magnitude_power_sc16q11_aligned_select();
+void starch_magnitude_power_sc16q11_aligned_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_magnitude_dc_uc8_ptr) ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+extern starch_magnitude_dc_uc8_ptr starch_magnitude_dc_uc8;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_magnitude_dc_uc8_ptr callable;
+    int (*flavor_supported)();
+} starch_magnitude_dc_uc8_regentry;
+
+extern starch_magnitude_dc_uc8_regentry starch_magnitude_dc_uc8_registry[];
+starch_magnitude_dc_uc8_regentry * starch_magnitude_dc_uc8_select();
+void starch_magnitude_dc_uc8_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_magnitude_dc_uc8_aligned_ptr) ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+extern starch_magnitude_dc_uc8_aligned_ptr starch_magnitude_dc_uc8_aligned;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_magnitude_dc_uc8_aligned_ptr callable;
+    int (*flavor_supported)();
+} starch_magnitude_dc_uc8_aligned_regentry;
+
+extern starch_magnitude_dc_uc8_aligned_regentry starch_magnitude_dc_uc8_aligned_registry[];
+starch_magnitude_dc_uc8_aligned_regentry * starch_magnitude_dc_uc8_aligned_select();
+void starch_magnitude_dc_uc8_aligned_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_magnitude_dc_sc16_ptr) ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+extern starch_magnitude_dc_sc16_ptr starch_magnitude_dc_sc16;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_magnitude_dc_sc16_ptr callable;
+    int (*flavor_supported)();
+} starch_magnitude_dc_sc16_regentry;
+
+extern starch_magnitude_dc_sc16_regentry starch_magnitude_dc_sc16_registry[];
+starch_magnitude_dc_sc16_regentry * starch_magnitude_dc_sc16_select();
+void starch_magnitude_dc_sc16_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_magnitude_dc_sc16_aligned_ptr) ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+extern starch_magnitude_dc_sc16_aligned_ptr starch_magnitude_dc_sc16_aligned;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_magnitude_dc_sc16_aligned_ptr callable;
+    int (*flavor_supported)();
+} starch_magnitude_dc_sc16_aligned_regentry;
+
+extern starch_magnitude_dc_sc16_aligned_regentry starch_magnitude_dc_sc16_aligned_registry[];
+starch_magnitude_dc_sc16_aligned_regentry * starch_magnitude_dc_sc16_aligned_select();
+void starch_magnitude_dc_sc16_aligned_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_magnitude_dc_sc16q11_ptr) ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+extern starch_magnitude_dc_sc16q11_ptr starch_magnitude_dc_sc16q11;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_magnitude_dc_sc16q11_ptr callable;
+    int (*flavor_supported)();
+} starch_magnitude_dc_sc16q11_regentry;
+
+extern starch_magnitude_dc_sc16q11_regentry starch_magnitude_dc_sc16q11_registry[];
+starch_magnitude_dc_sc16q11_regentry * starch_magnitude_dc_sc16q11_select();
+void starch_magnitude_dc_sc16q11_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_magnitude_dc_sc16q11_aligned_ptr) ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+extern starch_magnitude_dc_sc16q11_aligned_ptr starch_magnitude_dc_sc16q11_aligned;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_magnitude_dc_sc16q11_aligned_ptr callable;
+    int (*flavor_supported)();
+} starch_magnitude_dc_sc16q11_aligned_regentry;
+
+extern starch_magnitude_dc_sc16q11_aligned_regentry starch_magnitude_dc_sc16q11_aligned_registry[];
+starch_magnitude_dc_sc16q11_aligned_regentry * starch_magnitude_dc_sc16q11_aligned_select();
+void starch_magnitude_dc_sc16q11_aligned_set_wisdom( const char * const * received_wisdom );
+
 typedef void (* starch_mean_power_u16_ptr) ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
 extern starch_mean_power_u16_ptr starch_mean_power_u16;
 
@@ -195,6 +375,141 @@ extern starch_mean_power_u16_aligned_regentry starch_mean_power_u16_aligned_regi
 starch_mean_power_u16_aligned_regentry * starch_mean_power_u16_aligned_select();
 void starch_mean_power_u16_aligned_set_wisdom( const char * const * received_wisdom );
 
+typedef void (* starch_preamble_scan_u16_ptr) ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+extern starch_preamble_scan_u16_ptr starch_preamble_scan_u16;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_preamble_scan_u16_ptr callable;
+    int (*flavor_supported)();
+} starch_preamble_scan_u16_regentry;
+
+extern starch_preamble_scan_u16_regentry starch_preamble_scan_u16_registry[];
+starch_preamble_scan_u16_regentry * starch_preamble_scan_u16_select();
+void starch_preamble_scan_u16_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_preamble_scan_u16_aligned_ptr) ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+extern starch_preamble_scan_u16_aligned_ptr starch_preamble_scan_u16_aligned;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_preamble_scan_u16_aligned_ptr callable;
+    int (*flavor_supported)();
+} starch_preamble_scan_u16_aligned_regentry;
+
+extern starch_preamble_scan_u16_aligned_regentry starch_preamble_scan_u16_aligned_registry[];
+starch_preamble_scan_u16_aligned_regentry * starch_preamble_scan_u16_aligned_select();
+void starch_preamble_scan_u16_aligned_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_preamble_scan_u8_ptr) ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+extern starch_preamble_scan_u8_ptr starch_preamble_scan_u8;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_preamble_scan_u8_ptr callable;
+    int (*flavor_supported)();
+} starch_preamble_scan_u8_regentry;
+
+extern starch_preamble_scan_u8_regentry starch_preamble_scan_u8_registry[];
+starch_preamble_scan_u8_regentry * starch_preamble_scan_u8_select();
+void starch_preamble_scan_u8_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_preamble_scan_u8_aligned_ptr) ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+extern starch_preamble_scan_u8_aligned_ptr starch_preamble_scan_u8_aligned;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_preamble_scan_u8_aligned_ptr callable;
+    int (*flavor_supported)();
+} starch_preamble_scan_u8_aligned_regentry;
+
+extern starch_preamble_scan_u8_aligned_regentry starch_preamble_scan_u8_aligned_registry[];
+starch_preamble_scan_u8_aligned_regentry * starch_preamble_scan_u8_aligned_select();
+void starch_preamble_scan_u8_aligned_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_preamble_correlate_u16_ptr) ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+extern starch_preamble_correlate_u16_ptr starch_preamble_correlate_u16;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_preamble_correlate_u16_ptr callable;
+    int (*flavor_supported)();
+} starch_preamble_correlate_u16_regentry;
+
+extern starch_preamble_correlate_u16_regentry starch_preamble_correlate_u16_registry[];
+starch_preamble_correlate_u16_regentry * starch_preamble_correlate_u16_select();
+void starch_preamble_correlate_u16_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_preamble_correlate_u16_aligned_ptr) ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+extern starch_preamble_correlate_u16_aligned_ptr starch_preamble_correlate_u16_aligned;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_preamble_correlate_u16_aligned_ptr callable;
+    int (*flavor_supported)();
+} starch_preamble_correlate_u16_aligned_regentry;
+
+extern starch_preamble_correlate_u16_aligned_regentry starch_preamble_correlate_u16_aligned_registry[];
+starch_preamble_correlate_u16_aligned_regentry * starch_preamble_correlate_u16_aligned_select();
+void starch_preamble_correlate_u16_aligned_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_slice_phases_u16_ptr) ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+extern starch_slice_phases_u16_ptr starch_slice_phases_u16;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_slice_phases_u16_ptr callable;
+    int (*flavor_supported)();
+} starch_slice_phases_u16_regentry;
+
+extern starch_slice_phases_u16_regentry starch_slice_phases_u16_registry[];
+starch_slice_phases_u16_regentry * starch_slice_phases_u16_select();
+void starch_slice_phases_u16_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_log_histogram_u16_ptr) ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+extern starch_log_histogram_u16_ptr starch_log_histogram_u16;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_log_histogram_u16_ptr callable;
+    int (*flavor_supported)();
+} starch_log_histogram_u16_regentry;
+
+extern starch_log_histogram_u16_regentry starch_log_histogram_u16_registry[];
+starch_log_histogram_u16_regentry * starch_log_histogram_u16_select();
+void starch_log_histogram_u16_set_wisdom( const char * const * received_wisdom );
+
+typedef void (* starch_resample_polyphase_u16_ptr) ( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 );
+extern starch_resample_polyphase_u16_ptr starch_resample_polyphase_u16;
+
+typedef struct {
+    int rank;
+    const char *name;
+    const char *flavor;
+    starch_resample_polyphase_u16_ptr callable;
+    int (*flavor_supported)();
+} starch_resample_polyphase_u16_regentry;
+
+extern starch_resample_polyphase_u16_regentry starch_resample_polyphase_u16_registry[];
+starch_resample_polyphase_u16_regentry * starch_resample_polyphase_u16_select();
+void starch_resample_polyphase_u16_set_wisdom( const char * const * received_wisdom );
+
 typedef void (* starch_count_above_u16_ptr) ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
 extern starch_count_above_u16_ptr starch_count_above_u16;
 
@@ -229,14 +544,19 @@ void starch_count_above_u16_aligned_set_wisdom( const char * const * received_wi
 
 #ifdef STARCH_FLAVOR_ARMV7A_NEON_VFPV4
 int cpu_supports_armv7_neon_vfpv4 (void);
-void starch_mean_power_u16_float_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_aligned_float_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_u32_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_aligned_u32_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_u64_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_aligned_u64_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_neon_float_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_aligned_neon_float_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_count_above_u16_generic_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_count_above_u16_aligned_generic_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_count_above_u16_neon_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_count_above_u16_aligned_neon_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_log_histogram_u16_clz_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+void starch_log_histogram_u16_clz_lanes_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+void starch_log_histogram_u16_float_bits_lanes_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+void starch_preamble_scan_u8_scalar_armv7a_neon_vfpv4 ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_aligned_scalar_armv7a_neon_vfpv4 ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_twopass_armv7a_neon_vfpv4 ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_aligned_twopass_armv7a_neon_vfpv4 ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_neon_armv7a_neon_vfpv4 ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_aligned_neon_armv7a_neon_vfpv4 ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 void starch_magnitude_power_uc8_twopass_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_aligned_twopass_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_lookup_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
@@ -245,14 +565,12 @@ void starch_magnitude_power_uc8_lookup_unroll_4_armv7a_neon_vfpv4 ( const uc8_t
 void starch_magnitude_power_uc8_aligned_lookup_unroll_4_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_neon_vrsqrte_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
-void starch_magnitude_uc8_lookup_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_aligned_lookup_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_lookup_unroll_4_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_aligned_lookup_unroll_4_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_exact_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_aligned_exact_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_neon_vrsqrte_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_preamble_scan_u16_scalar_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_aligned_scalar_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_twopass_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_aligned_twopass_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_neon_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_aligned_neon_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 void starch_magnitude_sc16q11_exact_u32_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_aligned_exact_u32_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_exact_float_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
@@ -263,30 +581,99 @@ void starch_magnitude_sc16q11_12bit_table_armv7a_neon_vfpv4 ( const sc16_t * arg
 void starch_magnitude_sc16q11_aligned_12bit_table_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_aligned_neon_vrsqrte_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_count_above_u16_generic_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
-void starch_count_above_u16_aligned_generic_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
-void starch_count_above_u16_neon_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
-void starch_count_above_u16_aligned_neon_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_mean_power_u16_float_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_aligned_float_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_u32_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_aligned_u32_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_u64_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_aligned_u64_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_neon_float_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_aligned_neon_float_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_resample_polyphase_u16_generic_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 );
+void starch_resample_polyphase_u16_unroll8_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 );
+void starch_resample_polyphase_u16_neon_vfma_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 );
+void starch_magnitude_dc_sc16q11_exact_float_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_aligned_exact_float_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_exact_float_s32_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_aligned_exact_float_s32_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_aligned_neon_vrsqrte_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_slice_phases_u16_scalar_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_slice_phases_u16_dense_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_slice_phases_u16_hybrid_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_slice_phases_u16_neon_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_magnitude_power_sc16q11_twopass_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_aligned_twopass_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_exact_float_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_aligned_exact_float_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_11bit_table_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_aligned_11bit_table_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_neon_vrsqrte_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_aligned_neon_vrsqrte_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_twopass_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_aligned_twopass_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_exact_float_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_aligned_exact_float_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_neon_vrsqrte_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_aligned_neon_vrsqrte_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_lookup_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_aligned_lookup_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_lookup_unroll_4_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_aligned_lookup_unroll_4_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_exact_float_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_aligned_exact_float_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_preamble_correlate_u16_scalar_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_correlate_u16_aligned_scalar_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_correlate_u16_twopass_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_correlate_u16_aligned_twopass_armv7a_neon_vfpv4 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_magnitude_dc_uc8_exact_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_aligned_exact_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_exact_u32_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_aligned_exact_u32_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_neon_vrsqrte_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_uc8_lookup_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_aligned_lookup_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_lookup_unroll_4_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_aligned_lookup_unroll_4_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_exact_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_aligned_exact_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_neon_vrsqrte_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_aligned_neon_vrsqrte_armv7a_neon_vfpv4 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_exact_u32_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_aligned_exact_u32_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_exact_float_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_aligned_exact_float_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_neon_vrsqrte_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_aligned_neon_vrsqrte_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_dc_sc16_exact_float_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_aligned_exact_float_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_exact_float_s32_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_aligned_exact_float_s32_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_neon_vrsqrte_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_aligned_neon_vrsqrte_armv7a_neon_vfpv4 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
 #endif /* STARCH_FLAVOR_ARMV7A_NEON_VFPV4 */
 
 int starch_read_wisdom (const char * path);
 
+/* benchmark app entry point, only present when linking $(STARCH_BENCHMARK_LIB_OBJ) */
+int starch_benchmark_main (int argc, char **argv);
+
 #ifdef STARCH_FLAVOR_ARMV8_NEON_SIMD
 int cpu_supports_armv8_simd (void);
-void starch_mean_power_u16_float_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_aligned_float_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_u32_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_aligned_u32_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_u64_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_aligned_u64_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_neon_float_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_aligned_neon_float_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_count_above_u16_generic_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_count_above_u16_aligned_generic_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_count_above_u16_neon_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_count_above_u16_aligned_neon_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_log_histogram_u16_clz_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+void starch_log_histogram_u16_clz_lanes_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+void starch_log_histogram_u16_float_bits_lanes_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+void starch_preamble_scan_u8_scalar_armv8_neon_simd ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_aligned_scalar_armv8_neon_simd ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_twopass_armv8_neon_simd ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_aligned_twopass_armv8_neon_simd ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_neon_armv8_neon_simd ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_aligned_neon_armv8_neon_simd ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 void starch_magnitude_power_uc8_twopass_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_aligned_twopass_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_lookup_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
@@ -295,14 +682,12 @@ void starch_magnitude_power_uc8_lookup_unroll_4_armv8_neon_simd ( const uc8_t *
 void starch_magnitude_power_uc8_aligned_lookup_unroll_4_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_neon_vrsqrte_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_aligned_neon_vrsqrte_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
-void starch_magnitude_uc8_lookup_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_aligned_lookup_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_lookup_unroll_4_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_aligned_lookup_unroll_4_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_exact_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_aligned_exact_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_neon_vrsqrte_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_aligned_neon_vrsqrte_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_preamble_scan_u16_scalar_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_aligned_scalar_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_twopass_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_aligned_twopass_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_neon_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_aligned_neon_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 void starch_magnitude_sc16q11_exact_u32_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_aligned_exact_u32_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_exact_float_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
@@ -313,61 +698,157 @@ void starch_magnitude_sc16q11_12bit_table_armv8_neon_simd ( const sc16_t * arg0,
 void starch_magnitude_sc16q11_aligned_12bit_table_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_neon_vrsqrte_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_aligned_neon_vrsqrte_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_count_above_u16_generic_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
-void starch_count_above_u16_aligned_generic_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
-void starch_count_above_u16_neon_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
-void starch_count_above_u16_aligned_neon_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_mean_power_u16_float_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_aligned_float_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_u32_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_aligned_u32_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_u64_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_aligned_u64_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_neon_float_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_aligned_neon_float_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_resample_polyphase_u16_generic_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 );
+void starch_resample_polyphase_u16_unroll8_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 );
+void starch_resample_polyphase_u16_neon_vfma_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 );
+void starch_magnitude_dc_sc16q11_exact_float_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_aligned_exact_float_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_exact_float_s32_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_aligned_exact_float_s32_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_neon_vrsqrte_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_aligned_neon_vrsqrte_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_slice_phases_u16_scalar_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_slice_phases_u16_dense_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_slice_phases_u16_hybrid_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_slice_phases_u16_neon_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_magnitude_power_sc16q11_twopass_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_aligned_twopass_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_exact_float_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_aligned_exact_float_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_11bit_table_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_aligned_11bit_table_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_neon_vrsqrte_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_aligned_neon_vrsqrte_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_twopass_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_aligned_twopass_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_exact_float_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_aligned_exact_float_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_neon_vrsqrte_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_aligned_neon_vrsqrte_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_lookup_armv8_neon_simd ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_aligned_lookup_armv8_neon_simd ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_lookup_unroll_4_armv8_neon_simd ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_aligned_lookup_unroll_4_armv8_neon_simd ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_exact_float_armv8_neon_simd ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_aligned_exact_float_armv8_neon_simd ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_preamble_correlate_u16_scalar_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_correlate_u16_aligned_scalar_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_correlate_u16_twopass_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_correlate_u16_aligned_twopass_armv8_neon_simd ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_magnitude_dc_uc8_exact_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_aligned_exact_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_exact_u32_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_aligned_exact_u32_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_neon_vrsqrte_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_aligned_neon_vrsqrte_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_uc8_lookup_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_aligned_lookup_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_lookup_unroll_4_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_aligned_lookup_unroll_4_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_exact_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_aligned_exact_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_neon_vrsqrte_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_aligned_neon_vrsqrte_armv8_neon_simd ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_exact_u32_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_aligned_exact_u32_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_exact_float_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_aligned_exact_float_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_neon_vrsqrte_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_aligned_neon_vrsqrte_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_dc_sc16_exact_float_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_aligned_exact_float_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_exact_float_s32_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_aligned_exact_float_s32_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_neon_vrsqrte_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_aligned_neon_vrsqrte_armv8_neon_simd ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
 #endif /* STARCH_FLAVOR_ARMV8_NEON_SIMD */
 
 int starch_read_wisdom (const char * path);
 
+/* benchmark app entry point, only present when linking $(STARCH_BENCHMARK_LIB_OBJ) */
+int starch_benchmark_main (int argc, char **argv);
+
 #ifdef STARCH_FLAVOR_GENERIC
-void starch_mean_power_u16_float_generic ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_u32_generic ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_u64_generic ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_count_above_u16_generic_generic ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_log_histogram_u16_clz_generic ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+void starch_log_histogram_u16_clz_lanes_generic ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+void starch_log_histogram_u16_float_bits_lanes_generic ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+void starch_preamble_scan_u8_scalar_generic ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_twopass_generic ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 void starch_magnitude_power_uc8_twopass_generic ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_lookup_generic ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_lookup_unroll_4_generic ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
-void starch_magnitude_uc8_lookup_generic ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_lookup_unroll_4_generic ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_exact_generic ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_preamble_scan_u16_scalar_generic ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_twopass_generic ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 void starch_magnitude_sc16q11_exact_u32_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_exact_float_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_11bit_table_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_12bit_table_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_count_above_u16_generic_generic ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_mean_power_u16_float_generic ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_u32_generic ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_u64_generic ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_resample_polyphase_u16_generic_generic ( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 );
+void starch_resample_polyphase_u16_unroll8_generic ( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 );
+void starch_magnitude_dc_sc16q11_exact_float_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_exact_float_s32_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_slice_phases_u16_scalar_generic ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_slice_phases_u16_dense_generic ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_slice_phases_u16_hybrid_generic ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_magnitude_power_sc16q11_twopass_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_exact_float_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_11bit_table_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_twopass_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_exact_float_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_lookup_generic ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_lookup_unroll_4_generic ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_exact_float_generic ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_preamble_correlate_u16_scalar_generic ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_correlate_u16_twopass_generic ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_magnitude_dc_uc8_exact_generic ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_exact_u32_generic ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_uc8_lookup_generic ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_lookup_unroll_4_generic ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_exact_generic ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_exact_u32_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_exact_float_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_dc_sc16_exact_float_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_exact_float_s32_generic ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
 #endif /* STARCH_FLAVOR_GENERIC */
 
 int starch_read_wisdom (const char * path);
 
+/* benchmark app entry point, only present when linking $(STARCH_BENCHMARK_LIB_OBJ) */
+int starch_benchmark_main (int argc, char **argv);
+
 #ifdef STARCH_FLAVOR_X86_AVX2
 int cpu_supports_avx2 (void);
-void starch_mean_power_u16_float_x86_avx2 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_aligned_float_x86_avx2 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_u32_x86_avx2 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_aligned_u32_x86_avx2 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_u64_x86_avx2 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
-void starch_mean_power_u16_aligned_u64_x86_avx2 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_count_above_u16_generic_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_count_above_u16_aligned_generic_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_log_histogram_u16_clz_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+void starch_log_histogram_u16_clz_lanes_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+void starch_log_histogram_u16_float_bits_lanes_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2 );
+void starch_preamble_scan_u8_scalar_x86_avx2 ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_aligned_scalar_x86_avx2 ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_twopass_x86_avx2 ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u8_aligned_twopass_x86_avx2 ( const uint8_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 void starch_magnitude_power_uc8_twopass_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_aligned_twopass_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_lookup_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_aligned_lookup_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_lookup_unroll_4_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
 void starch_magnitude_power_uc8_aligned_lookup_unroll_4_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
-void starch_magnitude_uc8_lookup_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_aligned_lookup_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_lookup_unroll_4_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_aligned_lookup_unroll_4_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_exact_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_magnitude_uc8_aligned_exact_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_preamble_scan_u16_scalar_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_aligned_scalar_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_twopass_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_scan_u16_aligned_twopass_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
 void starch_magnitude_sc16q11_exact_u32_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_aligned_exact_u32_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_exact_float_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
@@ -376,13 +857,63 @@ void starch_magnitude_sc16q11_11bit_table_x86_avx2 ( const sc16_t * arg0, uint16
 void starch_magnitude_sc16q11_aligned_11bit_table_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_12bit_table_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16q11_aligned_12bit_table_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
-void starch_count_above_u16_generic_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
-void starch_count_above_u16_aligned_generic_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint16_t arg2, unsigned * arg3 );
+void starch_mean_power_u16_float_x86_avx2 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_aligned_float_x86_avx2 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_u32_x86_avx2 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_aligned_u32_x86_avx2 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_u64_x86_avx2 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_mean_power_u16_aligned_u64_x86_avx2 ( const uint16_t * arg0, unsigned arg1, double * arg2, double * arg3 );
+void starch_resample_polyphase_u16_generic_x86_avx2 ( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 );
+void starch_resample_polyphase_u16_unroll8_x86_avx2 ( const uint16_t * arg0, unsigned arg1, unsigned arg2, const float * arg3, const unsigned * arg4, unsigned arg5, unsigned arg6, uint16_t * arg7 );
+void starch_magnitude_dc_sc16q11_exact_float_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_aligned_exact_float_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_exact_float_s32_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16q11_aligned_exact_float_s32_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_slice_phases_u16_scalar_x86_avx2 ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_slice_phases_u16_dense_x86_avx2 ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_slice_phases_u16_hybrid_x86_avx2 ( const uint16_t * arg0, unsigned arg1, unsigned arg2, uint8_t * arg3 );
+void starch_magnitude_power_sc16q11_twopass_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_aligned_twopass_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_exact_float_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_aligned_exact_float_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_11bit_table_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16q11_aligned_11bit_table_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_twopass_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_aligned_twopass_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_exact_float_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_sc16_aligned_exact_float_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_lookup_x86_avx2 ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_aligned_lookup_x86_avx2 ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_lookup_unroll_4_x86_avx2 ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_aligned_lookup_unroll_4_x86_avx2 ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_exact_float_x86_avx2 ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_magnitude_power_uc8_u8_aligned_exact_float_x86_avx2 ( const uc8_t * arg0, uint8_t * arg1, unsigned arg2, double * arg3, double * arg4 );
+void starch_preamble_correlate_u16_scalar_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_correlate_u16_aligned_scalar_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_correlate_u16_twopass_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_preamble_correlate_u16_aligned_twopass_x86_avx2 ( const uint16_t * arg0, unsigned arg1, uint32_t * arg2, unsigned * arg3 );
+void starch_magnitude_dc_uc8_exact_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_aligned_exact_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_exact_u32_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_uc8_aligned_exact_u32_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_uc8_lookup_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_aligned_lookup_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_lookup_unroll_4_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_aligned_lookup_unroll_4_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_exact_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_uc8_aligned_exact_x86_avx2 ( const uc8_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_exact_u32_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_aligned_exact_u32_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_exact_float_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
 void starch_magnitude_sc16_aligned_exact_float_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2 );
+void starch_magnitude_dc_sc16_exact_float_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_aligned_exact_float_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_exact_float_s32_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
+void starch_magnitude_dc_sc16_aligned_exact_float_s32_x86_avx2 ( const sc16_t * arg0, uint16_t * arg1, unsigned arg2, dc_offset_t * arg3 );
 #endif /* STARCH_FLAVOR_X86_AVX2 */
 
 int starch_read_wisdom (const char * path);
 
+/* benchmark app entry point, only present when linking $(STARCH_BENCHMARK_LIB_OBJ) */
+int starch_benchmark_main (int argc, char **argv);
+
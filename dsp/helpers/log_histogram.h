@@ -0,0 +1,52 @@
+#ifndef DSP_LOG_HISTOGRAM_H
+#define DSP_LOG_HISTOGRAM_H
+
+#include <inttypes.h>
+
+// A 12-bit, log-spaced histogram of uint16_t values, as built by the
+// log_histogram_u16 kernel.
+//
+// Values below 1024 each have their own bucket. Above that, each power
+// of two is split into 512 buckets, so a bucket covers at most 1/512 of
+// its value (about 0.017dB).
+//
+// Each bucket has LOG_HISTOGRAM_LANES counters, stored together; the count
+// for a bucket is the sum of its lanes. Implementations may spread
+// consecutive samples over the lanes so that runs of similar values don't
+// serialize on a single counter.
+
+#define LOG_HISTOGRAM_BUCKETS 4096
+#define LOG_HISTOGRAM_LANES 4
+#define LOG_HISTOGRAM_SIZE (LOG_HISTOGRAM_BUCKETS * LOG_HISTOGRAM_LANES)
+
+// Return the bucket for value 'v'
+static inline unsigned log_histogram_bucket(uint16_t v)
+{
+    if (v < 1024)
+        return v;
+
+    unsigned shift = 31 - __builtin_clz(v) - 9;
+    return (shift << 9) + (v >> shift);
+}
+
+// Return the smallest value that falls into bucket 'bucket'
+static inline uint16_t log_histogram_value(unsigned bucket)
+{
+    if (bucket < 1024)
+        return bucket;
+
+    unsigned shift = (bucket >> 9) - 1;
+    return (bucket - (shift << 9)) << shift;
+}
+
+// Return the total count in bucket 'bucket' of 'histogram'
+static inline uint32_t log_histogram_count(const uint32_t *histogram, unsigned bucket)
+{
+    const uint32_t *lanes = &histogram[bucket * LOG_HISTOGRAM_LANES];
+    uint32_t count = 0;
+    for (unsigned lane = 0; lane < LOG_HISTOGRAM_LANES; ++lane)
+        count += lanes[lane];
+    return count;
+}
+
+#endif
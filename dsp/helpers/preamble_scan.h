@@ -0,0 +1,121 @@
+#ifndef DSP_PREAMBLE_SCAN_H
+#define DSP_PREAMBLE_SCAN_H
+
+#include <inttypes.h>
+
+// Preamble tests shared by the preamble_scan_u16 and preamble_scan_u8
+// kernels. "p" points at the first of 19 preamble samples.
+
+// The cheap part of the test: edges plus any of the five peak patterns.
+// Branch-free so that it vectorizes.
+static inline unsigned preamble_scan_quick(const uint16_t *p)
+{
+    unsigned edge = (p[0] < p[1]) & (p[12] > p[13]);
+    unsigned ph3 = (p[1] > p[2]) & (p[2] < p[3]) & (p[3] > p[4]) & (p[8] < p[9]) & (p[9] > p[10]) & (p[10] < p[11]);
+    unsigned ph4 = (p[1] > p[2]) & (p[2] < p[3]) & (p[3] > p[4]) & (p[8] < p[9]) & (p[9] > p[10]) & (p[11] < p[12]);
+    unsigned ph5 = (p[1] > p[2]) & (p[2] < p[3]) & (p[4] > p[5]) & (p[8] < p[9]) & (p[10] > p[11]) & (p[11] < p[12]);
+    unsigned ph6 = (p[1] > p[2]) & (p[3] < p[4]) & (p[4] > p[5]) & (p[9] < p[10]) & (p[10] > p[11]) & (p[11] < p[12]);
+    unsigned ph7 = (p[2] > p[3]) & (p[3] < p[4]) & (p[4] > p[5]) & (p[9] < p[10]) & (p[10] > p[11]) & (p[11] < p[12]);
+    return edge & (ph3 | ph4 | ph5 | ph6 | ph7);
+}
+
+// The same on 8-bit samples: twice as many lanes per vector
+static inline unsigned preamble_scan_quick_u8(const uint8_t *p)
+{
+    unsigned edge = (p[0] < p[1]) & (p[12] > p[13]);
+    unsigned ph3 = (p[1] > p[2]) & (p[2] < p[3]) & (p[3] > p[4]) & (p[8] < p[9]) & (p[9] > p[10]) & (p[10] < p[11]);
+    unsigned ph4 = (p[1] > p[2]) & (p[2] < p[3]) & (p[3] > p[4]) & (p[8] < p[9]) & (p[9] > p[10]) & (p[11] < p[12]);
+    unsigned ph5 = (p[1] > p[2]) & (p[2] < p[3]) & (p[4] > p[5]) & (p[8] < p[9]) & (p[10] > p[11]) & (p[11] < p[12]);
+    unsigned ph6 = (p[1] > p[2]) & (p[3] < p[4]) & (p[4] > p[5]) & (p[9] < p[10]) & (p[10] > p[11]) & (p[11] < p[12]);
+    unsigned ph7 = (p[2] > p[3]) & (p[3] < p[4]) & (p[4] > p[5]) & (p[9] < p[10]) & (p[10] > p[11]) & (p[11] < p[12]);
+    return edge & (ph3 | ph4 | ph5 | ph6 | ph7);
+}
+
+// The full test, exactly as done by demodulate2400
+static inline int preamble_scan_full(const uint16_t *preamble)
+{
+    int high;
+    uint32_t base_signal, base_noise;
+
+    if (! (preamble[0] < preamble[1] && preamble[12] > preamble[13]) )
+        return 0;
+
+    if (preamble[1] > preamble[2] &&                                       // 1
+        preamble[2] < preamble[3] && preamble[3] > preamble[4] &&          // 3
+        preamble[8] < preamble[9] && preamble[9] > preamble[10] &&         // 9
+        preamble[10] < preamble[11]) {                                     // 11-12
+        // peaks at 1,3,9,11-12: phase 3
+        high = (preamble[1] + preamble[3] + preamble[9] + preamble[11] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[3] + preamble[9];
+        base_noise = preamble[5] + preamble[6] + preamble[7];
+    } else if (preamble[1] > preamble[2] &&                                // 1
+               preamble[2] < preamble[3] && preamble[3] > preamble[4] &&   // 3
+               preamble[8] < preamble[9] && preamble[9] > preamble[10] &&  // 9
+               preamble[11] < preamble[12]) {                              // 12
+        // peaks at 1,3,9,12: phase 4
+        high = (preamble[1] + preamble[3] + preamble[9] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[3] + preamble[9] + preamble[12];
+        base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
+    } else if (preamble[1] > preamble[2] &&                                // 1
+               preamble[2] < preamble[3] && preamble[4] > preamble[5] &&   // 3-4
+               preamble[8] < preamble[9] && preamble[10] > preamble[11] && // 9-10
+               preamble[11] < preamble[12]) {                              // 12
+        // peaks at 1,3-4,9-10,12: phase 5
+        high = (preamble[1] + preamble[3] + preamble[4] + preamble[9] + preamble[10] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[12];
+        base_noise = preamble[6] + preamble[7];
+    } else if (preamble[1] > preamble[2] &&                                 // 1
+               preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
+               preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
+               preamble[11] < preamble[12]) {                               // 12
+        // peaks at 1,4,10,12: phase 6
+        high = (preamble[1] + preamble[4] + preamble[10] + preamble[12]) / 4;
+        base_signal = preamble[1] + preamble[4] + preamble[10] + preamble[12];
+        base_noise = preamble[5] + preamble[6] + preamble[7] + preamble[8];
+    } else if (preamble[2] > preamble[3] &&                                 // 1-2
+               preamble[3] < preamble[4] && preamble[4] > preamble[5] &&    // 4
+               preamble[9] < preamble[10] && preamble[10] > preamble[11] && // 10
+               preamble[11] < preamble[12]) {                               // 12
+        // peaks at 1-2,4,10,12: phase 7
+        high = (preamble[1] + preamble[2] + preamble[4] + preamble[10] + preamble[12]) / 4;
+        base_signal = preamble[4] + preamble[10] + preamble[12];
+        base_noise = preamble[6] + preamble[7] + preamble[8];
+    } else {
+        // no suitable peaks
+        return 0;
+    }
+
+    // Check for enough signal
+    if (base_signal * 2 < 3 * base_noise) // about 3.5dB SNR
+        return 0;
+
+    // Check that the "quiet" bits 6,7,15,16,17 are actually quiet
+    if (preamble[5] >= high ||
+        preamble[6] >= high ||
+        preamble[7] >= high ||
+        preamble[8] >= high ||
+        preamble[14] >= high ||
+        preamble[15] >= high ||
+        preamble[16] >= high ||
+        preamble[17] >= high ||
+        preamble[18] >= high) {
+        return 0;
+    }
+
+    return 1;
+}
+
+// The full test on 8-bit samples. Most offsets fail the edge test, so do
+// that before widening.
+static inline int preamble_scan_full_u8(const uint8_t *p)
+{
+    if (! (p[0] < p[1] && p[12] > p[13]) )
+        return 0;
+
+    uint16_t wide[19];
+    for (unsigned k = 0; k < 19; ++k)
+        wide[k] = p[k];
+    return preamble_scan_full(wide);
+}
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef DSP_SLICE_CORRELATE_H
+#define DSP_SLICE_CORRELATE_H
+
+#include <inttypes.h>
+
+// The correlation functions that slice one Mode S data bit out of 2.4MHz
+// magnitude samples, shared by the slice_phases_u16 kernel and the
+// demodulator's per-bit confidence. "m" points at the sample where the bit
+// starts, "phase" (0..4) is its sub-sample phase; the bit is a 1 if the
+// result is positive, and the magnitude of the result is the slicer margin.
+
+// TODO check if there are better (or more balanced) correlation functions to use here
+
+// nb: the correlation functions sum to zero, so we do not need to adjust for
+// the DC offset in the input signal (adding any constant value to all of
+// m[0..3] does not change the result)
+static inline int slice_correlate(const uint16_t *m, unsigned phase)
+{
+    switch (phase) {
+    case 0: return 5 * m[0] - 3 * m[1] - 2 * m[2];
+    case 1: return 4 * m[0] - m[1] - 3 * m[2];
+    case 2: return 3 * m[0] + m[1] - 4 * m[2];
+    case 3: return 2 * m[0] + 3 * m[1] - 5 * m[2];
+    default: return m[0] + 5 * m[1] - 5 * m[2] - m[3];
+    }
+}
+
+#endif /* DSP_SLICE_CORRELATE_H */
@@ -40,6 +40,41 @@ const uint16_t * get_uc8_mag_table()
     return table;
 }
 
+// As get_uc8_mag_table, scaled to 0..255 (--demod-u8)
+const uint8_t * get_uc8_mag8_table()
+{
+    static uint8_t *table = NULL;
+
+    if (!table) {
+        table = malloc(sizeof(uint8_t) * 256 * 256);
+        if (!table) {
+            fprintf(stderr, "can't allocate UC8 8-bit conversion lookup table\n");
+            abort();
+        }
+
+        for (int i = 0; i <= 255; i++) {
+            for (int q = 0; q <= 255; q++) {
+                float fI, fQ, magsq;
+
+                fI = (i - 127.4) / 128;
+                fQ = (q - 127.4) / 128;
+                magsq = fI * fI + fQ * fQ;
+
+                float mag = round(sqrtf(magsq) * 256.0f);
+                if (mag > 255)
+                    mag = 255;
+
+                uc8_u16_t u;
+                u.uc8.I = i;
+                u.uc8.Q = q;
+                table[u.u16] = mag;
+            }
+        }
+    }
+
+    return table;
+}
+
 const uint16_t * get_sc16q11_mag_11bit_table()
 {
     static uint16_t *table = NULL;
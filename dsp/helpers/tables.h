@@ -4,6 +4,7 @@
 #include <inttypes.h>
 
 const uint16_t * get_uc8_mag_table();
+const uint8_t * get_uc8_mag8_table();
 const uint16_t * get_sc16q11_mag_11bit_table();
 const uint16_t * get_sc16q11_mag_12bit_table();
 
@@ -0,0 +1,69 @@
+#include <string.h>
+
+#include "dsp/helpers/log_histogram.h"
+
+/*
+ * Add each value in a uint16_t buffer to a log-spaced histogram
+ * of LOG_HISTOGRAM_SIZE counters (see dsp/helpers/log_histogram.h)
+ */
+
+void STARCH_IMPL(log_histogram_u16, clz) (const uint16_t *in, unsigned len, uint32_t *histogram)
+{
+    while (len--) {
+        ++histogram[log_histogram_bucket(in[0]) * LOG_HISTOGRAM_LANES];
+        ++in;
+    }
+}
+
+void STARCH_IMPL(log_histogram_u16, clz_lanes) (const uint16_t *in, unsigned len, uint32_t *histogram)
+{
+    unsigned len4 = len >> 2;
+    while (len4--) {
+        ++histogram[log_histogram_bucket(in[0]) * LOG_HISTOGRAM_LANES + 0];
+        ++histogram[log_histogram_bucket(in[1]) * LOG_HISTOGRAM_LANES + 1];
+        ++histogram[log_histogram_bucket(in[2]) * LOG_HISTOGRAM_LANES + 2];
+        ++histogram[log_histogram_bucket(in[3]) * LOG_HISTOGRAM_LANES + 3];
+        in += 4;
+    }
+
+    unsigned len1 = len & 3;
+    while (len1--) {
+        ++histogram[log_histogram_bucket(in[0]) * LOG_HISTOGRAM_LANES];
+        ++in;
+    }
+}
+
+/* Find counter indexes for up to 256 values at a time.
+ *
+ * Above 1024, the bucket index is the float exponent and the top 9 bits
+ * of the float mantissa, which can be computed in parallel without
+ * needing a count-leading-zeros instruction.
+ */
+static inline void float_bits_indexes(const uint16_t * restrict in, unsigned len, uint16_t * restrict indexes)
+{
+    for (unsigned i = 0; i < len; ++i) {
+        uint16_t v = in[i];
+        float f = v;
+        uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        uint16_t log_bucket = (bits >> 14) - (135 << 9);
+        uint16_t bucket = (v < 1024 ? v : log_bucket);
+        indexes[i] = bucket * LOG_HISTOGRAM_LANES + (i & (LOG_HISTOGRAM_LANES - 1));
+    }
+}
+
+void STARCH_IMPL(log_histogram_u16, float_bits_lanes) (const uint16_t *in, unsigned len, uint32_t *histogram)
+{
+    uint16_t indexes[256];
+
+    while (len > 0) {
+        unsigned chunk = (len > 256 ? 256 : len);
+
+        float_bits_indexes(in, chunk, indexes);
+        for (unsigned i = 0; i < chunk; ++i)
+            ++histogram[indexes[i]];
+
+        in += chunk;
+        len -= chunk;
+    }
+}
@@ -0,0 +1,151 @@
+#include <math.h>
+#include <stdlib.h>
+
+#include "compat/compat.h"
+
+/* Convert (little-endian) SC16 values with a range of -2048..+2047 to unsigned 16-bit magnitudes, removing a DC offset */
+
+void STARCH_IMPL(magnitude_dc_sc16q11, exact_float) (const sc16_t *in, uint16_t *out, unsigned len, dc_offset_t *dc)
+{
+    const sc16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    const float offset_I = dc->I * 2048.0f;
+    const float offset_Q = dc->Q * 2048.0f;
+
+    int64_t sum_I = 0, sum_Q = 0;
+
+    unsigned len1 = len;
+    while (len1--) {
+        int16_t rawI = (int16_t) le16toh(in_align[0].I);
+        int16_t rawQ = (int16_t) le16toh(in_align[0].Q);
+        sum_I += rawI;
+        sum_Q += rawQ;
+
+        float I = (rawI - offset_I) * 32;
+        float Q = (rawQ - offset_Q) * 32;
+
+        float mag = sqrtf(I * I + Q * Q);
+        if (mag > 65535.0f)
+            mag = 65535.0f;
+        out_align[0] = (uint16_t)mag;
+
+        out_align += 1;
+        in_align += 1;
+    }
+
+    dc->mean_I = len ? (float) sum_I / len / 2048.0f : 0;
+    dc->mean_Q = len ? (float) sum_Q / len / 2048.0f : 0;
+}
+
+/* As above, but accumulating the input sums in 32-bit blocks so that
+ * the whole loop can be vectorized */
+void STARCH_IMPL(magnitude_dc_sc16q11, exact_float_s32) (const sc16_t *in, uint16_t *out, unsigned len, dc_offset_t *dc)
+{
+    const sc16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    const float offset_I = dc->I * 2048.0f;
+    const float offset_Q = dc->Q * 2048.0f;
+
+    int64_t sum_I = 0, sum_Q = 0;
+
+    unsigned remaining = len;
+    while (remaining > 0) {
+        int32_t sum32_I = 0, sum32_Q = 0;
+        unsigned blocklen = (remaining > 65536 ? 65536 : remaining);
+        remaining -= blocklen;
+
+        while (blocklen--) {
+            int16_t rawI = (int16_t) le16toh(in_align[0].I);
+            int16_t rawQ = (int16_t) le16toh(in_align[0].Q);
+            sum32_I += rawI;
+            sum32_Q += rawQ;
+
+            float I = (rawI - offset_I) * 32;
+            float Q = (rawQ - offset_Q) * 32;
+
+            float mag = sqrtf(I * I + Q * Q);
+            out_align[0] = (uint16_t) (mag > 65535.0f ? 65535.0f : mag);
+
+            out_align += 1;
+            in_align += 1;
+        }
+
+        sum_I += sum32_I;
+        sum_Q += sum32_Q;
+    }
+
+    dc->mean_I = len ? (float) sum_I / len / 2048.0f : 0;
+    dc->mean_Q = len ? (float) sum_Q / len / 2048.0f : 0;
+}
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+void STARCH_IMPL_REQUIRES(magnitude_dc_sc16q11, neon_vrsqrte, STARCH_FEATURE_NEON) (const sc16_t *in, uint16_t *out, unsigned len, dc_offset_t *dc)
+{
+    const int16_t * restrict in_align = (const int16_t *) STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    /* The DC offset is rounded to the nearest input LSB and removed with a
+     * saturating subtract; the magnitude is then computed as in magnitude_sc16q11.
+     */
+    const float offset_I_f = dc->I * 2048.0f;
+    const float offset_Q_f = dc->Q * 2048.0f;
+    const int16x4_t offset_I = vdup_n_s16((int16_t) lrintf(offset_I_f < -32768.0f ? -32768.0f : offset_I_f > 32767.0f ? 32767.0f : offset_I_f));
+    const int16x4_t offset_Q = vdup_n_s16((int16_t) lrintf(offset_Q_f < -32768.0f ? -32768.0f : offset_Q_f > 32767.0f ? 32767.0f : offset_Q_f));
+
+    int64x2_t sum_I = vdupq_n_s64(0);
+    int64x2_t sum_Q = vdupq_n_s64(0);
+
+    unsigned len4 = len >> 2;
+    while (len4--) {
+        int16x4x2_t iq = vld2_s16(in_align);
+
+        // accumulate the raw input for the DC estimate
+        sum_I = vpadalq_s32(sum_I, vmovl_s16(iq.val[0]));
+        sum_Q = vpadalq_s32(sum_Q, vmovl_s16(iq.val[1]));
+
+        int16x4_t i16 = vqsub_s16(iq.val[0], offset_I); /* Q11 */
+        int16x4_t q16 = vqsub_s16(iq.val[1], offset_Q); /* Q11 */
+
+        uint32x4_t isq = vreinterpretq_u32_s32(vmull_s16(i16, i16)); /* Q22, unsigned */
+        uint32x4_t qsq = vreinterpretq_u32_s32(vmull_s16(q16, q16)); /* Q22, unsigned */
+        uint32x4_t magsq = vqaddq_u32(isq, qsq);                     /* Q22, unsigned */
+
+        float32x4_t magsq_f32 = vcvtq_n_f32_u32(magsq, 22);
+        float32x4_t mag_f32 = vmulq_f32(magsq_f32, vrsqrteq_f32(magsq_f32));  /* sqrt(x) = x * (1/sqrt(x)) */
+        uint16x4_t mag_u16 = vqmovn_u32(vcvtq_n_u32_f32(mag_f32, 16));
+
+        vst1_u16(out_align, mag_u16);
+
+        in_align += 8;
+        out_align += 4;
+    }
+
+    int64_t total_I = vgetq_lane_s64(sum_I, 0) + vgetq_lane_s64(sum_I, 1);
+    int64_t total_Q = vgetq_lane_s64(sum_Q, 0) + vgetq_lane_s64(sum_Q, 1);
+
+    unsigned len1 = len & 3;
+    while (len1--) {
+        int16_t rawI = (int16_t) le16toh(in_align[0]);
+        int16_t rawQ = (int16_t) le16toh(in_align[1]);
+        total_I += rawI;
+        total_Q += rawQ;
+
+        float I = (rawI - offset_I_f) * 32;
+        float Q = (rawQ - offset_Q_f) * 32;
+        float mag = sqrtf(I * I + Q * Q);
+        out_align[0] = (uint16_t) (mag > 65535.0f ? 65535.0f : mag);
+
+        in_align += 2;
+        out_align += 1;
+    }
+
+    dc->mean_I = len ? (float) total_I / len / 2048.0f : 0;
+    dc->mean_Q = len ? (float) total_Q / len / 2048.0f : 0;
+}
+
+#endif /* STARCH_FEATURE_NEON */
@@ -0,0 +1,173 @@
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "compat/compat.h"
+
+/* Convert UC8 values to unsigned 16-bit magnitudes, removing a DC offset */
+
+void STARCH_IMPL(magnitude_dc_uc8, exact) (const uc8_t *in, uint16_t *out, unsigned len, dc_offset_t *dc)
+{
+    const uc8_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    const float offset_I = 127.4f + dc->I * 128.0f;
+    const float offset_Q = 127.4f + dc->Q * 128.0f;
+
+    uint64_t sum_I = 0, sum_Q = 0;
+
+    unsigned len1 = len;
+    while (len1--) {
+        uint8_t rawI = in_align[0].I;
+        uint8_t rawQ = in_align[0].Q;
+        sum_I += rawI;
+        sum_Q += rawQ;
+
+        float I = rawI - offset_I;
+        float Q = rawQ - offset_Q;
+
+        float magsq = I * I + Q * Q;
+        float mag = sqrtf(magsq) * (65536.0f / 128.0f);
+        if (mag > 65535.0f)
+            mag = 65535.0f;
+
+        out_align[0] = (uint16_t)mag;
+
+        in_align += 1;
+        out_align += 1;
+    }
+
+    dc->mean_I = len ? ((float) sum_I / len - 127.4f) / 128.0f : 0;
+    dc->mean_Q = len ? ((float) sum_Q / len - 127.4f) / 128.0f : 0;
+}
+
+/* As above, but accumulating the input sums in 32-bit blocks so that
+ * the whole loop can be vectorized */
+void STARCH_IMPL(magnitude_dc_uc8, exact_u32) (const uc8_t *in, uint16_t *out, unsigned len, dc_offset_t *dc)
+{
+    const uc8_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    const float offset_I = 127.4f + dc->I * 128.0f;
+    const float offset_Q = 127.4f + dc->Q * 128.0f;
+
+    uint64_t sum_I = 0, sum_Q = 0;
+
+    unsigned remaining = len;
+    while (remaining > 0) {
+        uint32_t sum32_I = 0, sum32_Q = 0;
+        unsigned blocklen = (remaining > 65536 ? 65536 : remaining);
+        remaining -= blocklen;
+
+        while (blocklen--) {
+            uint8_t rawI = in_align[0].I;
+            uint8_t rawQ = in_align[0].Q;
+            sum32_I += rawI;
+            sum32_Q += rawQ;
+
+            float I = rawI - offset_I;
+            float Q = rawQ - offset_Q;
+
+            float mag = sqrtf(I * I + Q * Q) * (65536.0f / 128.0f);
+            out_align[0] = (uint16_t) (mag > 65535.0f ? 65535.0f : mag);
+
+            in_align += 1;
+            out_align += 1;
+        }
+
+        sum_I += sum32_I;
+        sum_Q += sum32_Q;
+    }
+
+    dc->mean_I = len ? ((float) sum_I / len - 127.4f) / 128.0f : 0;
+    dc->mean_Q = len ? ((float) sum_Q / len - 127.4f) / 128.0f : 0;
+}
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+void STARCH_IMPL_REQUIRES(magnitude_dc_uc8, neon_vrsqrte, STARCH_FEATURE_NEON) (const uc8_t *in, uint16_t *out, unsigned len, dc_offset_t *dc)
+{
+    const uint8_t * restrict in_align = (const uint8_t *) STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    /* Offsets in Q8; we work with the inputs scaled up by 256 so that the
+     * DC offset can be subtracted with sub-LSB precision */
+    float offset_I_f = (127.4f + dc->I * 128.0f) * 256.0f;
+    float offset_Q_f = (127.4f + dc->Q * 128.0f) * 256.0f;
+    const uint16x8_t offset_I = vdupq_n_u16((uint16_t) (offset_I_f < 0 ? 0 : offset_I_f > 65535.0f ? 65535.0f : offset_I_f));
+    const uint16x8_t offset_Q = vdupq_n_u16((uint16_t) (offset_Q_f < 0 ? 0 : offset_Q_f > 65535.0f ? 65535.0f : offset_Q_f));
+
+    uint32x4_t sum_I = vdupq_n_u32(0);
+    uint32x4_t sum_Q = vdupq_n_u32(0);
+
+    unsigned len8 = len >> 3;
+    while (len8--) {
+        uint8x8x2_t iq = vld2_u8(in_align);
+
+        // accumulate the raw input for the DC estimate
+        sum_I = vpadalq_u16(sum_I, vmovl_u8(iq.val[0]));
+        sum_Q = vpadalq_u16(sum_Q, vmovl_u8(iq.val[1]));
+
+        // widen to 16 bits, remove offset, convert to signed
+        uint16x8_t i_u16 = vshll_n_u8(iq.val[0], 8);
+        uint16x8_t q_u16 = vshll_n_u8(iq.val[1], 8);
+        int16x8_t i_s16 = vqsubq_s16(vreinterpretq_s16_u16(vshrq_n_u16(i_u16, 1)), vreinterpretq_s16_u16(vshrq_n_u16(offset_I, 1)));
+        int16x8_t q_s16 = vqsubq_s16(vreinterpretq_s16_u16(vshrq_n_u16(q_u16, 1)), vreinterpretq_s16_u16(vshrq_n_u16(offset_Q, 1)));
+
+        // low half
+        int16x4_t i_s16_low = vget_low_s16(i_s16);
+        int16x4_t q_s16_low = vget_low_s16(q_s16);
+        uint32x4_t isq_low = vreinterpretq_u32_s32(vmull_s16(i_s16_low, i_s16_low));
+        uint32x4_t qsq_low = vreinterpretq_u32_s32(vmull_s16(q_s16_low, q_s16_low));
+        uint32x4_t magsq_low = vqaddq_u32(isq_low, qsq_low);
+        float32x4_t magsq_f32_low = vcvtq_n_f32_u32(magsq_low, 28);                      /* inputs are Q14, magsq is Q28 */
+        float32x4_t mag_f32_low = vmulq_f32(vrsqrteq_f32(magsq_f32_low), magsq_f32_low); /* sqrt(x) = x * (1/sqrt(x)) */
+        uint16x4_t mag_u16_low = vqmovn_u32(vcvtq_n_u32_f32(mag_f32_low, 16));
+
+        // high half
+        int16x4_t i_s16_high = vget_high_s16(i_s16);
+        int16x4_t q_s16_high = vget_high_s16(q_s16);
+        uint32x4_t isq_high = vreinterpretq_u32_s32(vmull_s16(i_s16_high, i_s16_high));
+        uint32x4_t qsq_high = vreinterpretq_u32_s32(vmull_s16(q_s16_high, q_s16_high));
+        uint32x4_t magsq_high = vqaddq_u32(isq_high, qsq_high);
+        float32x4_t magsq_f32_high = vcvtq_n_f32_u32(magsq_high, 28);
+        float32x4_t mag_f32_high = vmulq_f32(vrsqrteq_f32(magsq_f32_high), magsq_f32_high);
+        uint16x4_t mag_u16_high = vqmovn_u32(vcvtq_n_u32_f32(mag_f32_high, 16));
+
+        // store
+        vst1q_u16(out_align, vcombine_u16(mag_u16_low, mag_u16_high));
+
+        in_align += 16;
+        out_align += 8;
+    }
+
+    uint32x2_t sum_I_2 = vadd_u32(vget_low_u32(sum_I), vget_high_u32(sum_I));
+    uint32x2_t sum_Q_2 = vadd_u32(vget_low_u32(sum_Q), vget_high_u32(sum_Q));
+    uint64_t total_I = (uint64_t) vget_lane_u32(sum_I_2, 0) + vget_lane_u32(sum_I_2, 1);
+    uint64_t total_Q = (uint64_t) vget_lane_u32(sum_Q_2, 0) + vget_lane_u32(sum_Q_2, 1);
+
+    const float scalar_offset_I = 127.4f + dc->I * 128.0f;
+    const float scalar_offset_Q = 127.4f + dc->Q * 128.0f;
+
+    unsigned len1 = len & 7;
+    while (len1--) {
+        total_I += in_align[0];
+        total_Q += in_align[1];
+
+        float I = in_align[0] - scalar_offset_I;
+        float Q = in_align[1] - scalar_offset_Q;
+        float mag = sqrtf(I * I + Q * Q) * (65536.0f / 128.0f);
+        out_align[0] = (uint16_t) (mag > 65535.0f ? 65535.0f : mag);
+
+        in_align += 2;
+        out_align += 1;
+    }
+
+    dc->mean_I = len ? ((float) total_I / len - 127.4f) / 128.0f : 0;
+    dc->mean_Q = len ? ((float) total_Q / len - 127.4f) / 128.0f : 0;
+}
+
+#endif /* STARCH_FEATURE_NEON */
@@ -0,0 +1,167 @@
+#include <math.h>
+
+#include "compat/compat.h"
+
+#include "dsp/helpers/tables.h"
+
+/* Convert (little-endian) SC16 values with a range of -2048..+2047 to unsigned 16-bit magnitudes,
+ * and return the mean magnitude and mean squared magnitude (normalized to 0..1)
+ */
+
+void STARCH_IMPL(magnitude_power_sc16q11, twopass) (const sc16_t *in, uint16_t *out, unsigned len, double *out_level, double *out_power)
+{
+#if STARCH_ALIGNMENT > 1
+    starch_magnitude_sc16q11_aligned(in, out, len);
+    starch_mean_power_u16_aligned(out, len, out_level, out_power);
+#else
+    starch_magnitude_sc16q11(in, out, len);
+    starch_mean_power_u16(out, len, out_level, out_power);
+#endif
+}
+
+void STARCH_IMPL(magnitude_power_sc16q11, exact_float) (const sc16_t *in, uint16_t *out, unsigned len, double *out_level, double *out_power)
+{
+    const sc16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    double sum_level = 0, sum_power = 0;
+
+    // accumulate in single precision over blocks short enough not to lose
+    // much precision, which keeps the loop vectorizable
+    unsigned remaining = len;
+    while (remaining > 0) {
+        float sum_block = 0, sumsq_block = 0;
+        unsigned blocklen = (remaining > 4096 ? 4096 : remaining);
+        remaining -= blocklen;
+
+        while (blocklen--) {
+            float I = abs((int16_t) le16toh(in_align[0].I)) * 32;
+            float Q = abs((int16_t) le16toh(in_align[0].Q)) * 32;
+
+            float magsq = I * I + Q * Q;
+            float mag_f = sqrtf(magsq);
+            if (mag_f > 65535.0)
+                mag_f = 65535.0;
+            out_align[0] = (uint16_t)mag_f;
+            sum_block += mag_f;
+            sumsq_block += mag_f * mag_f;
+
+            out_align += 1;
+            in_align += 1;
+        }
+
+        sum_level += sum_block;
+        sum_power += sumsq_block;
+    }
+
+    *out_level = sum_level / len / 65536.0;
+    *out_power = sum_power / len / 65536.0 / 65536.0;
+}
+
+void STARCH_IMPL(magnitude_power_sc16q11, 11bit_table) (const sc16_t *in, uint16_t *out, unsigned len, double *out_level, double *out_power)
+{
+    const uint16_t * restrict table = get_sc16q11_mag_11bit_table();
+    const sc16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    uint64_t sum_level = 0;
+    uint64_t sum_power = 0;
+
+    unsigned len1 = len;
+    while (len1--) {
+        uint16_t I = abs((int16_t)le16toh(in_align[0].I));
+        if (I >= 2048)
+            I = 2047;
+        uint16_t Q = abs((int16_t)le16toh(in_align[0].Q));
+        if (Q >= 2048)
+            Q = 2047;
+        uint16_t mag = table[(Q << 11) | I];
+
+        out_align[0] = mag;
+        sum_level += mag;
+        sum_power += (uint32_t)mag * mag;
+
+        in_align += 1;
+        out_align += 1;
+    }
+
+    *out_level = sum_level / 65536.0 / len;
+    *out_power = sum_power / 65536.0 / 65536.0 / len;
+}
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+void STARCH_IMPL_REQUIRES(magnitude_power_sc16q11, neon_vrsqrte, STARCH_FEATURE_NEON) (const sc16_t *in, uint16_t *out, unsigned len, double *out_level, double *out_power)
+{
+    const int16_t * restrict in_align = (const int16_t *) STARCH_ALIGNED(in);
+    uint16_t * restrict out_align = STARCH_ALIGNED(out);
+
+    const float32x4_t almost_one = vdupq_n_f32(65535.0 / 65536.0);
+
+    float32x4_t sum_level = vdupq_n_f32(0);
+    float32x4_t sum_power = vdupq_n_f32(0);
+
+    unsigned len4 = len >> 2;
+    while (len4--) {
+        int16x4x2_t iq = vld2_s16(in_align);
+        int16x4_t i16 = iq.val[0]; /* Q11 */
+        int16x4_t q16 = iq.val[1]; /* Q11 */
+
+        uint32x4_t isq = vreinterpretq_u32_s32(vmull_s16(i16, i16)); /* Q22, unsigned */
+        uint32x4_t qsq = vreinterpretq_u32_s32(vmull_s16(q16, q16)); /* Q22, unsigned */
+        uint32x4_t magsq = vqaddq_u32(isq, qsq);                     /* Q22, unsigned */
+
+        float32x4_t magsq_f32 = vcvtq_n_f32_u32(magsq, 22);
+        float32x4_t mag_f32 = vmulq_f32(magsq_f32, vrsqrteq_f32(magsq_f32));  /* sqrt(x) = x * (1/sqrt(x)) */
+        uint16x4_t mag_u16 = vqmovn_u32(vcvtq_n_u32_f32(mag_f32, 16));
+
+        sum_level = vaddq_f32(sum_level, vminq_f32(mag_f32, almost_one));
+        sum_power = vaddq_f32(sum_power, vminq_f32(magsq_f32, almost_one));
+
+        vst1_u16(out_align, mag_u16);
+
+        in_align += 8;
+        out_align += 4;
+    }
+
+    const int16x4_t lane0_mask = { -1, 0, 0, 0 };
+
+    unsigned len1 = len & 3;
+    while (len1--) {
+        int16x4x2_t iq = vld2_dup_s16(in_align);
+
+        // mask so only lane 0 has a non-zero value
+        // (important for sum_level / sum_power later)
+        int16x4_t i16 = vand_s16(iq.val[0], lane0_mask);
+        int16x4_t q16 = vand_s16(iq.val[1], lane0_mask);
+
+        uint32x4_t isq = vreinterpretq_u32_s32(vmull_s16(i16, i16));
+        uint32x4_t qsq = vreinterpretq_u32_s32(vmull_s16(q16, q16));
+        uint32x4_t magsq = vqaddq_u32(isq, qsq);
+
+        float32x4_t magsq_f32 = vcvtq_n_f32_u32(magsq, 22);
+        float32x4_t mag_f32 = vmulq_f32(magsq_f32, vrsqrteq_f32(magsq_f32));
+        uint16x4_t mag_u16 = vqmovn_u32(vcvtq_n_u32_f32(mag_f32, 16));
+
+        sum_level = vaddq_f32(sum_level, vminq_f32(mag_f32, almost_one));
+        sum_power = vaddq_f32(sum_power, vminq_f32(magsq_f32, almost_one));
+
+        vst1_lane_u16(out_align, mag_u16, 0);
+
+        in_align += 2;
+        out_align += 1;
+    }
+
+    // add sums across vector
+    float32x2_t sum2_level = vadd_f32(vget_low_f32(sum_level), vget_high_f32(sum_level));
+    float32x2_t sum4_level = vpadd_f32(sum2_level, sum2_level);
+    *out_level = vget_lane_f32(sum4_level, 0) / len;
+
+    float32x2_t sum2_power = vadd_f32(vget_low_f32(sum_power), vget_high_f32(sum_power));
+    float32x2_t sum4_power = vpadd_f32(sum2_power, sum2_power);
+    *out_power = vget_lane_f32(sum4_power, 0) / len;
+}
+
+#endif /* STARCH_FEATURE_NEON */
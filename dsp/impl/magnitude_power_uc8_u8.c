@@ -0,0 +1,112 @@
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdalign.h>
+#include <inttypes.h>
+
+#include "compat/compat.h"
+
+#include "dsp/helpers/tables.h"
+
+/* Convert UC8 values to unsigned 8-bit magnitudes (--demod-u8).
+ *
+ * The output is the 16-bit magnitude scaled down by 256, i.e.
+ * round(sqrt(I^2 + Q^2) * 256) clamped to 255, with I and Q normalized
+ * as for magnitude_power_uc8. Level and power are normalized to 0..1
+ * as before.
+ */
+
+void STARCH_IMPL(magnitude_power_uc8_u8, lookup) (const uc8_t *in, uint8_t *out, unsigned len, double *out_level, double *out_power)
+{
+    const uint8_t * const restrict mag_table = get_uc8_mag8_table();
+
+    const uc8_u16_t * restrict in_align = (const uc8_u16_t *) STARCH_ALIGNED(in);
+    uint8_t * restrict out_align = STARCH_ALIGNED(out);
+
+    uint64_t sum_level = 0;
+    uint64_t sum_power = 0;
+
+    unsigned len1 = len;
+    while (len1--) {
+        uint8_t mag = mag_table[in_align[0].u16];
+        out_align[0] = mag;
+        sum_level += mag;
+        sum_power += (uint32_t)mag * mag;
+
+        out_align += 1;
+        in_align += 1;
+    }
+
+    *out_level = sum_level / 256.0 / len;
+    *out_power = sum_power / 65536.0 / len;
+}
+
+void STARCH_IMPL(magnitude_power_uc8_u8, lookup_unroll_4) (const uc8_t *in, uint8_t *out, unsigned len, double *out_level, double *out_power)
+{
+    const uint8_t * const restrict mag_table = get_uc8_mag8_table();
+
+    const uc8_u16_t * restrict in_align = (const uc8_u16_t *) STARCH_ALIGNED(in);
+    uint8_t * restrict out_align = STARCH_ALIGNED(out);
+
+    uint64_t sum_level = 0;
+    uint64_t sum_power = 0;
+
+    unsigned len4 = len >> 2;
+    unsigned len1 = len & 3;
+
+    while (len4--) {
+        uint8_t mag0 = mag_table[in_align[0].u16];
+        uint8_t mag1 = mag_table[in_align[1].u16];
+        uint8_t mag2 = mag_table[in_align[2].u16];
+        uint8_t mag3 = mag_table[in_align[3].u16];
+
+        out_align[0] = mag0;
+        out_align[1] = mag1;
+        out_align[2] = mag2;
+        out_align[3] = mag3;
+
+        sum_level = sum_level + mag0 + mag1 + mag2 + mag3;
+        sum_power = sum_power + (uint32_t)mag0 * mag0 + (uint32_t)mag1 * mag1 + (uint32_t)mag2 * mag2 + (uint32_t)mag3 * mag3;
+
+        out_align += 4;
+        in_align += 4;
+    }
+
+    while (len1--) {
+        uint8_t mag = mag_table[in_align[0].u16];
+
+        out_align[0] = mag;
+
+        sum_level = sum_level + mag;
+        sum_power = sum_power + (uint32_t)mag * mag;
+
+        out_align += 1;
+        in_align += 1;
+    }
+
+    *out_level = sum_level / 256.0 / len;
+    *out_power = sum_power / 65536.0 / len;
+}
+
+void STARCH_IMPL(magnitude_power_uc8_u8, exact_float) (const uc8_t *in, uint8_t *out, unsigned len, double *out_level, double *out_power)
+{
+    const uc8_t * restrict in_align = STARCH_ALIGNED(in);
+    uint8_t * restrict out_align = STARCH_ALIGNED(out);
+
+    uint64_t sum_level = 0;
+    uint64_t sum_power = 0;
+
+    for (unsigned i = 0; i < len; ++i) {
+        float I = (in_align[i].I - 127.4f) * 2.0f;
+        float Q = (in_align[i].Q - 127.4f) * 2.0f;
+        float mag = sqrtf(I * I + Q * Q) + 0.5f;
+        uint8_t mag8 = (mag > 255.0f ? 255 : (uint8_t) mag);
+
+        out_align[i] = mag8;
+        sum_level += mag8;
+        sum_power += (uint32_t)mag8 * mag8;
+    }
+
+    *out_level = sum_level / 256.0 / len;
+    *out_power = sum_power / 65536.0 / len;
+}
@@ -0,0 +1,116 @@
+#include <string.h>
+
+/*
+ * Scan a buffer of 2.4MHz uint16_t magnitude samples for possible Mode S
+ * preambles using a matched filter, and write the offsets of all
+ * candidates to out_offsets.
+ *
+ * At each offset, the 19 samples of the preamble are correlated against
+ * the ideal preamble shapes for phases 3..7 (see demodulate2400), with the
+ * mean of each shape removed so that a flat input correlates to zero. The
+ * best correlation must beat a local noise estimate, taken from the
+ * samples where all five shapes expect silence.
+ *
+ * Like the heuristic scan, this usually reports a few adjacent offsets for
+ * each real preamble; the demodulator tries each in turn, which decodes
+ * more messages than keeping only the offset with the peak correlation.
+ *
+ * The buffer must have at least 19 samples of valid data beyond "len";
+ * out_offsets must have room for "len" entries.
+ */
+
+#ifndef DSP_PREAMBLE_CORRELATE_HELPERS
+#define DSP_PREAMBLE_CORRELATE_HELPERS
+
+// Required ratio of the best correlation to the quiet-sample sum. The
+// correlation of a clean preamble with pulse amplitude A is about 219*A,
+// and the quiet-sample sum for noise of mean level N is 9*N, so this
+// requires A/N > 576/219, about 2.6 (8.4dB)
+#define PREAMBLE_CORRELATE_RATIO 64
+
+// Correlation statistic for a preamble starting at p[0], minus the noise
+// threshold; > 0 if this is a possible preamble. Branch-free so that it
+// vectorizes.
+static inline int32_t preamble_correlate_stat(const uint16_t *p)
+{
+    // Shapes, in 1/6ths of a symbol per sample; each sums to 24:
+    //
+    // sample#: 0 1 2 3 4 5 6 7 8 9 0 1 2 3
+    // phase 3: 2 4 0 5 1 0 0 0 0 5 1 3 3 0
+    // phase 4: 1 5 0 4 2 0 0 0 0 4 2 2 4 0
+    // phase 5: 0 5 1 3 3 0 0 0 0 3 3 1 5 0
+    // phase 6: 0 4 2 2 4 0 0 0 0 2 4 0 5 1
+    // phase 7: 0 3 3 1 5 0 0 0 0 1 5 0 4 2
+    //
+    // Samples 14..18 are quiet for all phases.
+
+    int32_t s3 = 2*p[0] + 4*p[1]          + 5*p[3] + 1*p[4] + 5*p[9] + 1*p[10] + 3*p[11] + 3*p[12];
+    int32_t s4 = 1*p[0] + 5*p[1]          + 4*p[3] + 2*p[4] + 4*p[9] + 2*p[10] + 2*p[11] + 4*p[12];
+    int32_t s5 =          5*p[1] + 1*p[2] + 3*p[3] + 3*p[4] + 3*p[9] + 3*p[10] + 1*p[11] + 5*p[12];
+    int32_t s6 =          4*p[1] + 2*p[2] + 2*p[3] + 4*p[4] + 2*p[9] + 4*p[10]           + 5*p[12] + 1*p[13];
+    int32_t s7 =          3*p[1] + 3*p[2] + 1*p[3] + 5*p[4] + 1*p[9] + 5*p[10]           + 4*p[12] + 2*p[13];
+
+    int32_t s34 = (s3 > s4 ? s3 : s4);
+    int32_t s56 = (s5 > s6 ? s5 : s6);
+    int32_t s347 = (s34 > s7 ? s34 : s7);
+    int32_t best = (s347 > s56 ? s347 : s56);
+
+    int32_t quiet = p[5] + p[6] + p[7] + p[8] + p[14] + p[15] + p[16] + p[17] + p[18];
+    int32_t window = p[0] + p[1] + p[2] + p[3] + p[4] + p[9] + p[10] + p[11] + p[12] + p[13] + quiet;
+
+    // zero-mean correlation: sum over 19 samples of (19*shape - 24) * sample
+    int32_t correlation = 19 * best - 24 * window;
+    return correlation - PREAMBLE_CORRELATE_RATIO * quiet;
+}
+
+#endif /* DSP_PREAMBLE_CORRELATE_HELPERS */
+
+void STARCH_IMPL(preamble_correlate_u16, scalar) (const uint16_t *in, unsigned len, uint32_t *out_offsets, unsigned *out_count)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint32_t * restrict out = out_offsets;
+
+    unsigned count = 0;
+    for (unsigned i = 0; i < len; ++i) {
+        if (preamble_correlate_stat(&in_align[i]) > 0)
+            out[count++] = i;
+    }
+
+    *out_count = count;
+}
+
+void STARCH_IMPL(preamble_correlate_u16, twopass) (const uint16_t *in, unsigned len, uint32_t *out_offsets, unsigned *out_count)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint32_t * restrict out = out_offsets;
+
+    /* First pass over a block computes the statistic test for every
+     * offset (vectorizable); the second pass skips 8 offsets at a time
+     * where nothing passed, and collects the rest. */
+    uint8_t positive[256];
+
+    unsigned count = 0;
+    for (unsigned base = 0; base < len; base += 256) {
+        unsigned n = (len - base < 256 ? len - base : 256);
+        const uint16_t *p = in_align + base;
+
+        for (unsigned i = 0; i < n; ++i)
+            positive[i] = (preamble_correlate_stat(p + i) > 0);
+        for (unsigned i = n; i < ((n + 7) & ~7U); ++i)
+            positive[i] = 0;
+
+        for (unsigned i = 0; i < n; i += 8) {
+            uint64_t eight;
+            memcpy(&eight, &positive[i], sizeof(eight));
+            if (!eight)
+                continue;
+
+            for (unsigned k = i; k < i + 8; ++k) {
+                if (positive[k])
+                    out[count++] = base + k;
+            }
+        }
+    }
+
+    *out_count = count;
+}
@@ -0,0 +1,142 @@
+#include <string.h>
+
+/*
+ * Scan a buffer of 2.4MHz uint16_t magnitude samples for possible Mode S
+ * preambles, and write the offsets of all candidates to out_offsets.
+ *
+ * A candidate is an offset that passes all the preamble tests done by
+ * demodulate2400: a rising edge 0->1 and falling edge 12->13, one of the
+ * five phase 3..7 peak patterns, enough signal relative to the noise
+ * samples, and quiet samples in the gaps.
+ *
+ * The buffer must have at least 19 samples of valid data beyond "len";
+ * out_offsets must have room for "len" entries.
+ */
+
+#include "dsp/helpers/preamble_scan.h"
+
+void STARCH_IMPL(preamble_scan_u16, scalar) (const uint16_t *in, unsigned len, uint32_t *out_offsets, unsigned *out_count)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint32_t * restrict out = out_offsets;
+
+    unsigned count = 0;
+    for (unsigned i = 0; i < len; ++i) {
+        if (preamble_scan_full(&in_align[i]))
+            out[count++] = i;
+    }
+
+    *out_count = count;
+}
+
+void STARCH_IMPL(preamble_scan_u16, twopass) (const uint16_t *in, unsigned len, uint32_t *out_offsets, unsigned *out_count)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint32_t * restrict out = out_offsets;
+
+    /* First pass over a block computes the cheap edge/peak test for every
+     * offset (vectorizable); the second pass skips 8 flags at a time and
+     * runs the full test only on the few offsets that passed. */
+    uint8_t flags[256];
+
+    unsigned count = 0;
+    for (unsigned base = 0; base < len; base += 256) {
+        unsigned n = (len - base < 256 ? len - base : 256);
+        const uint16_t *p = in_align + base;
+
+        for (unsigned i = 0; i < n; ++i)
+            flags[i] = preamble_scan_quick(p + i);
+        for (unsigned i = n; i < ((n + 7) & ~7U); ++i)
+            flags[i] = 0;
+
+        for (unsigned i = 0; i < n; i += 8) {
+            uint64_t eight;
+            memcpy(&eight, &flags[i], sizeof(eight));
+            if (!eight)
+                continue;
+
+            for (unsigned k = i; k < i + 8; ++k) {
+                if (flags[k] && preamble_scan_full(p + k))
+                    out[count++] = base + k;
+            }
+        }
+    }
+
+    *out_count = count;
+}
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+void STARCH_IMPL_REQUIRES(preamble_scan_u16, neon, STARCH_FEATURE_NEON) (const uint16_t *in, unsigned len, uint32_t *out_offsets, unsigned *out_count)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint32_t * restrict out = out_offsets;
+
+    unsigned count = 0;
+
+    /* Evaluate the cheap edge/peak test for 8 offsets at once; only offsets
+     * that pass it get the full (scalar) test. */
+    unsigned len8 = len >> 3;
+    const uint16_t *p = in_align;
+    for (unsigned block = 0; block < len8; ++block, p += 8) {
+        uint16x8_t s0 = vld1q_u16(p + 0);
+        uint16x8_t s1 = vld1q_u16(p + 1);
+        uint16x8_t s12 = vld1q_u16(p + 12);
+        uint16x8_t s13 = vld1q_u16(p + 13);
+
+        uint16x8_t edge = vandq_u16(vcltq_u16(s0, s1), vcgtq_u16(s12, s13));
+        uint8x8_t edge8 = vmovn_u16(edge);
+        if (!vget_lane_u64(vreinterpret_u64_u8(edge8), 0))
+            continue;
+
+        uint16x8_t s2 = vld1q_u16(p + 2);
+        uint16x8_t s3 = vld1q_u16(p + 3);
+        uint16x8_t s4 = vld1q_u16(p + 4);
+        uint16x8_t s5 = vld1q_u16(p + 5);
+        uint16x8_t s8 = vld1q_u16(p + 8);
+        uint16x8_t s9 = vld1q_u16(p + 9);
+        uint16x8_t s10 = vld1q_u16(p + 10);
+        uint16x8_t s11 = vld1q_u16(p + 11);
+
+        uint16x8_t c1_2 = vcgtq_u16(s1, s2);
+        uint16x8_t c2_3 = vcltq_u16(s2, s3);
+        uint16x8_t c3_4 = vcgtq_u16(s3, s4);
+        uint16x8_t c8_9 = vcltq_u16(s8, s9);
+        uint16x8_t c9_10 = vcgtq_u16(s9, s10);
+        uint16x8_t c11_12 = vcltq_u16(s11, s12);
+        uint16x8_t c4_5 = vcgtq_u16(s4, s5);
+        uint16x8_t c10_11 = vcgtq_u16(s10, s11);
+        uint16x8_t c3_4lt = vcltq_u16(s3, s4);
+        uint16x8_t c9_10lt = vcltq_u16(s9, s10);
+
+        // phases 3 and 4 share everything but the last test
+        uint16x8_t ph34 = vandq_u16(vandq_u16(vandq_u16(c1_2, c2_3), vandq_u16(c3_4, c8_9)), c9_10);
+        ph34 = vandq_u16(ph34, vorrq_u16(vcltq_u16(s10, s11), c11_12));
+        // phases 5, 6 and 7 all end with peaks at 9-10 or 10 and at 12
+        uint16x8_t ph5 = vandq_u16(vandq_u16(vandq_u16(c1_2, c2_3), vandq_u16(c4_5, c8_9)), vandq_u16(c10_11, c11_12));
+        uint16x8_t tail67 = vandq_u16(vandq_u16(vandq_u16(c3_4lt, c4_5), c9_10lt), vandq_u16(c10_11, c11_12));
+        uint16x8_t ph67 = vandq_u16(tail67, vorrq_u16(c1_2, vcgtq_u16(s2, s3)));
+
+        uint16x8_t quick = vandq_u16(edge, vorrq_u16(vorrq_u16(ph34, ph5), ph67));
+        uint8x8_t quick8 = vmovn_u16(quick);
+        uint64_t lanes = vget_lane_u64(vreinterpret_u64_u8(quick8), 0);
+        if (!lanes)
+            continue;
+
+        for (unsigned k = 0; k < 8; ++k, lanes >>= 8) {
+            if ((lanes & 0xFF) && preamble_scan_full(p + k))
+                out[count++] = block * 8 + k;
+        }
+    }
+
+    for (unsigned i = len8 * 8; i < len; ++i) {
+        if (preamble_scan_full(&in_align[i]))
+            out[count++] = i;
+    }
+
+    *out_count = count;
+}
+
+#endif /* STARCH_FEATURE_NEON */
@@ -0,0 +1,139 @@
+#include <string.h>
+
+/*
+ * As preamble_scan_u16, but over 8-bit magnitude samples (--demod-u8).
+ *
+ * The tests are the same; on 8-bit samples more neighbouring samples
+ * compare equal, so a few weak preambles that pass on 16-bit samples
+ * fail here.
+ *
+ * The buffer must have at least 19 samples of valid data beyond "len";
+ * out_offsets must have room for "len" entries.
+ */
+
+#include "dsp/helpers/preamble_scan.h"
+
+void STARCH_IMPL(preamble_scan_u8, scalar) (const uint8_t *in, unsigned len, uint32_t *out_offsets, unsigned *out_count)
+{
+    const uint8_t * restrict in_align = STARCH_ALIGNED(in);
+    uint32_t * restrict out = out_offsets;
+
+    unsigned count = 0;
+    for (unsigned i = 0; i < len; ++i) {
+        if (preamble_scan_full_u8(&in_align[i]))
+            out[count++] = i;
+    }
+
+    *out_count = count;
+}
+
+void STARCH_IMPL(preamble_scan_u8, twopass) (const uint8_t *in, unsigned len, uint32_t *out_offsets, unsigned *out_count)
+{
+    const uint8_t * restrict in_align = STARCH_ALIGNED(in);
+    uint32_t * restrict out = out_offsets;
+
+    /* As for preamble_scan_u16: a vectorizable quick test over a block,
+     * then the full test on the few offsets that passed. */
+    uint8_t flags[256];
+
+    unsigned count = 0;
+    for (unsigned base = 0; base < len; base += 256) {
+        unsigned n = (len - base < 256 ? len - base : 256);
+        const uint8_t *p = in_align + base;
+
+        for (unsigned i = 0; i < n; ++i)
+            flags[i] = preamble_scan_quick_u8(p + i);
+        for (unsigned i = n; i < ((n + 7) & ~7U); ++i)
+            flags[i] = 0;
+
+        for (unsigned i = 0; i < n; i += 8) {
+            uint64_t eight;
+            memcpy(&eight, &flags[i], sizeof(eight));
+            if (!eight)
+                continue;
+
+            for (unsigned k = i; k < i + 8; ++k) {
+                if (flags[k] && preamble_scan_full_u8(p + k))
+                    out[count++] = base + k;
+            }
+        }
+    }
+
+    *out_count = count;
+}
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+void STARCH_IMPL_REQUIRES(preamble_scan_u8, neon, STARCH_FEATURE_NEON) (const uint8_t *in, unsigned len, uint32_t *out_offsets, unsigned *out_count)
+{
+    const uint8_t * restrict in_align = STARCH_ALIGNED(in);
+    uint32_t * restrict out = out_offsets;
+
+    unsigned count = 0;
+
+    /* Evaluate the cheap edge/peak test for 16 offsets at once; only offsets
+     * that pass it get the full (scalar) test. */
+    unsigned len16 = len >> 4;
+    const uint8_t *p = in_align;
+    for (unsigned block = 0; block < len16; ++block, p += 16) {
+        uint8x16_t s0 = vld1q_u8(p + 0);
+        uint8x16_t s1 = vld1q_u8(p + 1);
+        uint8x16_t s12 = vld1q_u8(p + 12);
+        uint8x16_t s13 = vld1q_u8(p + 13);
+
+        uint8x16_t edge = vandq_u8(vcltq_u8(s0, s1), vcgtq_u8(s12, s13));
+        uint64x2_t edge64 = vreinterpretq_u64_u8(edge);
+        if (!(vgetq_lane_u64(edge64, 0) | vgetq_lane_u64(edge64, 1)))
+            continue;
+
+        uint8x16_t s2 = vld1q_u8(p + 2);
+        uint8x16_t s3 = vld1q_u8(p + 3);
+        uint8x16_t s4 = vld1q_u8(p + 4);
+        uint8x16_t s5 = vld1q_u8(p + 5);
+        uint8x16_t s8 = vld1q_u8(p + 8);
+        uint8x16_t s9 = vld1q_u8(p + 9);
+        uint8x16_t s10 = vld1q_u8(p + 10);
+        uint8x16_t s11 = vld1q_u8(p + 11);
+
+        uint8x16_t c1_2 = vcgtq_u8(s1, s2);
+        uint8x16_t c2_3 = vcltq_u8(s2, s3);
+        uint8x16_t c3_4 = vcgtq_u8(s3, s4);
+        uint8x16_t c8_9 = vcltq_u8(s8, s9);
+        uint8x16_t c9_10 = vcgtq_u8(s9, s10);
+        uint8x16_t c11_12 = vcltq_u8(s11, s12);
+        uint8x16_t c4_5 = vcgtq_u8(s4, s5);
+        uint8x16_t c10_11 = vcgtq_u8(s10, s11);
+        uint8x16_t c3_4lt = vcltq_u8(s3, s4);
+        uint8x16_t c9_10lt = vcltq_u8(s9, s10);
+
+        // phases 3 and 4 share everything but the last test
+        uint8x16_t ph34 = vandq_u8(vandq_u8(vandq_u8(c1_2, c2_3), vandq_u8(c3_4, c8_9)), c9_10);
+        ph34 = vandq_u8(ph34, vorrq_u8(vcltq_u8(s10, s11), c11_12));
+        // phases 5, 6 and 7 all end with peaks at 9-10 or 10 and at 12
+        uint8x16_t ph5 = vandq_u8(vandq_u8(vandq_u8(c1_2, c2_3), vandq_u8(c4_5, c8_9)), vandq_u8(c10_11, c11_12));
+        uint8x16_t tail67 = vandq_u8(vandq_u8(vandq_u8(c3_4lt, c4_5), c9_10lt), vandq_u8(c10_11, c11_12));
+        uint8x16_t ph67 = vandq_u8(tail67, vorrq_u8(c1_2, vcgtq_u8(s2, s3)));
+
+        uint8x16_t quick = vandq_u8(edge, vorrq_u8(vorrq_u8(ph34, ph5), ph67));
+        uint64x2_t quick64 = vreinterpretq_u64_u8(quick);
+
+        for (unsigned half = 0; half < 2; ++half) {
+            uint64_t lanes = (half ? vgetq_lane_u64(quick64, 1) : vgetq_lane_u64(quick64, 0));
+            for (unsigned k = half * 8; lanes; ++k, lanes >>= 8) {
+                if ((lanes & 0xFF) && preamble_scan_full_u8(p + k))
+                    out[count++] = block * 16 + k;
+            }
+        }
+    }
+
+    for (unsigned i = len16 * 16; i < len; ++i) {
+        if (preamble_scan_full_u8(&in_align[i]))
+            out[count++] = i;
+    }
+
+    *out_count = count;
+}
+
+#endif /* STARCH_FEATURE_NEON */
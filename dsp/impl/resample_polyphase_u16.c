@@ -0,0 +1,107 @@
+/*
+ * Polyphase resampling of uint16_t magnitude values.
+ *
+ * The input is processed in 'periods' periods of 'stride' input samples,
+ * each producing 'phases' output samples. Output phase p of a period is the
+ * dot product of the 'taps' coefficients at coeffs[p * taps] with the input
+ * samples starting at offsets[p] from the start of the period. The result is
+ * rounded and clamped to 0..65535.
+ *
+ * 'taps' is always a multiple of 8.
+ */
+
+#ifndef DSP_RESAMPLE_POLYPHASE_HELPERS
+#define DSP_RESAMPLE_POLYPHASE_HELPERS
+
+static inline uint16_t resample_clamp(float acc)
+{
+    if (acc <= 0)
+        return 0;
+    if (acc >= 65535)
+        return 65535;
+    return (uint16_t) (acc + 0.5f);
+}
+
+#endif /* DSP_RESAMPLE_POLYPHASE_HELPERS */
+
+void STARCH_IMPL(resample_polyphase_u16, generic) (const uint16_t *in, unsigned periods, unsigned stride,
+                                                   const float *coeffs, const unsigned *offsets,
+                                                   unsigned phases, unsigned taps, uint16_t *out)
+{
+    while (periods--) {
+        for (unsigned p = 0; p < phases; ++p) {
+            const uint16_t *x = in + offsets[p];
+            const float *h = coeffs + p * taps;
+
+            float acc = 0;
+            for (unsigned k = 0; k < taps; ++k)
+                acc += h[k] * x[k];
+
+            *out++ = resample_clamp(acc);
+        }
+
+        in += stride;
+    }
+}
+
+void STARCH_IMPL(resample_polyphase_u16, unroll8) (const uint16_t *in, unsigned periods, unsigned stride,
+                                                   const float *coeffs, const unsigned *offsets,
+                                                   unsigned phases, unsigned taps, uint16_t *out)
+{
+    while (periods--) {
+        for (unsigned p = 0; p < phases; ++p) {
+            const uint16_t *x = in + offsets[p];
+            const float *h = coeffs + p * taps;
+
+            // independent partial sums, so the adds don't serialize
+            float acc[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+            for (unsigned k = 0; k < taps; k += 8) {
+                for (unsigned lane = 0; lane < 8; ++lane)
+                    acc[lane] += h[k + lane] * x[k + lane];
+            }
+
+            *out++ = resample_clamp(((acc[0] + acc[4]) + (acc[1] + acc[5])) + ((acc[2] + acc[6]) + (acc[3] + acc[7])));
+        }
+
+        in += stride;
+    }
+}
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+void STARCH_IMPL_REQUIRES(resample_polyphase_u16, neon_vfma, STARCH_FEATURE_NEON) (const uint16_t *in, unsigned periods, unsigned stride,
+                                                                                   const float *coeffs, const unsigned *offsets,
+                                                                                   unsigned phases, unsigned taps, uint16_t *out)
+{
+    while (periods--) {
+        for (unsigned p = 0; p < phases; ++p) {
+            const uint16_t *x = in + offsets[p];
+            const float *h = coeffs + p * taps;
+
+            float32x4_t acc_0 = vdupq_n_f32(0);
+            float32x4_t acc_1 = vdupq_n_f32(0);
+
+            for (unsigned k = 0; k < taps; k += 8) {
+                uint16x8_t x_u16 = vld1q_u16(x + k);
+                float32x4_t x_0 = vcvtq_f32_u32(vmovl_u16(vget_low_u16(x_u16)));
+                float32x4_t x_1 = vcvtq_f32_u32(vmovl_u16(vget_high_u16(x_u16)));
+
+                acc_0 = vfmaq_f32(acc_0, vld1q_f32(h + k), x_0);
+                acc_1 = vfmaq_f32(acc_1, vld1q_f32(h + k + 4), x_1);
+            }
+
+            // reduce to lane 0
+            float32x4_t acc_q = vaddq_f32(acc_0, acc_1);
+            float32x2_t acc = vadd_f32(vget_low_f32(acc_q), vget_high_f32(acc_q));
+            acc = vpadd_f32(acc, acc);
+
+            *out++ = resample_clamp(vget_lane_f32(acc, 0));
+        }
+
+        in += stride;
+    }
+}
+
+#endif
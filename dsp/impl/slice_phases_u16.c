@@ -0,0 +1,220 @@
+/*
+ * Slice Mode S data bits out of 2.4MHz uint16_t magnitude samples, for all
+ * five candidate phase offsets (demodulate2400's try_phase 4..8) at once.
+ *
+ * "in" points at the first data sample (19 samples after the start of the
+ * preamble). For each phase n = 0..4 (try_phase 4+n) that has bit n set in
+ * "phase_mask", "bytes" bytes are written to out[n * bytes .. n * bytes +
+ * bytes - 1]; the output for other phases is left untouched. (Variants are
+ * free to skip masked-out phases, or to compute all phases regardless.)
+ *
+ * Each bit is a manchester-encoded 1-0 pair of symbols that starts at
+ * (4 + n + 12 * bit) / 5 samples into the buffer, with a sub-sample phase of
+ * (4 + n + 12 * bit) % 5; it is sliced using the same correlation functions
+ * as demodulate2400.
+ *
+ * "bytes" must be between 1 and SLICE_PHASES_MAX_BYTES; "in" must have
+ * SLICE_PHASES_SAMPLES(bytes) samples of valid data.
+ */
+
+#include "dsp/helpers/slice_correlate.h"
+
+#ifndef DSP_SLICE_PHASES_HELPERS
+#define DSP_SLICE_PHASES_HELPERS
+
+#define SLICE_PHASES_MAX_BYTES 14
+// number of sample positions that start a bit, over all phases
+#define SLICE_PHASES_POSITIONS(bytes) ((96 * (bytes) - 4) / 5 + 1)
+// ... rounded up to a multiple of 32, so that the vectorized loops have no
+// scalar tail
+#define SLICE_PHASES_POSITIONS_PADDED(bytes) ((SLICE_PHASES_POSITIONS(bytes) + 31) & ~31U)
+// number of samples read from the input
+#define SLICE_PHASES_SAMPLES(bytes) (SLICE_PHASES_POSITIONS_PADDED(bytes) + 3)
+
+// Row stride of the slicer decision arrays used by the dense variants
+#define SLICE_PHASES_STRIDE SLICE_PHASES_POSITIONS_PADDED(SLICE_PHASES_MAX_BYTES)
+
+// Bit b of a byte whose first bit starts at sub-sample phase t is sliced at
+// sub-sample phase (t + 12b) % 5, (t + 12b) / 5 samples after the sample
+// where the byte starts. With constant t and b the position and phase are
+// constants too, so SLICE_PHASES_BYTE expands to straight-line code.
+#define SLICE_PHASES_BIT_PHASE(t, b) (((t) + 12 * (b)) % 5)
+#define SLICE_PHASES_BIT_OFFSET(t, b) (((t) + 12 * (b)) / 5)
+#define SLICE_PHASES_BYTE(bit, t)                                       \
+    ((bit(t, 0) << 7) | (bit(t, 1) << 6) | (bit(t, 2) << 5) | (bit(t, 3) << 4) | \
+     (bit(t, 4) << 3) | (bit(t, 5) << 2) | (bit(t, 6) << 1) | bit(t, 7))
+
+// Iterate over all output bytes of the phases in phase_mask. "p" (of type
+// "const type *") points to the element of "base" where the current byte
+// starts; "bit" computes a single bit from p and constant t, b. Each byte is
+// 96/5 samples long, so the next byte starts 19 samples later with the next
+// sub-sample phase, or 20 samples later at phase 0 after phase 4.
+#define SLICE_PHASES_FOR_EACH_BYTE(type, base, bit)                     \
+    for (unsigned n = 0; n < 5; ++n) {                                  \
+        if (!(phase_mask & (1 << n)))                                   \
+            continue;                                                   \
+        const type *p = (base) + (4 + n) / 5;                           \
+        unsigned phase = (4 + n) % 5;                                   \
+        for (unsigned i = 0; i < bytes; ++i) {                          \
+            unsigned theByte = 0;                                       \
+            switch (phase) {                                            \
+            case 0: theByte = SLICE_PHASES_BYTE(bit, 0); phase = 1; p += 19; break; \
+            case 1: theByte = SLICE_PHASES_BYTE(bit, 1); phase = 2; p += 19; break; \
+            case 2: theByte = SLICE_PHASES_BYTE(bit, 2); phase = 3; p += 19; break; \
+            case 3: theByte = SLICE_PHASES_BYTE(bit, 3); phase = 4; p += 19; break; \
+            case 4: theByte = SLICE_PHASES_BYTE(bit, 4); phase = 0; p += 20; break; \
+            }                                                           \
+            out[n * bytes + i] = theByte;                               \
+        }                                                               \
+    }
+
+// Build the output bytes from precomputed slicer decisions:
+// sign[phase][position] is 1 if the correlation at that position and
+// sub-sample phase is positive.
+static inline void slice_phases_pack(uint8_t sign[5][SLICE_PHASES_STRIDE], unsigned bytes, unsigned phase_mask, uint8_t *out)
+{
+    const uint8_t *flat = &sign[0][0];
+#define SLICE_PHASES_SIGN_BIT(t, b) p[SLICE_PHASES_BIT_PHASE(t, b) * SLICE_PHASES_STRIDE + SLICE_PHASES_BIT_OFFSET(t, b)]
+    SLICE_PHASES_FOR_EACH_BYTE(uint8_t, flat, SLICE_PHASES_SIGN_BIT)
+#undef SLICE_PHASES_SIGN_BIT
+}
+
+// Slice each bit of each phase separately, as demodulate2400 used to
+static inline void slice_phases_scalar(const uint16_t *in, unsigned bytes, unsigned phase_mask, uint8_t *out)
+{
+#define SLICE_PHASES_CORRELATE_BIT(t, b) (slice_correlate(&p[SLICE_PHASES_BIT_OFFSET(t, b)], SLICE_PHASES_BIT_PHASE(t, b)) > 0)
+    SLICE_PHASES_FOR_EACH_BYTE(uint16_t, in, SLICE_PHASES_CORRELATE_BIT)
+#undef SLICE_PHASES_CORRELATE_BIT
+}
+
+// Evaluate all five correlations at every sample position (vectorizable)
+static inline void slice_phases_dense(const uint16_t *in, unsigned bytes, uint8_t sign[5][SLICE_PHASES_STRIDE])
+{
+    const unsigned positions = SLICE_PHASES_POSITIONS_PADDED(bytes);
+    for (unsigned i = 0; i < positions; ++i) {
+        // The correlations rewritten in terms of sample differences, and
+        // with only shifts and adds, which vectorize much better than
+        // 32-bit multiplies:
+        //   phase 0: 5 * m0 - 3 * m1 - 2 * m2      = 5 * d01 + 2 * d12
+        //   phase 1: 4 * m0 - m1 - 3 * m2          = 4 * d01 + 3 * d12
+        //   phase 2: 3 * m0 + m1 - 4 * m2          = 3 * d01 + 4 * d12
+        //   phase 3: 2 * m0 + 3 * m1 - 5 * m2      = 2 * d01 + 5 * d12
+        //   phase 4: m0 + 5 * m1 - 5 * m2 - m3     = d01 + 6 * d12 + d23
+        const int d01 = in[i] - in[i + 1];
+        const int d12 = in[i + 1] - in[i + 2];
+        const int d23 = in[i + 2] - in[i + 3];
+        const int d01x2 = d01 + d01, d12x2 = d12 + d12;
+        const int d01x4 = d01x2 + d01x2, d12x4 = d12x2 + d12x2;
+
+        sign[0][i] = (d01x4 + d01 + d12x2) > 0;
+        sign[1][i] = (d01x4 + d12x2 + d12) > 0;
+        sign[2][i] = (d01x2 + d01 + d12x4) > 0;
+        sign[3][i] = (d01x2 + d12x4 + d12) > 0;
+        sign[4][i] = (d01 + d12x4 + d12x2 + d23) > 0;
+    }
+}
+
+#endif /* DSP_SLICE_PHASES_HELPERS */
+
+void STARCH_IMPL(slice_phases_u16, scalar) (const uint16_t *in, unsigned bytes, unsigned phase_mask, uint8_t *out)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+    slice_phases_scalar(in_align, bytes, phase_mask, out);
+}
+
+/* Evaluate all five correlations at every sample position, then pick out
+ * the decisions that each phase needs. */
+void STARCH_IMPL(slice_phases_u16, dense) (const uint16_t *in, unsigned bytes, unsigned phase_mask, uint8_t *out)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+    uint8_t sign[5][SLICE_PHASES_STRIDE];
+
+    slice_phases_dense(in_align, bytes, sign);
+    slice_phases_pack(sign, bytes, phase_mask, out);
+}
+
+/* The dense version does a fixed amount of work regardless of phase_mask;
+ * with only a few phases to slice, the scalar version is cheaper. */
+void STARCH_IMPL(slice_phases_u16, hybrid) (const uint16_t *in, unsigned bytes, unsigned phase_mask, uint8_t *out)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+
+    if (bytes > 1 && __builtin_popcount(phase_mask) <= 3) {
+        slice_phases_scalar(in_align, bytes, phase_mask, out);
+    } else {
+        uint8_t sign[5][SLICE_PHASES_STRIDE];
+        slice_phases_dense(in_align, bytes, sign);
+        slice_phases_pack(sign, bytes, phase_mask, out);
+    }
+}
+
+#ifdef STARCH_FEATURE_NEON
+
+#include <arm_neon.h>
+
+void STARCH_IMPL_REQUIRES(slice_phases_u16, neon, STARCH_FEATURE_NEON) (const uint16_t *in, unsigned bytes, unsigned phase_mask, uint8_t *out)
+{
+    const uint16_t * restrict in_align = STARCH_ALIGNED(in);
+
+    /* as for the hybrid version, few phases are cheaper to do one by one */
+    if (bytes > 1 && __builtin_popcount(phase_mask) <= 3) {
+        slice_phases_scalar(in_align, bytes, phase_mask, out);
+        return;
+    }
+
+    uint8_t sign[5][SLICE_PHASES_STRIDE];
+
+    const int32x4_t zero = vdupq_n_s32(0);
+    const uint8x8_t one = vdup_n_u8(1);
+
+    const unsigned positions = SLICE_PHASES_POSITIONS_PADDED(bytes);
+    for (unsigned i = 0; i < positions; i += 8) {
+        uint16x8_t s0 = vld1q_u16(in_align + i + 0);
+        uint16x8_t s1 = vld1q_u16(in_align + i + 1);
+        uint16x8_t s2 = vld1q_u16(in_align + i + 2);
+        uint16x8_t s3 = vld1q_u16(in_align + i + 3);
+
+        int32x4_t m0_lo = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(s0)));
+        int32x4_t m0_hi = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(s0)));
+        int32x4_t m1_lo = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(s1)));
+        int32x4_t m1_hi = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(s1)));
+        int32x4_t m2_lo = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(s2)));
+        int32x4_t m2_hi = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(s2)));
+        int32x4_t m3_lo = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(s3)));
+        int32x4_t m3_hi = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(s3)));
+
+#define SLICE_PHASES_NEON_STORE(phase, c_lo, c_hi)                      \
+        do {                                                            \
+            uint16x8_t gt = vcombine_u16(vmovn_u32(vcgtq_s32((c_lo), zero)), \
+                                         vmovn_u32(vcgtq_s32((c_hi), zero))); \
+            vst1_u8(&sign[(phase)][i], vand_u8(vmovn_u16(gt), one));    \
+        } while (0)
+
+        // phase 0: 5 * m0 - 3 * m1 - 2 * m2
+        SLICE_PHASES_NEON_STORE(0,
+                                vmlsq_n_s32(vmlsq_n_s32(vmulq_n_s32(m0_lo, 5), m1_lo, 3), m2_lo, 2),
+                                vmlsq_n_s32(vmlsq_n_s32(vmulq_n_s32(m0_hi, 5), m1_hi, 3), m2_hi, 2));
+        // phase 1: 4 * m0 - m1 - 3 * m2
+        SLICE_PHASES_NEON_STORE(1,
+                                vmlsq_n_s32(vsubq_s32(vshlq_n_s32(m0_lo, 2), m1_lo), m2_lo, 3),
+                                vmlsq_n_s32(vsubq_s32(vshlq_n_s32(m0_hi, 2), m1_hi), m2_hi, 3));
+        // phase 2: 3 * m0 + m1 - 4 * m2
+        SLICE_PHASES_NEON_STORE(2,
+                                vsubq_s32(vmlaq_n_s32(m1_lo, m0_lo, 3), vshlq_n_s32(m2_lo, 2)),
+                                vsubq_s32(vmlaq_n_s32(m1_hi, m0_hi, 3), vshlq_n_s32(m2_hi, 2)));
+        // phase 3: 2 * m0 + 3 * m1 - 5 * m2
+        SLICE_PHASES_NEON_STORE(3,
+                                vmlsq_n_s32(vmlaq_n_s32(vshlq_n_s32(m0_lo, 1), m1_lo, 3), m2_lo, 5),
+                                vmlsq_n_s32(vmlaq_n_s32(vshlq_n_s32(m0_hi, 1), m1_hi, 3), m2_hi, 5));
+        // phase 4: m0 + 5 * m1 - 5 * m2 - m3
+        SLICE_PHASES_NEON_STORE(4,
+                                vsubq_s32(vmlaq_n_s32(m0_lo, vsubq_s32(m1_lo, m2_lo), 5), m3_lo),
+                                vsubq_s32(vmlaq_n_s32(m0_hi, vsubq_s32(m1_hi, m2_hi), 5), m3_hi));
+
+#undef SLICE_PHASES_NEON_STORE
+    }
+
+    slice_phases_pack(sign, bytes, phase_mask, out);
+}
+
+#endif /* STARCH_FEATURE_NEON */
@@ -17,9 +17,21 @@ gen.add_include('"cpu.h"')
 
 gen.add_function(name = 'magnitude_uc8', argtypes = ['const uc8_t *', 'uint16_t *', 'unsigned'], aligned = True)
 gen.add_function(name = 'magnitude_power_uc8', argtypes = ['const uc8_t *', 'uint16_t *', 'unsigned', 'double *', 'double *'], aligned = True)
+gen.add_function(name = 'magnitude_power_uc8_u8', argtypes = ['const uc8_t *', 'uint8_t *', 'unsigned', 'double *', 'double *'], aligned = True)
 gen.add_function(name = 'magnitude_sc16', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned'], aligned = True)
 gen.add_function(name = 'magnitude_sc16q11', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned'], aligned = True)
+gen.add_function(name = 'magnitude_power_sc16', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned', 'double *', 'double *'], aligned = True)
+gen.add_function(name = 'magnitude_power_sc16q11', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned', 'double *', 'double *'], aligned = True)
+gen.add_function(name = 'magnitude_dc_uc8', argtypes = ['const uc8_t *', 'uint16_t *', 'unsigned', 'dc_offset_t *'], aligned = True)
+gen.add_function(name = 'magnitude_dc_sc16', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned', 'dc_offset_t *'], aligned = True)
+gen.add_function(name = 'magnitude_dc_sc16q11', argtypes = ['const sc16_t *', 'uint16_t *', 'unsigned', 'dc_offset_t *'], aligned = True)
 gen.add_function(name = 'mean_power_u16', argtypes = ['const uint16_t *', 'unsigned', 'double *', 'double *'], aligned = True)
+gen.add_function(name = 'preamble_scan_u16', argtypes = ['const uint16_t *', 'unsigned', 'uint32_t *', 'unsigned *'], aligned = True)
+gen.add_function(name = 'preamble_scan_u8', argtypes = ['const uint8_t *', 'unsigned', 'uint32_t *', 'unsigned *'], aligned = True)
+gen.add_function(name = 'preamble_correlate_u16', argtypes = ['const uint16_t *', 'unsigned', 'uint32_t *', 'unsigned *'], aligned = True)
+gen.add_function(name = 'slice_phases_u16', argtypes = ['const uint16_t *', 'unsigned', 'unsigned', 'uint8_t *'], aligned = False)
+gen.add_function(name = 'log_histogram_u16', argtypes = ['const uint16_t *', 'unsigned', 'uint32_t *'], aligned = False)
+gen.add_function(name = 'resample_polyphase_u16', argtypes = ['const uint16_t *', 'unsigned', 'unsigned', 'const float *', 'const unsigned *', 'unsigned', 'unsigned', 'uint16_t *'], aligned = False)
 gen.add_function(name = 'count_above_u16', argtypes = ['const uint16_t *', 'unsigned', 'uint16_t', 'unsigned *'], aligned = True)
 
 gen.add_feature(name='neon', description='ARM NEON')
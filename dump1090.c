@@ -51,6 +51,8 @@
 #include "cpu.h"
 
 #include <stdarg.h>
+#include <sched.h>
+#include <sys/mman.h>
 
 struct _Modes Modes;
 
@@ -95,6 +97,11 @@ static void sigtermHandler(int dummy) {
     log_with_timestamp("Caught SIGTERM, shutting down..\n");
 }
 
+static void sigusr1Handler(int dummy) {
+    MODES_NOTUSED(dummy);
+    iqcapture_toggle();       // reported by backgroundTasks
+}
+
 void receiverPositionChanged(float lat, float lon, float alt)
 {
     log_with_timestamp("Autodetected receiver location: %.5f, %.5f at %.0fm AMSL", lat, lon, alt);
@@ -120,6 +127,11 @@ static void modesInitConfig(void) {
     Modes.json_location_accuracy  = 1;
     Modes.maxRange                = 1852 * 300; // 300NM default max range
     Modes.mode_ac_auto            = 1;
+    Modes.sample_rate             = 2400000.0;
+
+    Modes.iqcapture_file_mb       = 256;
+    Modes.iqcapture_files         = 4;
+    Modes.iqcapture_buffer_mb     = 32;
 
     Modes.net_heartbeat_interval = MODES_NET_HEARTBEAT_INTERVAL;
     Modes.net_output_flush_size = 1300;
@@ -153,7 +165,34 @@ static void modesInitConfig(void) {
 static void modesInit(void) {
     int i;
 
-    Modes.sample_rate = 2400000.0;
+    if (Modes.capture_rate == 0)
+        Modes.capture_rate = Modes.sample_rate;
+
+    if (Modes.capture_rate != Modes.sample_rate && !resampler_supported(Modes.capture_rate, Modes.sample_rate)) {
+        fprintf(stderr, "Can't resample from a capture rate of %.3fMHz to %.3fMHz\n",
+                Modes.capture_rate / 1e6, Modes.sample_rate / 1e6);
+        exit(1);
+    }
+
+    // demodulate2000 only has the heuristic preamble scan
+    if (Modes.demod_correlate && Modes.sample_rate != 2400000.0) {
+        fprintf(stderr, "--preamble-detector correlate needs a sample rate of 2.4MHz\n");
+        exit(1);
+    }
+
+    if (Modes.demod_u8) {
+        // The 8-bit path covers the common small-CPU setup only: rtlsdr (or
+        // a UC8 file) at 2.4MHz, Mode S only
+        if ((Modes.sdr_type != SDR_RTLSDR && Modes.sdr_type != SDR_IFILE) ||
+            Modes.sample_rate != 2400000.0 || Modes.capture_rate != Modes.sample_rate ||
+            Modes.dc_filter || Modes.demod_correlate || Modes.mode_ac) {
+            fprintf(stderr, "--demod-u8 needs an rtlsdr or ifile device at a sample rate of 2.4MHz without resampling, and can't be used with --dcfilter, --preamble-detector correlate or --modeac\n");
+            exit(1);
+        }
+
+        Modes.mode_ac_auto = 0;
+        fifo_set_sample_size(sizeof(uint8_t));
+    }
 
     // Allocate the various buffers used by Modes
     Modes.trailing_samples = (MODES_PREAMBLE_US + MODES_LONG_MSG_BITS + 16) * 1e-6 * Modes.sample_rate;
@@ -164,9 +203,11 @@ static void modesInit(void) {
         exit(1);
     }
 
-    if (!fifo_create(MODES_MAG_BUFFERS, MODES_MAG_BUF_SAMPLES + Modes.trailing_samples, Modes.trailing_samples)) {
-        fprintf(stderr, "Out of memory allocating FIFO\n");
-        exit(1);
+    for (unsigned source = 0; source < Modes.sdr_sources; ++source) {
+        if (!fifo_create_source(source, MODES_MAG_BUFFERS, MODES_MAG_BUF_SAMPLES + Modes.trailing_samples, Modes.trailing_samples)) {
+            fprintf(stderr, "Out of memory allocating FIFO\n");
+            exit(1);
+        }
     }
 
     // Validate the users Lat/Lon home location inputs
@@ -209,6 +250,16 @@ static void modesInit(void) {
 
     if (Modes.show_only)
         icaoFilterAdd(Modes.show_only);
+
+    if (Modes.sample_rate == 2000000.0 && Modes.demod_threads > 1) {
+        fprintf(stderr, "warning: --demod-threads is not supported at 2.0MHz, demodulating serially\n");
+        Modes.demod_threads = 1;
+    }
+
+    if (!demodulate2400Init(Modes.demod_threads)) {
+        fprintf(stderr, "Failed to start demodulator threads\n");
+        exit(1);
+    }
 }
 
 //
@@ -230,11 +281,24 @@ static void modesInit(void) {
 // without caring about data acquisition
 //
 
+static atomic_uint reader_threads_running;
+
 static void *readerThreadEntryPoint(void *arg)
 {
-    MODES_NOTUSED(arg);
-
-    sdrRun();
+    unsigned source = (unsigned) (uintptr_t) arg;
+
+    // Modes.reader_policy describes one thread, that of the first source;
+    // the readers for other sources (--add-source) get default scheduling
+    if (source == 0)
+        apply_thread_policy(&Modes.reader_policy, "reader thread");
+    sdrRunSource(source);
+
+    // When one of several input files runs out, just stop its FIFO and let
+    // the others carry on; anything else stops the whole program
+    if (atomic_fetch_sub(&reader_threads_running, 1) > 1 && Modes.sdr_type == SDR_IFILE && !Modes.exit) {
+        fifo_halt_source(source);
+        return NULL;
+    }
 
     if (!Modes.exit)
         Modes.exit = 2; // unexpected exit
@@ -304,15 +368,24 @@ static void showDSP()
         printf("    %-40s %s\n", #x , starch_ ## x ## _select()->name);  \
         printf("    %-40s %s\n", #x "_aligned", starch_ ## x ## _aligned_select()->name); \
     } while(0)
+#define SHOW_UNALIGNED(x) do {                                          \
+        printf("    %-40s %s\n", #x , starch_ ## x ## _select()->name);  \
+    } while(0)
 
     SHOW(magnitude_uc8);
     SHOW(magnitude_power_uc8);
     SHOW(magnitude_sc16);
     SHOW(magnitude_sc16q11);
+    SHOW(magnitude_dc_uc8);
+    SHOW(magnitude_dc_sc16);
+    SHOW(magnitude_dc_sc16q11);
     SHOW(mean_power_u16);
     SHOW(count_above_u16);
+    SHOW(preamble_scan_u16);
+    SHOW_UNALIGNED(slice_phases_u16);
 
 #undef SHOW
+#undef SHOW_UNALIGNED
 
     printf("\n");
 }
@@ -329,6 +402,8 @@ static void showHelp(void)
 // ------ 80 char limit ----------------------------------------------------------|
 "--raw                    Show only messages hex values\n"
 "--modeac                 Enable decoding of SSR Modes 3/A & 3/C\n"
+"--modeac-separate        Demodulate Mode A/C in a separate pass over the\n"
+"                          samples, not together with Mode S (for benchmarking)\n"
 "--mlat                   display raw messages in Beast ascii mode\n"
 "--onlyaddr               Show only ICAO addresses (testing purposes)\n"
 "--metric                 Use metric units (meters, km/h, ...)\n"
@@ -342,9 +417,49 @@ static void showHelp(void)
 // ------ 80 char limit ----------------------------------------------------------|
 "--gain <db>              Set gain in dB (default: varies by SDR type)\n"
 "--freq <hz>              Set frequency (default: 1090 Mhz)\n"
+"--dcfilter               Apply a 1Hz DC filter to input data\n"
+"--sample-rate <MHz>      Set sample rate: 2.4 (default) or 2.0 (uses less CPU\n"
+"                          and USB bandwidth, but may decode fewer messages)\n"
+"--capture-rate <MHz>     Capture at this rate and resample to --sample-rate\n"
+"                          (e.g. 2.56, 3.2 or 6; default: same as --sample-rate)\n"
+"--demod-threads <n>      Split demodulation across <n> worker threads\n"
+"--overload-shedding      When demodulation falls behind the SDR, stop Mode A/C,\n"
+"                          then error correction, then Comm-B inference, then\n"
+"                          slow aircraft.json updates, until it catches up\n"
+"--reader-cpu <n>         Pin the SDR reader thread to CPU <n> (with --add-source:\n"
+"                          the first SDR's reader only)\n"
+"--demod-cpu <n>          Pin the demodulator thread to CPU <n>\n"
+"--reader-priority <p>    Run the SDR reader thread with SCHED_FIFO real-time\n"
+"                          priority <p> (1-99; needs CAP_SYS_NICE; with\n"
+"                          --add-source: the first SDR's reader only)\n"
+"--demod-priority <p>     Run the demodulator threads with SCHED_FIFO real-time\n"
+"                          priority <p> (1-99; needs CAP_SYS_NICE)\n"
+"--mlock                  Lock memory, including the sample buffers, into RAM\n"
+"--iq-capture <dir>       Also write the raw samples from the SDR to files in <dir>\n"
+"--iq-capture-size <MB>   Start a new capture file after <MB> megabytes (default: 256)\n"
+"--iq-capture-files <n>   Keep the newest <n> capture files of each SDR, 0 to keep\n"
+"                          all (default: 4)\n"
+"--iq-capture-buffer <MB> Buffer <MB> megabytes of samples for the capture writer;\n"
+"                          samples that don't fit are left out (default: 32)\n"
+"--iq-capture-on-demand   Capture only while toggled on by SIGUSR1\n"
+"--iq-capture-raw         Write plain sample files rather than compressed .iqz\n"
+"                          containers\n"
+"--preamble-detector <d>  Mode S preamble detector at 2.4MHz: heuristic\n"
+"                          (default, peak/valley tests) or correlate\n"
+"                          (matched filter against a local noise estimate)\n"
+"--demod-u8               Demodulate from 8-bit rather than 16-bit magnitudes;\n"
+"                          less CPU and memory bandwidth for small CPUs, may miss\n"
+"                          a few weak messages (rtlsdr or UC8 ifile, 2.4MHz,\n"
+"                          Mode S only)\n"
+"--score-phases <n>       Score only the <n> phases (1-5) with the fewest weak\n"
+"                          bits for each 2.4MHz preamble, unless none of them\n"
+"                          gives a valid message (default: 5, score all)\n"
 "--fix                    Enable single-bit error correction using CRC\n"
 "--fix-2bit               Enable two-bit error correction using CRC\n"
 "                          (use with caution!)\n"
+"--fix-soft               Also correct two-bit errors in DF17/18 messages by\n"
+"                          flipping the least confident bits (2.4MHz only;\n"
+"                          implies --fix)\n"
 "--no-fix                 Disable error correction using CRC\n"
 "--no-fix-df              Disable error correction of the DF message field\n"
 "                          (reduces CPU requirements)\n"
@@ -427,6 +542,9 @@ static void showHelp(void)
 "      Misc\n"
 "\n"
 "--wisdom <path>          Read DSP wisdom from given path\n"
+"--wisdom-cache <dir>     Benchmark DSP code on first run (or when the CPU\n"
+"                          changes) and cache the resulting wisdom in <dir>\n"
+"--mirror-fifo            Use a mirror-mapped sample ring (avoids overlap copies)\n"
 "--version                Show version, build and DSP options\n"
 "--help                   Show this help\n"
     );
@@ -478,6 +596,7 @@ static void backgroundTasks(void) {
 
     // copy out reader CPU time and reset it
     sdrUpdateCPUTime(&Modes.stats_current.reader_cpu);
+    iqcapture_update_stats(&Modes.stats_current);
 
     // always update end time so it is current when requests arrive
     Modes.stats_current.end = mstime();
@@ -541,7 +660,7 @@ static void backgroundTasks(void) {
 
     if (Modes.json_dir && now >= next_json) {
         writeJsonToFile("aircraft.json", generateAircraftJson);
-        next_json = now + Modes.json_interval;
+        next_json = now + Modes.json_interval * (Modes.overload_level >= OVERLOAD_SLOW_JSON ? OVERLOAD_JSON_INTERVAL_FACTOR : 1);
     }
 
     if (now >= next_history) {
@@ -589,6 +708,8 @@ static void applyNetDefaults()
 
 int main(int argc, char **argv) {
     int j;
+    const char *wisdom_cache = NULL;
+    bool wisdom_read = false;
 
     // Set sane defaults
     modesInitConfig();
@@ -603,16 +724,78 @@ int main(int argc, char **argv) {
 
         if (!strcmp(argv[j],"--freq") && more) {
             Modes.freq = (int) strtoll(argv[++j],NULL,10);
-        } else if ( (!strcmp(argv[j], "--device") || !strcmp(argv[j], "--device-index")) && more) {
+        } else if ( (!strcmp(argv[j], "--device") || !strcmp(argv[j], "--device-index")) && more && Modes.sdr_sources == 1) {
             Modes.dev_name = strdup(argv[++j]);
         } else if (!strcmp(argv[j],"--gain") && more) {
             Modes.gain = atof(argv[++j]);
         } else if (!strcmp(argv[j],"--dcfilter")) {
-#if 0
             Modes.dc_filter = 1;
-#else
-            fprintf(stderr, "--dcfilter option ignored (please raise an issue on github if you have a usecase that needs this)\n");
-#endif
+        } else if (!strcmp(argv[j],"--sample-rate") && more) {
+            double rate = atof(argv[++j]);
+            if (rate == 2.0 || rate == 2000000.0) {
+                Modes.sample_rate = 2000000.0;
+            } else if (rate == 2.4 || rate == 2400000.0) {
+                Modes.sample_rate = 2400000.0;
+            } else {
+                fprintf(stderr, "Unsupported --sample-rate %s (use 2.4 or 2.0)\n", argv[j]);
+                exit(1);
+            }
+        } else if (!strcmp(argv[j],"--capture-rate") && more) {
+            double rate = atof(argv[++j]);
+            Modes.capture_rate = round(rate < 1000 ? rate * 1e6 : rate);
+        } else if (!strcmp(argv[j],"--preamble-detector") && more) {
+            const char *detector = argv[++j];
+            if (!strcmp(detector, "heuristic")) {
+                Modes.demod_correlate = false;
+            } else if (!strcmp(detector, "correlate")) {
+                Modes.demod_correlate = true;
+            } else {
+                fprintf(stderr, "Unsupported --preamble-detector %s (use heuristic or correlate)\n", detector);
+                exit(1);
+            }
+        } else if (!strcmp(argv[j],"--demod-u8")) {
+            Modes.demod_u8 = true;
+        } else if (!strcmp(argv[j],"--score-phases") && more) {
+            int phases = atoi(argv[++j]);
+            if (phases < 1) {
+                fprintf(stderr, "Unsupported --score-phases %s (use 1-5)\n", argv[j]);
+                exit(1);
+            }
+            // scoring all five phases doesn't need the quality metric
+            Modes.score_phases = (phases < 5 ? phases : 0);
+        } else if (!strcmp(argv[j],"--overload-shedding")) {
+            Modes.overload_shedding = true;
+        } else if ((!strcmp(argv[j],"--reader-cpu") || !strcmp(argv[j],"--demod-cpu")) && more) {
+            struct thread_policy *policy = (argv[j][2] == 'r' ? &Modes.reader_policy : &Modes.demod_policy);
+            policy->pin = true;
+            policy->cpu = atoi(argv[++j]);
+        } else if ((!strcmp(argv[j],"--reader-priority") || !strcmp(argv[j],"--demod-priority")) && more) {
+            struct thread_policy *policy = (argv[j][2] == 'r' ? &Modes.reader_policy : &Modes.demod_policy);
+            policy->priority = atoi(argv[++j]);
+            if (policy->priority < sched_get_priority_min(SCHED_FIFO) || policy->priority > sched_get_priority_max(SCHED_FIFO)) {
+                fprintf(stderr, "Unsupported %s %s (use %d-%d)\n", argv[j-1], argv[j],
+                        sched_get_priority_min(SCHED_FIFO), sched_get_priority_max(SCHED_FIFO));
+                exit(1);
+            }
+        } else if (!strcmp(argv[j],"--mlock")) {
+            Modes.mlock = true;
+        } else if (!strcmp(argv[j],"--iq-capture") && more) {
+            Modes.iqcapture_dir = strdup(argv[++j]);
+        } else if (!strcmp(argv[j],"--iq-capture-size") && more) {
+            Modes.iqcapture_file_mb = atoi(argv[++j]);
+        } else if (!strcmp(argv[j],"--iq-capture-files") && more) {
+            Modes.iqcapture_files = atoi(argv[++j]);
+        } else if (!strcmp(argv[j],"--iq-capture-buffer") && more) {
+            Modes.iqcapture_buffer_mb = atoi(argv[++j]);
+        } else if (!strcmp(argv[j],"--iq-capture-on-demand")) {
+            Modes.iqcapture_on_demand = true;
+        } else if (!strcmp(argv[j],"--iq-capture-raw")) {
+            Modes.iqcapture_raw = true;
+        } else if (!strcmp(argv[j],"--demod-threads") && more) {
+            int threads = atoi(argv[++j]);
+            if (threads > MODES_MAX_DEMOD_THREADS)
+                threads = MODES_MAX_DEMOD_THREADS;
+            Modes.demod_threads = (threads > 0 ? threads : 1);
         } else if (!strcmp(argv[j],"--measure-noise")) {
             // Ignored
         } else if (!strcmp(argv[j],"--fix")) {
@@ -622,8 +805,13 @@ int main(int argc, char **argv) {
             Modes.nfix_crc = 2;
         } else if (!strcmp(argv[j],"--enable-df24")) {
             Modes.enable_df24 = 1;
+        } else if (!strcmp(argv[j],"--fix-soft")) {
+            if (Modes.nfix_crc < 1)
+                Modes.nfix_crc = 1;
+            Modes.fix_soft = 1;
         } else if (!strcmp(argv[j],"--no-fix")) {
             Modes.nfix_crc = 0;
+            Modes.fix_soft = 0;
         } else if (!strcmp(argv[j],"--no-fix-df")) {
             Modes.fix_df = 0;
         } else if (!strcmp(argv[j],"--no-crc-check")) {
@@ -638,6 +826,8 @@ int main(int argc, char **argv) {
         } else if (!strcmp(argv[j],"--modeac")) {
             Modes.mode_ac = 1;
             Modes.mode_ac_auto = 0;
+        } else if (!strcmp(argv[j],"--modeac-separate")) {
+            Modes.modeac_separate = true;
         } else if (!strcmp(argv[j],"--no-modeac-auto")) {
             Modes.mode_ac_auto = 0;
         } else if (!strcmp(argv[j],"--net-beast")) {
@@ -766,6 +956,11 @@ int main(int argc, char **argv) {
                         "Failed to read wisdom file %s: %s\n", argv[j], strerror(errno));
                 exit(1);
             }            
+            wisdom_read = true;
+        } else if (!strcmp(argv[j], "--wisdom-cache") && more) {
+            wisdom_cache = argv[++j];
+        } else if (!strcmp(argv[j], "--mirror-fifo")) {
+            fifo_set_mirror(true);
         } else if (!strcmp(argv[j], "--adaptive-min-gain") && more) {
             Modes.adaptive_min_gain_db = atof(argv[++j]);
         } else if (!strcmp(argv[j], "--adaptive-max-gain") && more) {
@@ -823,6 +1018,11 @@ int main(int argc, char **argv) {
 
     // Initialization
     log_with_timestamp("%s %s starting up.", MODES_DUMP1090_VARIANT, MODES_DUMP1090_VERSION);
+
+    // An explicit --wisdom takes precedence over the cache
+    if (wisdom_cache && !wisdom_read && Modes.sdr_type != SDR_NONE)
+        autotune_load_wisdom(wisdom_cache, AUTOTUNE_DEFAULT_TIMEOUT);
+
     modesInit();
 
     if (!sdrOpen()) {
@@ -845,6 +1045,8 @@ int main(int argc, char **argv) {
         Modes.stats_1min[j].start = Modes.stats_1min[j].end = Modes.stats_current.start;
 
     adaptive_init();
+    if (Modes.overload_shedding)
+        overload_init();
 
     // write initial json files so they're not missing
     writeJsonToFile("receiver.json", generateReceiverJson);
@@ -869,8 +1071,32 @@ int main(int argc, char **argv) {
     } else {
         int watchdogCounter = 300; // about 30 seconds
 
-        // Create the thread that will read the data from the device.
-        pthread_create(&Modes.reader_thread, NULL, readerThreadEntryPoint, NULL);
+        if (Modes.iqcapture_dir) {
+            if (!iqcapture_init())
+                exit(1);
+            if (Modes.iqcapture_on_demand)
+                signal(SIGUSR1, sigusr1Handler);
+        }
+
+        // Lock everything allocated so far (notably the sample buffers) into RAM.
+        // Not MCL_FUTURE: later allocations could then fail outright when they
+        // exceed RLIMIT_MEMLOCK.
+        if (Modes.mlock) {
+            if (mlockall(MCL_CURRENT) < 0) {
+                snprintf(Modes.mlock_error, sizeof(Modes.mlock_error), "%s", strerror(errno));
+                fprintf(stderr, "can't lock memory: %s\n", Modes.mlock_error);
+            } else {
+                Modes.mlocked = true;
+            }
+        }
+
+        // Create the threads that will read the data from the devices.
+        atomic_store(&reader_threads_running, Modes.sdr_sources);
+        for (unsigned source = 0; source < Modes.sdr_sources; ++source)
+            pthread_create(&Modes.reader_threads[source], NULL, readerThreadEntryPoint, (void *) (uintptr_t) source);
+
+        // (only now, so that the reader threads don't inherit it)
+        apply_thread_policy(&Modes.demod_policy, "demodulator thread");
 
         while (!Modes.exit) {
             // get the next sample buffer off the FIFO; wait only up to 100ms
@@ -882,15 +1108,42 @@ int main(int argc, char **argv) {
                 // Process one buffer
 
                 start_cpu_timing(&start_time);
-                demodulate2400(buf);
-                if (Modes.mode_ac) {
-                    demodulate2400AC(buf);
+                if (Modes.overload_shedding)
+                    overload_begin_buffer();
+                adaptive_begin_buffer(buf);
+
+                bool mode_ac = (Modes.mode_ac && Modes.overload_level < OVERLOAD_NO_MODEAC);
+                if (Modes.sample_rate == 2000000.0) {
+                    demodulate2000(buf);
+                    if (mode_ac) {
+                        demodulate2000AC(buf);
+                    }
+                } else {
+                    if (mode_ac) {
+                        demodulate2400WithAC(buf);
+                    } else {
+                        demodulate2400(buf);
+                    }
                 }
 
+                // Pass on the messages found in the buffer
+                deliverModesMessages();
+
                 Modes.stats_current.samples_processed += buf->validLength - buf->overlap;
                 Modes.stats_current.samples_dropped += buf->dropped;
+                Modes.stats_current.source_samples_processed[buf->source] += buf->validLength - buf->overlap;
+                Modes.stats_current.source_samples_dropped[buf->source] += buf->dropped;
+                for (int cause = 0; cause < MAGBUF_DROP_CAUSES; ++cause) {
+                    if (buf->dropped_by_cause[cause]) {
+                        Modes.stats_current.samples_dropped_by_cause[cause] += buf->dropped_by_cause[cause];
+                        ++Modes.stats_current.discontinuities[cause];
+                    }
+                }
                 end_cpu_timing(&start_time, &Modes.stats_current.demod_cpu);
 
+                if (Modes.overload_shedding)
+                    overload_end_buffer(buf);
+
                 // Return the buffer to the FIFO freelist for reuse
                 fifo_release(buf);
 
@@ -910,14 +1163,20 @@ int main(int argc, char **argv) {
         }
 
         log_with_timestamp("Waiting for receive thread termination");
-        sdrStop();   // tell reader thread to wake up and exit
-        fifo_halt(); // Reader thread should do this anyway, but just in case..
+        sdrStop();   // tell reader threads to wake up and exit
+        fifo_halt(); // Reader threads should do this anyway, but just in case..
 
         // Wait on reader thread exit
-        if (join_thread(Modes.reader_thread, NULL, 30000) == ETIMEDOUT) {
-            log_with_timestamp("Receive thread did not shut down cleanly in 30 seconds, aborting.");
-            abort(); // Can't complete cleanup while the receive thread is active; bail out.
+        for (unsigned source = 0; source < Modes.sdr_sources; ++source) {
+            if (join_thread(Modes.reader_threads[source], NULL, 30000) == ETIMEDOUT) {
+                log_with_timestamp("Receive thread did not shut down cleanly in 30 seconds, aborting.");
+                abort(); // Can't complete cleanup while the receive thread is active; bail out.
+            }
         }
+
+        // write out the rest of any capture
+        iqcapture_shutdown();
+        iqcapture_update_stats(&Modes.stats_current);
     }
 
     interactiveCleanup();
@@ -930,6 +1189,8 @@ int main(int argc, char **argv) {
     }
 
     sdrClose();
+    demodulate2400Cleanup();
+    modesMessageQueueCleanup();
     fifo_destroy();
 
     if (Modes.exit == 1) {
@@ -287,13 +287,18 @@ typedef enum {
 #include "net_io.h"
 #include "crc.h"
 #include "demod_2400.h"
+#include "demod_2000.h"
+#include "fifo.h"
+#include "overload.h"
 #include "stats.h"
 #include "cpr.h"
 #include "icao_filter.h"
 #include "convert.h"
+#include "iqcapture.h"
+#include "resample.h"
 #include "sdr.h"
-#include "fifo.h"
 #include "adaptive.h"
+#include "autotune.h"
 
 //======================== structure declarations =========================
 
@@ -303,20 +308,43 @@ typedef enum {
 
 // Program global state
 struct _Modes {                             // Internal state
-    pthread_t       reader_thread;
+    pthread_t       reader_threads[MAGBUF_MAX_SOURCES];   // one per SDR source
 
     pthread_mutex_t reader_cpu_mutex;                     // mutex protecting reader_cpu_accumulator
-    struct timespec reader_cpu_accumulator;               // accumulated CPU time used by the reader thread
-    struct timespec reader_cpu_start;                     // start time for the last reader thread CPU measurement
+    struct timespec reader_cpu_accumulator;               // accumulated CPU time used by the reader threads
+    struct timespec reader_cpu_start[MAGBUF_MAX_SOURCES]; // start time for the last CPU measurement of each reader thread
 
     unsigned        trailing_samples;                     // extra trailing samples in magnitude buffers
     double          sample_rate;                          // actual sample rate in use (in hz)
+    double          capture_rate;                         // rate the SDR captures at, resampled to sample_rate (in hz)
 
     uint16_t       *log10lut;        // Magnitude -> log10 lookup table
     atomic_int      exit;            // Exit from the main loop when true (2 = unclean exit)
 
     // Sample conversion
     int            dc_filter;        // should we apply a DC filter?
+    unsigned       demod_threads;    // number of demodulator worker threads (<= 1: demodulate serially)
+    bool           demod_correlate;  // find 2.4MHz preambles with the matched filter, not the peak/valley tests
+    bool           demod_u8;         // demodulate 8-bit rather than 16-bit magnitudes (UC8 input at 2.4MHz only)
+    unsigned       score_phases;     // score only this many of the best 2.4MHz phases first (0: score all)
+    bool           modeac_separate;  // demodulate 2.4MHz Mode A/C in its own pass, not fused with Mode S
+    bool           overload_shedding; // shed optional work when the demodulator falls behind
+    overload_level_t overload_level; // current overload shedding level
+
+    // Pipeline thread scheduling
+    struct thread_policy reader_policy; // scheduling of the SDR reader thread
+    struct thread_policy demod_policy;  // scheduling of the main (demodulator) thread and demodulator workers
+    bool           mlock;            // lock all memory, including the sample buffers, into RAM
+    bool           mlocked;          // memory was locked
+    char           mlock_error[128]; // why memory could not be locked, empty if it was
+
+    // Raw sample capture
+    char          *iqcapture_dir;       // --iq-capture: directory to write captures to, NULL if disabled
+    unsigned       iqcapture_file_mb;   // rotate capture files at this size
+    unsigned       iqcapture_files;     // keep this many capture files per source, 0 to keep all
+    unsigned       iqcapture_buffer_mb; // write-behind buffer size
+    bool           iqcapture_on_demand; // only capture while toggled on by SIGUSR1
+    bool           iqcapture_raw;       // write plain sample files rather than .iqz containers
 
     // RTLSDR and some other SDRs
     char *        dev_name;
@@ -344,9 +372,11 @@ struct _Modes {                             // Internal state
 
     // Configuration
     sdr_type_t sdr_type;             // where are we getting data from?
+    unsigned sdr_sources;            // number of devices of that type to read from (--add-source)
     int   nfix_crc;                  // Number of crc bit error(s) to correct
     int   check_crc;                 // Only display messages with good CRC
     int   fix_df;                    // Try to correct damage to the DF field, as well as the main message body
+    int   fix_soft;                  // Try flipping the least confident bits before using the syndrome table
     int   enable_df24;               // Enable decoding of DF24..DF31 (Comm-D ELM)
     int   raw;                       // Raw output format
     int   mode_ac;                   // Enable decoding of SSR Modes A & C
@@ -445,6 +475,8 @@ struct modesMessage {
     int           msgtype;                        // Downlink format #
     uint32_t      crc;                            // Message CRC
     int           correctedbits;                  // No. of bits corrected
+    fix_type      fixtype;                        // How the bits were corrected
+    const uint16_t *confidence;                   // Per-bit slicer confidence for soft-decision correction, or NULL (only used by decodeModesMessage)
     uint32_t      addr;                           // Address Announced
     addrtype_t    addrtype;                       // address format / source
     uint64_t      timestampMsg;                   // Timestamp of the message (12MHz clock)
@@ -455,6 +487,7 @@ struct modesMessage {
     int           reliable;                       // is this a "reliable" message (uncorrected DF11/DF17/DF18)?
 
     datasource_t  source;                         // Characterizes the overall message source
+    unsigned      sdr_source;                     // Local messages: index of the SDR source that received it (--add-source)
 
     // Raw data, just extracted directly from the message
     // The names reflect the field names in Annex 4
@@ -26,26 +26,478 @@
 #include <string.h>
 #include <pthread.h>
 #include <assert.h>
+#include <limits.h>
+#include <time.h>
+#include <stdatomic.h>
 
-static pthread_mutex_t fifo_mutex = PTHREAD_MUTEX_INITIALIZER;        // mutex protecting the queues
-static pthread_cond_t fifo_notempty_cond = PTHREAD_COND_INITIALIZER;  // condition used to signal FIFO-not-empty
-static pthread_cond_t fifo_empty_cond = PTHREAD_COND_INITIALIZER;     // condition used to signal FIFO-empty
-static pthread_cond_t fifo_free_cond = PTHREAD_COND_INITIALIZER;      // condition used to signal freelist-not-empty
-static struct mag_buf *fifo_head;          // head of queued buffers awaiting demodulation
-static struct mag_buf *fifo_tail;          // tail of queued buffers awaiting demodulation
-static struct mag_buf *fifo_freelist;      // freelist of preallocated buffers
-static bool fifo_halted;                   // true if queue has been halted
+#include <unistd.h>
+#include <sys/mman.h>
 
-static unsigned overlap_length;     // desired overlap size in samples (size of overlap_buffer)
-static uint16_t *overlap_buffer;    // buffer used to save overlapping data
+#ifdef __linux__
+#  include <sys/syscall.h>
+#  include <linux/futex.h>
+#endif
+
+static fifo_impl_t fifo_impl = FIFO_IMPL_LOCKFREE;   // implementation used by the next fifo_create()
+
+//
+// Mirror-mapped sample ring (optional).
+//
+// Instead of giving each buffer its own allocation and copying the overlap
+// region on every enqueue, all buffers are carved out of a single ring of
+// samples that is mapped twice, back to back, so that any window of up to
+// the ring size is contiguous in memory. The SDR thread writes samples
+// sequentially into the ring; each buffer's data pointer starts "overlap"
+// samples before its new data, so the overlap region is simply the tail of
+// the previous buffer and needs no copying.
+//
+// When a buffer is discontinuous, the overlap region must read as zeros but
+// the previous buffer (which may still be being demodulated) owns that memory.
+// So each buffer reserves "overlap" extra samples of slack, and a
+// discontinuous buffer has its new data moved up by "overlap" samples with
+// zeros written in front. This is only a memmove on (rare) discontinuities.
+//
+// Buffers must be released in the same order they were dequeued (the
+// demodulator does this), so that the ring space in use is always a single
+// contiguous region.
+//
+
+static bool fifo_mirror_requested;  // use the mirror-mapped ring on the next fifo_create
+static unsigned fifo_sample_size = sizeof(uint16_t); // bytes per sample for the next fifo_create
+
+//
+// Mutex-based implementation.
+//
+// All queue state is protected by a single mutex per source; the SDR thread
+// and the demodulator thread both take it for every buffer handoff.
+//
+
+//
+// Lock-free implementation.
+//
+// There is exactly one producer (the SDR thread: fifo_acquire / fifo_enqueue /
+// fifo_drain) and one consumer (the demodulator thread: fifo_dequeue /
+// fifo_release), so buffers move between the two threads via a pair of
+// single-producer/single-consumer rings of buffer pointers:
+//
+//   free ring:  consumer (fifo_release) -> producer (fifo_acquire)
+//   queue ring: producer (fifo_enqueue) -> consumer (fifo_dequeue)
+//
+// Each ring has room for every buffer, so a push can never fail. The fast
+// path is a couple of atomic loads/stores with no syscalls; a thread that has
+// to block waits on an event (a futex on Linux, a condition variable elsewhere)
+// and the other side only makes a wakeup syscall if somebody is actually waiting.
+//
+
+// Simple eventcount: waiters sample "seq", re-check their condition, then
+// sleep until "seq" changes. Signallers bump "seq" and wake only if there
+// are registered waiters.
+struct fifo_event {
+    atomic_uint seq;
+    atomic_uint waiters;
+#ifndef __linux__
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+#endif
+};
+
+struct fifo_ring {
+    struct mag_buf **slots;
+    unsigned mask;                        // ring size - 1; ring size is a power of two
+    _Alignas(64) atomic_uint head;        // next slot to pop, written only by the popping thread
+    _Alignas(64) atomic_uint tail;        // next slot to push, written only by the pushing thread
+    _Alignas(64) struct fifo_event pushed; // signalled after each push
+};
+
+//
+// Each sample source has its own FIFO: its own buffers, overlap state and queues.
+// There is still a single consumer (the demodulator thread), which takes
+// buffers from all sources in turn.
+//
+
+struct fifo_source {
+    struct mag_buf **buffers;      // every preallocated buffer, regardless of where it currently lives
+    unsigned buffer_count;         // number of entries in buffers
+    atomic_bool halted;            // true if queue has been halted
+
+    unsigned sample_size;          // bytes per sample
+    unsigned overlap_length;       // desired overlap size in samples (size of overlap_buffer)
+    uint8_t *overlap_buffer;       // buffer used to save overlapping data
+
+    // mirror-mapped ring
+    uint8_t *mirror_base;          // start of the first mapping; the second mapping follows immediately
+    size_t mirror_bytes;           // size of one mapping, in bytes
+    uint64_t mirror_samples;       // size of one mapping, in samples
+    uint64_t mirror_wpos;          // ring position (in samples, not wrapped) of the next new sample; producer only
+
+    // mutex-based implementation
+    pthread_mutex_t mutex;         // mutex protecting the queues
+    pthread_cond_t notempty_cond;  // condition used to signal FIFO-not-empty
+    pthread_cond_t empty_cond;     // condition used to signal FIFO-empty
+    pthread_cond_t free_cond;      // condition used to signal freelist-not-empty
+    struct mag_buf *head;          // head of queued buffers awaiting demodulation
+    struct mag_buf *tail;          // tail of queued buffers awaiting demodulation
+    struct mag_buf *freelist;      // freelist of preallocated buffers
+
+    // lock-free implementation
+    struct fifo_ring free_ring;
+    struct fifo_ring queue_ring;
+    struct fifo_event queue_emptied;   // signalled when the consumer empties the queue ring
+};
+
+static struct fifo_source fifo_sources[MAGBUF_MAX_SOURCES];
+static unsigned fifo_source_count;      // 1 + the highest source index created
+static unsigned fifo_next_dequeue;      // source to try first on the next fifo_dequeue
+static struct fifo_event fifo_any_enqueued; // signalled on every enqueue or halt, when there are several sources
+
+static void event_init(struct fifo_event *ev)
+{
+    atomic_init(&ev->seq, 0);
+    atomic_init(&ev->waiters, 0);
+#ifndef __linux__
+    pthread_mutex_init(&ev->mutex, NULL);
+    pthread_cond_init(&ev->cond, NULL);
+#endif
+}
+
+static void event_destroy(struct fifo_event *ev)
+{
+#ifndef __linux__
+    pthread_mutex_destroy(&ev->mutex);
+    pthread_cond_destroy(&ev->cond);
+#else
+    (void) ev;
+#endif
+}
+
+static void event_wake(struct fifo_event *ev)
+{
+#ifdef __linux__
+    syscall(SYS_futex, &ev->seq, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+#else
+    pthread_mutex_lock(&ev->mutex);
+    pthread_cond_broadcast(&ev->cond);
+    pthread_mutex_unlock(&ev->mutex);
+#endif
+}
+
+static void event_signal(struct fifo_event *ev)
+{
+    // Both operations are seq_cst: either the waiter sees the new seq value,
+    // or we see the waiter's registration and wake it.
+    atomic_fetch_add(&ev->seq, 1);
+    if (atomic_load(&ev->waiters))
+        event_wake(ev);
+}
+
+// Register as a waiter and return the current sequence value.
+// The caller must re-check its wait condition before calling event_wait,
+// and must call event_end_wait afterwards.
+static unsigned event_begin_wait(struct fifo_event *ev)
+{
+    atomic_fetch_add(&ev->waiters, 1);
+    return atomic_load(&ev->seq);
+}
+
+static void event_end_wait(struct fifo_event *ev)
+{
+    atomic_fetch_sub(&ev->waiters, 1);
+}
+
+// Wait until ev->seq differs from "seen", or until the (CLOCK_REALTIME) deadline
+// passes if deadline is non-NULL. Returns false on timeout. Spurious wakeups
+// are possible; the caller should re-check its condition.
+static bool event_wait(struct fifo_event *ev, unsigned seen, const struct timespec *deadline, const char *what)
+{
+#ifdef __linux__
+    long res;
+    if (deadline)
+        res = syscall(SYS_futex, &ev->seq, FUTEX_WAIT_BITSET_PRIVATE | FUTEX_CLOCK_REALTIME, seen, deadline, NULL, FUTEX_BITSET_MATCH_ANY);
+    else
+        res = syscall(SYS_futex, &ev->seq, FUTEX_WAIT_PRIVATE, seen, NULL, NULL, 0);
+
+    if (res < 0) {
+        if (errno == ETIMEDOUT)
+            return false;
+        if (errno != EAGAIN && errno != EINTR)
+            fprintf(stderr, "%s: futex wait unexpectedly returned %s\n", what, strerror(errno));
+    }
+    return true;
+#else
+    bool result = true;
+    pthread_mutex_lock(&ev->mutex);
+    while (atomic_load(&ev->seq) == seen) {
+        int err = deadline ? pthread_cond_timedwait(&ev->cond, &ev->mutex, deadline) : pthread_cond_wait(&ev->cond, &ev->mutex);
+        if (err) {
+            if (err != ETIMEDOUT)
+                fprintf(stderr, "%s: pthread_cond_timedwait unexpectedly returned %s\n", what, strerror(err));
+            result = false;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&ev->mutex);
+    return result;
+#endif
+}
+
+static bool ring_init(struct fifo_ring *ring, unsigned count)
+{
+    unsigned size = 1;
+    while (size < count)
+        size <<= 1;
+
+    if (!(ring->slots = calloc(size, sizeof(ring->slots[0]))))
+        return false;
+
+    ring->mask = size - 1;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    event_init(&ring->pushed);
+    return true;
+}
+
+static void ring_destroy(struct fifo_ring *ring)
+{
+    if (!ring->slots)
+        return;
+    free(ring->slots);
+    ring->slots = NULL;
+    event_destroy(&ring->pushed);
+}
+
+static bool ring_empty(struct fifo_ring *ring)
+{
+    return atomic_load_explicit(&ring->head, memory_order_relaxed) == atomic_load_explicit(&ring->tail, memory_order_acquire);
+}
+
+// Push a buffer; only called by the ring's producer.
+// The ring is sized to hold every buffer, so this cannot overflow.
+static void ring_push(struct fifo_ring *ring, struct mag_buf *buf)
+{
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    assert(tail - atomic_load_explicit(&ring->head, memory_order_acquire) <= ring->mask);
+    ring->slots[tail & ring->mask] = buf;
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    event_signal(&ring->pushed);
+}
+
+// Pop a buffer, or return NULL if the ring is empty; only called by the ring's consumer.
+static struct mag_buf *ring_pop(struct fifo_ring *ring)
+{
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    if (head == atomic_load_explicit(&ring->tail, memory_order_acquire))
+        return NULL;
+    struct mag_buf *buf = ring->slots[head & ring->mask];
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return buf;
+}
+
+// Pop a buffer, waiting up to timeout_ms for one to arrive.
+// Returns NULL on timeout or if the source's FIFO is halted.
+static struct mag_buf *ring_pop_wait(struct fifo_source *fs, struct fifo_ring *ring, uint32_t timeout_ms, const char *what)
+{
+    struct timespec deadline;
+    if (timeout_ms)
+        get_deadline(timeout_ms, &deadline);
+
+    for (;;) {
+        if (atomic_load(&fs->halted))
+            return NULL;
+
+        struct mag_buf *buf = ring_pop(ring);
+        if (buf || !timeout_ms)
+            return buf;
+
+        unsigned seen = event_begin_wait(&ring->pushed);
+        bool waited = true;
+        if (!atomic_load(&fs->halted) && ring_empty(ring))
+            waited = event_wait(&ring->pushed, seen, &deadline, what);
+        event_end_wait(&ring->pushed);
+
+        if (!waited)
+            return NULL; // timed out
+    }
+}
+
+void fifo_set_mirror(bool enable)
+{
+    fifo_mirror_requested = enable;
+}
+
+bool fifo_is_mirrored()
+{
+    return fifo_sources[0].mirror_base != NULL;
+}
+
+void fifo_set_sample_size(unsigned bytes)
+{
+    fifo_sample_size = bytes;
+}
+
+unsigned fifo_get_sample_size()
+{
+    return fifo_sample_size;
+}
+
+void *mag_buf_sample(struct mag_buf *buf, unsigned n)
+{
+    return (uint8_t *) buf->data + (size_t) n * fifo_sources[buf->source].sample_size;
+}
+
+static int mirror_create_fd(size_t bytes)
+{
+    int fd = -1;
+
+#if defined(__linux__) && defined(SYS_memfd_create)
+    fd = syscall(SYS_memfd_create, "dump1090-fifo", 0);
+#else
+    char path[] = "/tmp/dump1090-fifo-XXXXXX";
+    if ((fd = mkstemp(path)) >= 0)
+        unlink(path);
+#endif
+
+    if (fd < 0) {
+        fprintf(stderr, "fifo: can't create mirror ring backing file: %s\n", strerror(errno));
+        return -1;
+    }
+
+    if (ftruncate(fd, bytes) < 0) {
+        fprintf(stderr, "fifo: can't size mirror ring backing file: %s\n", strerror(errno));
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+// Map a ring of at least "samples" samples twice, contiguously.
+static bool mirror_create(struct fifo_source *fs, uint64_t samples)
+{
+    long pagesize = sysconf(_SC_PAGESIZE);
+    if (pagesize <= 0)
+        pagesize = 4096;
+
+    size_t bytes = samples * fs->sample_size;
+    bytes = (bytes + pagesize - 1) / pagesize * pagesize;
+
+    int fd = mirror_create_fd(bytes);
+    if (fd < 0)
+        return false;
+
+    // Reserve address space for both mappings, then map the file over each half
+    uint8_t *base = mmap(NULL, bytes * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        fprintf(stderr, "fifo: can't reserve mirror ring address space: %s\n", strerror(errno));
+        close(fd);
+        return false;
+    }
+
+    if (mmap(base, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+        mmap(base + bytes, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        fprintf(stderr, "fifo: can't map mirror ring: %s\n", strerror(errno));
+        munmap(base, bytes * 2);
+        close(fd);
+        return false;
+    }
+
+    close(fd); // the mappings keep the memory alive
+
+    fs->mirror_base = base;
+    fs->mirror_bytes = bytes;
+    fs->mirror_samples = bytes / fs->sample_size;
+    // Start one lap in so that "position - overlap" never underflows;
+    // the initial overlap region is zero (fresh memory)
+    fs->mirror_wpos = fs->mirror_samples;
+    return true;
+}
+
+static void mirror_destroy(struct fifo_source *fs)
+{
+    if (!fs->mirror_base)
+        return;
+    munmap(fs->mirror_base, fs->mirror_bytes * 2);
+    fs->mirror_base = NULL;
+    fs->mirror_bytes = 0;
+    fs->mirror_samples = 0;
+}
+
+void fifo_set_impl(fifo_impl_t impl)
+{
+    fifo_impl = impl;
+}
+
+fifo_impl_t fifo_get_impl()
+{
+    return fifo_impl;
+}
+
+const char *fifo_impl_name(fifo_impl_t impl)
+{
+    switch (impl) {
+    case FIFO_IMPL_LOCKFREE: return "lockfree";
+    case FIFO_IMPL_MUTEX: return "mutex";
+    default: return "unknown";
+    }
+}
+
+const char *fifo_drop_cause_name(mag_buf_drop_cause cause)
+{
+    switch (cause) {
+    case MAGBUF_DROP_FIFO_FULL: return "fifo_full";
+    case MAGBUF_DROP_OVERSIZE: return "oversize";
+    case MAGBUF_DROP_DEVICE: return "device";
+    default: return "unknown";
+    }
+}
 
-// Create the queue structures. Not threadsafe.
 bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap)
 {
-    if (!(overlap_buffer = calloc(overlap, sizeof(overlap_buffer[0]))))
+    return fifo_create_source(0, buffer_count, buffer_size, overlap);
+}
+
+static void fifo_destroy_source(struct fifo_source *fs);
+
+bool fifo_create_source(unsigned source, unsigned buffer_count, unsigned buffer_size, unsigned overlap)
+{
+    if (source >= MAGBUF_MAX_SOURCES)
+        return false;
+
+    struct fifo_source *fs = &fifo_sources[source];
+    atomic_store(&fs->halted, false);
+
+    pthread_mutex_init(&fs->mutex, NULL);
+    pthread_cond_init(&fs->notempty_cond, NULL);
+    pthread_cond_init(&fs->empty_cond, NULL);
+    pthread_cond_init(&fs->free_cond, NULL);
+
+    if (source >= fifo_source_count) {
+        if (fifo_source_count == 0)
+            event_init(&fifo_any_enqueued);
+        fifo_source_count = source + 1;
+    }
+
+    fs->sample_size = fifo_sample_size;
+    if (!(fs->overlap_buffer = calloc(overlap, fs->sample_size)))
+        goto nomem;
+
+    fs->overlap_length = overlap;
+
+    if (!(fs->buffers = calloc(buffer_count, sizeof(fs->buffers[0]))))
         goto nomem;
 
-    overlap_length = overlap;
+    if (fifo_mirror_requested) {
+        // Each buffer in flight can use up to buffer_size + overlap samples
+        // (including the discontinuity slack); the overlap before the oldest
+        // buffer must also be preserved.
+        if (!mirror_create(fs, (uint64_t) buffer_count * (buffer_size + overlap) + overlap))
+            fprintf(stderr, "fifo: mirror-mapped ring not available, falling back to copying the overlap\n");
+    }
+
+    if (fifo_impl == FIFO_IMPL_LOCKFREE) {
+        if (!ring_init(&fs->free_ring, buffer_count) || !ring_init(&fs->queue_ring, buffer_count))
+            goto nomem;
+        event_init(&fs->queue_emptied);
+    }
 
     for (unsigned i = 0; i < buffer_count; ++i) {
         struct mag_buf *newbuf;
@@ -53,94 +505,191 @@ bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap)
             goto nomem;
         }
 
-        if (!(newbuf->data = calloc(buffer_size, sizeof(newbuf->data[0])))) {
+        if (!fs->mirror_base && !(newbuf->data = calloc(buffer_size, fs->sample_size))) {
             free(newbuf);
             goto nomem;
         }
 
         newbuf->totalLength = buffer_size;
-        newbuf->next = fifo_freelist;
-        fifo_freelist = newbuf;
+        newbuf->source = source;
+        fs->buffers[fs->buffer_count++] = newbuf;
+
+        if (fifo_impl == FIFO_IMPL_LOCKFREE) {
+            ring_push(&fs->free_ring, newbuf);
+        } else {
+            newbuf->next = fs->freelist;
+            fs->freelist = newbuf;
+        }
     }
 
     return true;
 
  nomem:
-    fifo_destroy();
+    fifo_destroy_source(fs);
     return false;
 }
 
-static void free_buffer_list(struct mag_buf *head)
+static void fifo_destroy_source(struct fifo_source *fs)
 {
-    while (head) {
-        struct mag_buf *next = head->next;
-        free(head->data);
-        free(head);
-        head = next;
+    if (fs->buffers) {
+        for (unsigned i = 0; i < fs->buffer_count; ++i) {
+            if (!fs->mirror_base)
+                free(fs->buffers[i]->data);
+            free(fs->buffers[i]);
+        }
+        free(fs->buffers);
+        fs->buffers = NULL;
+        fs->buffer_count = 0;
     }
+
+    fs->head = fs->tail = fs->freelist = NULL;
+
+    if (fs->free_ring.slots || fs->queue_ring.slots) {
+        ring_destroy(&fs->free_ring);
+        ring_destroy(&fs->queue_ring);
+        event_destroy(&fs->queue_emptied);
+    }
+
+    mirror_destroy(fs);
+
+    free(fs->overlap_buffer);
+    fs->overlap_buffer = NULL;
 }
 
 void fifo_destroy()
 {
-    free_buffer_list(fifo_head);
-    fifo_head = fifo_tail = NULL;
-
-    free_buffer_list(fifo_freelist);
-    fifo_freelist = NULL;
+    for (unsigned source = 0; source < fifo_source_count; ++source)
+        fifo_destroy_source(&fifo_sources[source]);
 
-    free(overlap_buffer);
-    overlap_buffer = NULL;
+    if (fifo_source_count)
+        event_destroy(&fifo_any_enqueued);
+    fifo_source_count = 0;
+    fifo_next_dequeue = 0;
 }
 
 void fifo_drain()
 {
-    pthread_mutex_lock(&fifo_mutex);
-    while (fifo_head && !fifo_halted) {
-        pthread_cond_wait(&fifo_empty_cond, &fifo_mutex);
+    fifo_drain_source(0);
+}
+
+void fifo_drain_source(unsigned source)
+{
+    struct fifo_source *fs = &fifo_sources[source];
+
+    if (fifo_impl == FIFO_IMPL_LOCKFREE) {
+        for (;;) {
+            if (atomic_load(&fs->halted) || ring_empty(&fs->queue_ring))
+                return;
+
+            unsigned seen = event_begin_wait(&fs->queue_emptied);
+            if (!atomic_load(&fs->halted) && !ring_empty(&fs->queue_ring))
+                event_wait(&fs->queue_emptied, seen, NULL, "fifo_drain");
+            event_end_wait(&fs->queue_emptied);
+        }
+    }
+
+    pthread_mutex_lock(&fs->mutex);
+    while (fs->head && !fs->halted) {
+        pthread_cond_wait(&fs->empty_cond, &fs->mutex);
     }
-    pthread_mutex_unlock(&fifo_mutex);
+    pthread_mutex_unlock(&fs->mutex);
 }
 
 void fifo_halt()
 {
-    pthread_mutex_lock(&fifo_mutex);
+    for (unsigned source = 0; source < fifo_source_count; ++source)
+        fifo_halt_source(source);
+}
+
+void fifo_halt_source(unsigned source)
+{
+    struct fifo_source *fs = &fifo_sources[source];
+
+    if (fifo_impl == FIFO_IMPL_LOCKFREE) {
+        // Buffers still in the queue ring are left there; fifo_dequeue
+        // will not return them once halted, and fifo_destroy frees
+        // everything regardless of which ring it is on.
+        atomic_store(&fs->halted, true);
+
+        // wake all waiters
+        event_signal(&fs->queue_ring.pushed);
+        event_signal(&fs->free_ring.pushed);
+        event_signal(&fs->queue_emptied);
+        event_signal(&fifo_any_enqueued);
+        return;
+    }
+
+    pthread_mutex_lock(&fs->mutex);
 
     // Drain all enqueued buffers to the freelist
-    while (fifo_head) {
-        struct mag_buf *freebuf = fifo_head;
-        fifo_head = freebuf->next;
+    while (fs->head) {
+        struct mag_buf *freebuf = fs->head;
+        fs->head = freebuf->next;
 
-        freebuf->next = fifo_freelist;
-        fifo_freelist = freebuf;
+        freebuf->next = fs->freelist;
+        fs->freelist = freebuf;
     }
 
-    fifo_tail = NULL;
-    fifo_halted = true;
+    fs->tail = NULL;
+    fs->halted = true;
 
     // wake all waiters
-    pthread_cond_broadcast(&fifo_notempty_cond);
-    pthread_cond_broadcast(&fifo_empty_cond);
-    pthread_cond_broadcast(&fifo_free_cond);
-    pthread_mutex_unlock(&fifo_mutex);
+    pthread_cond_broadcast(&fs->notempty_cond);
+    pthread_cond_broadcast(&fs->empty_cond);
+    pthread_cond_broadcast(&fs->free_cond);
+    pthread_mutex_unlock(&fs->mutex);
+
+    event_signal(&fifo_any_enqueued);
+}
+
+static void prepare_acquired_buffer(struct fifo_source *fs, struct mag_buf *buf)
+{
+    if (fs->mirror_base) {
+        // The overlap is the tail of whatever was written before this buffer
+        buf->data = (uint16_t *) (fs->mirror_base + (fs->mirror_wpos - fs->overlap_length) % fs->mirror_samples * fs->sample_size);
+    }
+
+    buf->overlap = fs->overlap_length;
+    buf->validLength = buf->overlap;
+    buf->sampleTimestamp = 0;
+    buf->sysTimestamp = 0;
+    buf->flags = 0;
+    buf->dropped = 0;
+    memset(buf->dropped_by_cause, 0, sizeof(buf->dropped_by_cause));
+    buf->next = NULL;
 }
 
 struct mag_buf *fifo_acquire(uint32_t timeout_ms)
 {
+    return fifo_acquire_source(0, timeout_ms);
+}
+
+struct mag_buf *fifo_acquire_source(unsigned source, uint32_t timeout_ms)
+{
+    struct fifo_source *fs = &fifo_sources[source];
+
+    if (fifo_impl == FIFO_IMPL_LOCKFREE) {
+        struct mag_buf *result = ring_pop_wait(fs, &fs->free_ring, timeout_ms, "fifo_acquire");
+        if (result)
+            prepare_acquired_buffer(fs, result);
+        return result;
+    }
+
     struct timespec deadline;
     if (timeout_ms)
         get_deadline(timeout_ms, &deadline);
 
-    pthread_mutex_lock(&fifo_mutex);
+    pthread_mutex_lock(&fs->mutex);
 
     struct mag_buf *result = NULL;
-    while (!fifo_halted && !fifo_freelist) {
+    while (!fs->halted && !fs->freelist) {
         if (!timeout_ms) {
             // Non-blocking
             goto done;
         }
 
         // No free buffers, wait for one
-        int err = pthread_cond_timedwait(&fifo_free_cond, &fifo_mutex, &deadline);
+        int err = pthread_cond_timedwait(&fs->free_cond, &fs->mutex, &deadline);
         if (err) {
             if (err != ETIMEDOUT) {
                 fprintf(stderr, "fifo_acquire: pthread_cond_timedwait unexpectedly returned %s\n", strerror(err));
@@ -150,79 +699,135 @@ struct mag_buf *fifo_acquire(uint32_t timeout_ms)
         }
     }
 
-    if (!fifo_halted) {
-        result = fifo_freelist;
-        fifo_freelist = result->next;
-
-        result->overlap = overlap_length;
-        result->validLength = result->overlap;
-        result->sampleTimestamp = 0;
-        result->sysTimestamp = 0;
-        result->flags = 0;
-        result->next = NULL;
+    if (!fs->halted) {
+        result = fs->freelist;
+        fs->freelist = result->next;
+        prepare_acquired_buffer(fs, result);
     }
 
  done:
-    pthread_mutex_unlock(&fifo_mutex);
+    pthread_mutex_unlock(&fs->mutex);
     return result;
 }
 
-void fifo_enqueue(struct mag_buf *buf)
+// Populate the overlap region of a buffer about to be enqueued,
+// and save its tail for the next buffer. Only touched by the producer.
+static void fill_overlap(struct fifo_source *fs, struct mag_buf *buf)
 {
-    assert(buf->validLength <= buf->totalLength);
-    assert(buf->validLength >= overlap_length);
-
-    pthread_mutex_lock(&fifo_mutex);
+    unsigned overlap_length = fs->overlap_length;
+    size_t size = fs->sample_size;
+    uint8_t *data = (uint8_t *) buf->data;
+
+    if (fs->mirror_base) {
+        if (buf->flags & MAGBUF_DISCONTINUOUS) {
+            // The overlap region belongs to the previous buffer, which may still be in use.
+            // Move the new data up into this buffer's slack instead, and zero the gap.
+            uint8_t *newdata = data + overlap_length * size;
+            memmove(newdata + overlap_length * size, newdata, (buf->validLength - overlap_length) * size);
+            memset(newdata, 0, overlap_length * size);
+            buf->data = (uint16_t *) newdata;
+            fs->mirror_wpos += overlap_length;
+        }
 
-    if (fifo_halted) {
-        // Shutting down, just return the buffer to the freelist.
-        buf->next = fifo_freelist;
-        fifo_freelist = buf;
-        goto done;
+        fs->mirror_wpos += buf->validLength - overlap_length;
+        return;
     }
 
-    // Populate the overlap region
     if (buf->flags & MAGBUF_DISCONTINUOUS) {
         // This buffer is discontinuous to the previous, so the overlap region is not valid; zero it out
-        memset(buf->data, 0, overlap_length * sizeof(buf->data[0]));
+        memset(data, 0, overlap_length * size);
     } else {
-        memcpy(buf->data, overlap_buffer, overlap_length * sizeof(buf->data[0]));
+        memcpy(data, fs->overlap_buffer, overlap_length * size);
     }
 
     // Save the tail of the buffer for next time
-    memcpy(overlap_buffer, &buf->data[buf->validLength - overlap_length], overlap_length * sizeof(overlap_buffer[0]));
+    memcpy(fs->overlap_buffer, data + (buf->validLength - overlap_length) * size, overlap_length * size);
+}
+
+void fifo_add_dropped(struct mag_buf *buf, unsigned pending[MAGBUF_DROP_CAUSES])
+{
+    for (int cause = 0; cause < MAGBUF_DROP_CAUSES; ++cause) {
+        if (pending[cause]) {
+            buf->flags |= MAGBUF_DISCONTINUOUS;
+            buf->dropped += pending[cause];
+            buf->dropped_by_cause[cause] += pending[cause];
+            pending[cause] = 0;
+        }
+    }
+}
+
+void fifo_enqueue(struct mag_buf *buf)
+{
+    struct fifo_source *fs = &fifo_sources[buf->source];
+
+    assert(buf->validLength <= buf->totalLength);
+    assert(buf->validLength >= fs->overlap_length);
+
+    if (fifo_impl == FIFO_IMPL_LOCKFREE) {
+        if (atomic_load(&fs->halted)) {
+            // Shutting down, just drop the buffer; fifo_destroy will free it.
+            return;
+        }
+
+        fill_overlap(fs, buf);
+        ring_push(&fs->queue_ring, buf);
+        if (fifo_source_count > 1)
+            event_signal(&fifo_any_enqueued);
+        return;
+    }
+
+    pthread_mutex_lock(&fs->mutex);
+
+    if (fs->halted) {
+        // Shutting down, just return the buffer to the freelist.
+        buf->next = fs->freelist;
+        fs->freelist = buf;
+        goto done;
+    }
+
+    fill_overlap(fs, buf);
 
     // enqueue and tell the main thread
     buf->next = NULL;
-    if (!fifo_head) {
-        fifo_head = fifo_tail = buf;
-        pthread_cond_signal(&fifo_notempty_cond);
+    if (!fs->head) {
+        fs->head = fs->tail = buf;
+        pthread_cond_signal(&fs->notempty_cond);
     } else {
-        fifo_tail->next = buf;
-        fifo_tail = buf;
+        fs->tail->next = buf;
+        fs->tail = buf;
     }
 
  done:
-    pthread_mutex_unlock(&fifo_mutex);
+    pthread_mutex_unlock(&fs->mutex);
+    if (fifo_source_count > 1)
+        event_signal(&fifo_any_enqueued);
 }
 
-struct mag_buf *fifo_dequeue(uint32_t timeout_ms)
+// Get a buffer from the tail of one source's FIFO, waiting up to timeout_ms
+static struct mag_buf *fifo_dequeue_source(struct fifo_source *fs, uint32_t timeout_ms)
 {
+    if (fifo_impl == FIFO_IMPL_LOCKFREE) {
+        struct mag_buf *result = ring_pop_wait(fs, &fs->queue_ring, timeout_ms, "fifo_dequeue");
+        if (result && ring_empty(&fs->queue_ring))
+            event_signal(&fs->queue_emptied);
+        return result;
+    }
+
     struct timespec deadline;
     if (timeout_ms)
         get_deadline(timeout_ms, &deadline);
 
-    pthread_mutex_lock(&fifo_mutex);
+    pthread_mutex_lock(&fs->mutex);
 
     struct mag_buf *result = NULL;
-    while (!fifo_head && !fifo_halted) {
+    while (!fs->head && !fs->halted) {
         if (!timeout_ms) {
             // Non-blocking
             goto done;
         }
 
         // No data pending, wait for some
-        int err = pthread_cond_timedwait(&fifo_notempty_cond, &fifo_mutex, &deadline);
+        int err = pthread_cond_timedwait(&fs->notempty_cond, &fs->mutex, &deadline);
         if (err) {
             if (err != ETIMEDOUT) {
                 fprintf(stderr, "fifo_dequeue: pthread_cond_timedwait unexpectedly returned %s\n", strerror(err));
@@ -232,27 +837,113 @@ struct mag_buf *fifo_dequeue(uint32_t timeout_ms)
         }
     }
 
-    if (!fifo_halted) {
-        result = fifo_head;
-        fifo_head = result->next;
+    if (!fs->halted) {
+        result = fs->head;
+        fs->head = result->next;
         result->next = NULL;
-        if (!fifo_head) {
-            fifo_tail = NULL;
-            pthread_cond_broadcast(&fifo_empty_cond);
+        if (!fs->head) {
+            fs->tail = NULL;
+            pthread_cond_broadcast(&fs->empty_cond);
         }
     }
 
  done:
-    pthread_mutex_unlock(&fifo_mutex);
+    pthread_mutex_unlock(&fs->mutex);
     return result;
 }
 
+// Try each source once without waiting, starting after the one that
+// was dequeued from last, so that one busy source can't starve the others.
+// Sets *all_halted if every source is halted.
+static struct mag_buf *fifo_dequeue_any(bool *all_halted)
+{
+    *all_halted = true;
+    for (unsigned i = 0; i < fifo_source_count; ++i) {
+        unsigned source = (fifo_next_dequeue + i) % fifo_source_count;
+        struct fifo_source *fs = &fifo_sources[source];
+        if (!fs->buffers || atomic_load(&fs->halted))
+            continue;
+
+        *all_halted = false;
+        struct mag_buf *result = fifo_dequeue_source(fs, 0);
+        if (result) {
+            fifo_next_dequeue = (source + 1) % fifo_source_count;
+            return result;
+        }
+    }
+
+    return NULL;
+}
+
+struct mag_buf *fifo_dequeue(uint32_t timeout_ms)
+{
+    if (fifo_source_count <= 1)
+        return fifo_dequeue_source(&fifo_sources[0], timeout_ms);
+
+    struct timespec deadline;
+    if (timeout_ms)
+        get_deadline(timeout_ms, &deadline);
+
+    for (;;) {
+        bool all_halted;
+        struct mag_buf *result = fifo_dequeue_any(&all_halted);
+        if (result || all_halted || !timeout_ms)
+            return result;
+
+        unsigned seen = event_begin_wait(&fifo_any_enqueued);
+        bool waited = true;
+        if (!(result = fifo_dequeue_any(&all_halted)) && !all_halted)
+            waited = event_wait(&fifo_any_enqueued, seen, &deadline, "fifo_dequeue");
+        event_end_wait(&fifo_any_enqueued);
+
+        if (result || !waited)
+            return result; // got one, or timed out
+    }
+}
+
 void fifo_release(struct mag_buf *buf)
 {
-    pthread_mutex_lock(&fifo_mutex);
-    if (!fifo_freelist)
-        pthread_cond_signal(&fifo_free_cond);
-    buf->next = fifo_freelist;
-    fifo_freelist = buf;
-    pthread_mutex_unlock(&fifo_mutex);
+    struct fifo_source *fs = &fifo_sources[buf->source];
+
+    if (fifo_impl == FIFO_IMPL_LOCKFREE) {
+        ring_push(&fs->free_ring, buf);
+        return;
+    }
+
+    pthread_mutex_lock(&fs->mutex);
+    if (!fs->freelist)
+        pthread_cond_signal(&fs->free_cond);
+    buf->next = fs->freelist;
+    fs->freelist = buf;
+    pthread_mutex_unlock(&fs->mutex);
+}
+
+unsigned fifo_queued()
+{
+    unsigned count = 0;
+
+    for (unsigned source = 0; source < fifo_source_count; ++source) {
+        struct fifo_source *fs = &fifo_sources[source];
+
+        if (fifo_impl == FIFO_IMPL_LOCKFREE) {
+            if (fs->queue_ring.slots)
+                count += atomic_load_explicit(&fs->queue_ring.tail, memory_order_acquire) - atomic_load_explicit(&fs->queue_ring.head, memory_order_acquire);
+            continue;
+        }
+
+        pthread_mutex_lock(&fs->mutex);
+        for (struct mag_buf *buf = fs->head; buf; buf = buf->next)
+            ++count;
+        pthread_mutex_unlock(&fs->mutex);
+    }
+
+    return count;
+}
+
+unsigned fifo_capacity()
+{
+    unsigned count = 0;
+    for (unsigned source = 0; source < fifo_source_count; ++source)
+        count += fifo_sources[source].buffer_count;
+    return count;
 }
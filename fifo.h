@@ -26,8 +26,20 @@
 // Values for mag_buf.flags
 typedef enum {
     MAGBUF_DISCONTINUOUS = 1, // this buffer is discontinuous to the previous buffer
+    MAGBUF_GAIN_CHANGED = 2,  // this is the first buffer captured after a requested gain change completed
 } mag_buf_flags;
 
+// Maximum number of sample sources that can each have a FIFO
+#define MAGBUF_MAX_SOURCES 4
+
+// Reasons why samples may be lost before reaching a mag_buf
+typedef enum {
+    MAGBUF_DROP_FIFO_FULL = 0,  // no free buffer was available when the SDR delivered data
+    MAGBUF_DROP_OVERSIZE,       // the SDR delivered more data than fits in one buffer
+    MAGBUF_DROP_DEVICE,         // the SDR itself reported lost data (overrun, timestamp gap)
+    MAGBUF_DROP_CAUSES          // number of causes, not a cause itself
+} mag_buf_drop_cause;
+
 // Structure representing one magnitude buffer
 // The contained data looks like this:
 //
@@ -52,7 +64,10 @@ typedef enum {
 // be copied into the starting overlap of the next buffer and decoded on the next iteration.
 
 struct mag_buf {
-    uint16_t       *data;            // Magnitude data, starting with overlap from the previous block
+    union {
+        uint16_t   *data;            // Magnitude data, starting with overlap from the previous block
+        uint8_t    *data8;           // The same, if the FIFO holds 8-bit samples (fifo_set_sample_size)
+    };
     unsigned        totalLength;     // Maximum number of samples (allocated size of "data")
     unsigned        validLength;     // Number of valid samples in "data", including overlap samples
     unsigned        overlap;         // Number of leading overlap samples at the start of "data";
@@ -65,10 +80,52 @@ struct mag_buf {
     double          mean_level;      // Mean of normalized (0..1) signal level
     double          mean_power;      // Mean of normalized (0..1) power level
     unsigned        dropped;         // (approx) number of dropped samples, if flag MAGBUF_DISCONTINUOUS is set
+    unsigned        dropped_by_cause[MAGBUF_DROP_CAUSES]; // breakdown of "dropped" by cause
+    unsigned        source;          // index of the sample source (and FIFO) this buffer belongs to
 
     struct mag_buf *next;            // linked list forward link
 };
 
+// FIFO synchronization strategies
+typedef enum {
+    FIFO_IMPL_LOCKFREE = 0, // SPSC rings with futex wakeups (default)
+    FIFO_IMPL_MUTEX         // single mutex plus condition variables
+} fifo_impl_t;
+
+// Select the implementation used by the next call to fifo_create(). Not threadsafe;
+// call only while no FIFO exists.
+//
+// The lock-free implementation requires that fifo_acquire, fifo_enqueue and fifo_drain
+// are only ever called from one thread (the SDR thread), and that fifo_dequeue and
+// fifo_release are only ever called from one other thread (the demodulator thread).
+void fifo_set_impl(fifo_impl_t impl);
+fifo_impl_t fifo_get_impl();
+const char *fifo_impl_name(fifo_impl_t impl);
+
+// Returns a short name for a drop cause, suitable for stats keys.
+const char *fifo_drop_cause_name(mag_buf_drop_cause cause);
+
+// Request that the next call to fifo_create() allocates buffers from a
+// mirror-mapped sample ring, so that the overlap between adjacent buffers
+// does not need to be copied. Falls back to separate buffers if the ring
+// can't be mapped. Not threadsafe; call only while no FIFO exists.
+//
+// In this mode, buffers must be released in the order they were dequeued,
+// and mag_buf.data may change during fifo_enqueue().
+void fifo_set_mirror(bool enable);
+
+// Returns true if the current FIFO is using a mirror-mapped ring.
+bool fifo_is_mirrored();
+
+// Select the size of one magnitude sample, in bytes, for the next call to
+// fifo_create(): 2 (uint16_t, mag_buf.data; the default) or 1 (uint8_t,
+// mag_buf.data8). Not threadsafe; call only while no FIFO exists.
+void fifo_set_sample_size(unsigned bytes);
+unsigned fifo_get_sample_size();
+
+// Returns a pointer to sample 'n' of buf's data, whatever the sample size.
+void *mag_buf_sample(struct mag_buf *buf, unsigned n);
+
 // Create the queue structures. Not threadsafe. Returns true on success.
 //
 //   buffer_count - the number of buffers to preallocate
@@ -76,6 +133,17 @@ struct mag_buf {
 //   overlap      - the number of samples to overlap between adjacent buffers
 bool fifo_create(unsigned buffer_count, unsigned buffer_size, unsigned overlap);
 
+// Multiple sample sources: each source (0 .. MAGBUF_MAX_SOURCES-1) has its own
+// FIFO, with its own buffers and overlap state. fifo_create() creates the FIFO
+// for source 0; the functions that don't take a source act on source 0, except
+// that fifo_dequeue() takes buffers from every source in turn and fifo_halt()
+// halts every source. Each source has its own producer thread; there is still
+// only one consumer thread.
+bool fifo_create_source(unsigned source, unsigned buffer_count, unsigned buffer_size, unsigned overlap);
+struct mag_buf *fifo_acquire_source(unsigned source, uint32_t timeout_ms);
+void fifo_drain_source(unsigned source);
+void fifo_halt_source(unsigned source);
+
 // Destroy the fifo structures allocated in magbuf_fifo_create. Not threadsafe; ensure all FIFO users
 // are done before calling.
 void fifo_destroy();
@@ -83,7 +151,8 @@ void fifo_destroy();
 // Block until the FIFO is empty.
 void fifo_drain();
 
-// Mark the FIFO as halted. Move any buffers in FIFO to the freelist immediately.
+// Mark the FIFO as halted. Any buffers in the FIFO are discarded immediately
+// (moved to the freelist, or simply abandoned until fifo_destroy() for the lock-free FIFO).
 // Future calls to magbuf_acquire() will immediately return NULL.
 // Future calls to magbuf_produce() will immediately put the produced buffer on the freelist.
 // Future alls to magbuf_consume() will immediately return NULL; if there are
@@ -107,6 +176,11 @@ struct mag_buf *fifo_acquire(uint32_t timeout_ms);
 //   buf->dropped    (if flags & DISCONTINUOUS)
 void fifo_enqueue(struct mag_buf *buf);
 
+// Move a producer's pending per-cause counts of dropped samples onto a
+// newly acquired buffer, marking it discontinuous if anything was dropped,
+// and reset the pending counts.
+void fifo_add_dropped(struct mag_buf *buf, unsigned pending[MAGBUF_DROP_CAUSES]);
+
 // Get a buffer from the tail of the FIFO.
 // If the FIFO is halted (or becomes halted), return NULL immediately.
 // If the FIFO is empty, wait for up to "timeout_ms" milliseconds
@@ -116,4 +190,11 @@ struct mag_buf *fifo_dequeue(uint32_t timeout_ms);
 // Release a buffer previously returned by fifo_acquire() or fifo_pop() back to the freelist.
 void fifo_release(struct mag_buf *buf);
 
+// Return the number of filled buffers waiting to be dequeued, over all sources.
+// This is a snapshot and may be stale by the time it is used; intended for load monitoring.
+unsigned fifo_queued();
+
+// Return the number of buffers allocated by fifo_create() and fifo_create_source().
+unsigned fifo_capacity();
+
 #endif
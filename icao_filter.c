@@ -35,6 +35,9 @@ static uint32_t icao_filter_a[ICAO_FILTER_SIZE];
 static uint32_t icao_filter_b[ICAO_FILTER_SIZE];
 static uint32_t *icao_filter_active;
 
+// Bumped whenever the set of addresses that icaoFilterTest() matches changes
+static unsigned icao_filter_generation;
+
 #define EMPTY 0xFFFFFFFF
 
 static uint32_t icaoHash(uint32_t a)
@@ -79,8 +82,11 @@ void icaoFilterAdd(uint32_t addr)
             return;
         }
     }
-    if (icao_filter_active[h] == EMPTY)
+    if (icao_filter_active[h] == EMPTY) {
+        if (!icaoFilterTest(addr))
+            ++icao_filter_generation;
         icao_filter_active[h] = addr;
+    }
 }
 
 int icaoFilterTest(uint32_t addr)
@@ -108,6 +114,11 @@ int icaoFilterTest(uint32_t addr)
     return 0;
 }
 
+unsigned icaoFilterGeneration()
+{
+    return icao_filter_generation;
+}
+
 // call this periodically:
 void icaoFilterExpire()
 {
@@ -122,6 +133,7 @@ void icaoFilterExpire()
             memset(icao_filter_a, 0xFF, sizeof(icao_filter_a));
             icao_filter_active = icao_filter_a;
         }
+        ++icao_filter_generation;
         next_flip = now + MODES_ICAO_FILTER_TTL;
     }
 }
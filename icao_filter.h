@@ -37,6 +37,10 @@ int icaoFilterTest(uint32_t addr);
 // addresses. Returns 0 on failure.
 uint32_t icaoFilterTestFuzzy(uint32_t partial);
 
+// Return a counter that changes whenever the results of
+// icaoFilterTest() may have changed
+unsigned icaoFilterGeneration();
+
 // Call this periodically to allow the filter to expire
 // old entries.
 void icaoFilterExpire();
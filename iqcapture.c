@@ -0,0 +1,450 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// iqcapture.c: raw sample capture
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#define _GNU_SOURCE // for O_DIRECT
+
+#include "dump1090.h"
+#include "iqcapture.h"
+#include "iqz.h"
+
+//
+// Raw samples are captured to disk while decoding carries on, so that the
+// SDR doesn't need to be handed over to a separate capture program.
+//
+// The reader thread copies the samples into fixed-size, page-aligned blocks
+// from a preallocated pool, and a write-behind thread writes full blocks to
+// disk. The reader thread never waits for the disk: if no block is free, the
+// samples are dropped from the capture (decoding is not affected) and the
+// next block starts a new file, so that each file is contiguous.
+//
+// Captures are written as .iqz containers (see iqz.h), one compressed
+// chunk per block, recording the sample rate, gain and start time so that
+// --ifile can replay them directly. With --iq-capture-raw, the samples are
+// written as they are instead; as every write is then a whole aligned
+// block, the files can be written with O_DIRECT, keeping the captures out
+// of the page cache. Files are rotated once they reach --iq-capture-size,
+// keeping the most recent --iq-capture-files files of each source.
+//
+
+#define IQCAPTURE_BLOCK_SIZE (1024 * 1024) // bytes per block; a multiple of any O_DIRECT alignment
+#define IQCAPTURE_ALIGNMENT 4096           // block alignment in memory
+
+struct iqcapture_block {
+    unsigned source;
+    input_format_t format;
+    bool discontinuous;         // samples were dropped (or not captured) before this block
+    uint64_t sys_timestamp;     // wall clock time when the block was started, ms
+    size_t used;                // bytes of data in the block
+    unsigned char *data;        // IQCAPTURE_BLOCK_SIZE bytes
+};
+
+// Per-source state of the reader thread; only touched by that thread,
+// until it has stopped
+struct iqcapture_tap_state {
+    struct iqcapture_block *filling;    // block being filled, if any
+    bool gap;                           // the next block is discontinuous
+    bool dropping;                      // samples are being dropped for lack of a free block
+};
+
+// Per-source state of the writer thread
+struct iqcapture_file {
+    int fd;
+    bool direct;                // fd was opened with O_DIRECT
+    struct iqz_writer *container; // non-NULL unless --iq-capture-raw
+    uint64_t written;           // bytes written to the current file
+    unsigned sequence;          // number of files started
+    char **names;               // ring of the last Modes.iqcapture_files file names
+};
+
+static struct {
+    bool running;                       // writer thread started
+    atomic_int capturing;               // 1 if the tap accepts samples
+    int reported_capturing;             // capturing state last reported by iqcapture_update_stats
+
+    pthread_t thread;
+    pthread_mutex_t mutex;              // protects everything down to 'stop'
+    pthread_cond_t cond;                // signalled when a block is queued, or on stop
+    struct iqcapture_block **free_blocks;
+    unsigned free_count;
+    struct iqcapture_block **queue;     // ring of full blocks waiting to be written
+    unsigned queue_head;
+    unsigned queue_length;
+    bool stop;
+
+    unsigned block_count;
+    struct iqcapture_block *blocks;
+    unsigned char *block_memory;
+
+    struct iqcapture_tap_state taps[MAGBUF_MAX_SOURCES];
+    struct iqcapture_file files[MAGBUF_MAX_SOURCES];
+
+    // counters, collected by iqcapture_update_stats
+    atomic_uint_fast64_t bytes_written;
+    atomic_uint_fast64_t bytes_dropped;
+    atomic_uint overruns;
+    atomic_uint files_started;
+} iqcapture;
+
+static const char *format_extension(input_format_t format)
+{
+    switch (format) {
+    case INPUT_UC8: return "uc8";
+    case INPUT_SC16: return "sc16";
+    case INPUT_SC16Q11: return "sc16q11";
+    default: return "raw";
+    }
+}
+
+static void iqcapture_close_file(struct iqcapture_file *file)
+{
+    if (file->container) {
+        if (!iqz_writer_close(file->container))
+            fprintf(stderr, "iq-capture: failed to write container index: %s\n", strerror(errno));
+        file->container = NULL;
+    }
+
+    if (file->fd >= 0) {
+        close(file->fd);
+        file->fd = -1;
+    }
+}
+
+// Start a new capture file for the given block, deleting the oldest file if needed
+static bool iqcapture_open_file(struct iqcapture_file *file, const struct iqcapture_block *block)
+{
+    iqcapture_close_file(file);
+
+    char timestamp[32];
+    struct tm tm;
+    time_t now = time(NULL);
+    gmtime_r(&now, &tm);
+    strftime(timestamp, sizeof(timestamp), "%Y%m%d-%H%M%S", &tm);
+
+    char path[PATH_MAX];
+    snprintf(path, sizeof(path), "%s/iq-%u-%s-%06u.%s",
+             Modes.iqcapture_dir, block->source, timestamp, file->sequence,
+             Modes.iqcapture_raw ? format_extension(block->format) : "iqz");
+
+    // containers interleave chunk headers with the samples, so their
+    // writes aren't block-aligned
+    file->direct = Modes.iqcapture_raw;
+    file->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | (file->direct ? O_DIRECT : 0), 0644);
+    if (file->fd < 0 && file->direct && errno == EINVAL) {
+        // filesystem doesn't support O_DIRECT (e.g. tmpfs)
+        file->direct = false;
+        file->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+    if (file->fd < 0) {
+        fprintf(stderr, "iq-capture: can't create %s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    if (!Modes.iqcapture_raw) {
+        // the gain is only known for the primary SDR
+        int gain = (block->source == 0 ? sdrGetGain() : -1);
+        struct iqz_info info = {
+            .format = block->format,
+            .sample_rate = Modes.capture_rate,
+            .gain_db = (gain >= 0 ? sdrGetGainDb(gain) : NAN),
+            .start_time_ms = block->sys_timestamp
+        };
+        unsigned chunk_samples = IQCAPTURE_BLOCK_SIZE / iqz_bytes_per_sample(block->format);
+        if (!(file->container = iqz_writer_open(file->fd, &info, chunk_samples, true))) {
+            fprintf(stderr, "iq-capture: can't write to %s: %s\n", path, strerror(errno));
+            close(file->fd);
+            file->fd = -1;
+            unlink(path);
+            return false;
+        }
+    }
+
+    file->written = 0;
+    atomic_fetch_add(&iqcapture.files_started, 1);
+
+    if (file->names) {
+        unsigned slot = file->sequence % Modes.iqcapture_files;
+        if (file->names[slot]) {
+            unlink(file->names[slot]);
+            free(file->names[slot]);
+        }
+        file->names[slot] = strdup(path);
+    }
+    ++file->sequence;
+
+    return true;
+}
+
+static void iqcapture_write_block(struct iqcapture_block *block)
+{
+    struct iqcapture_file *file = &iqcapture.files[block->source];
+    uint64_t file_size = (uint64_t) Modes.iqcapture_file_mb * 1024 * 1024;
+
+    if (file->fd < 0 || block->discontinuous || file->written + block->used > file_size) {
+        if (!iqcapture_open_file(file, block)) {
+            atomic_fetch_add(&iqcapture.bytes_dropped, block->used);
+            return;
+        }
+    }
+
+    if (file->container) {
+        uint64_t before = iqz_writer_size(file->container);
+        if (!iqz_write_chunk(file->container, block->data, block->used / iqz_bytes_per_sample(block->format))) {
+            fprintf(stderr, "iq-capture: write failed: %s\n", strerror(errno));
+            iqcapture_close_file(file);
+            atomic_fetch_add(&iqcapture.bytes_dropped, block->used);
+            return;
+        }
+        uint64_t after = iqz_writer_size(file->container);
+        file->written += after - before;
+        atomic_fetch_add(&iqcapture.bytes_written, after - before);
+        return;
+    }
+
+    // Only whole blocks can be written with O_DIRECT; the last, partial
+    // block of a capture is written through the page cache
+    if (file->direct && block->used % IQCAPTURE_BLOCK_SIZE) {
+        fcntl(file->fd, F_SETFL, fcntl(file->fd, F_GETFL) & ~O_DIRECT);
+        file->direct = false;
+    }
+
+    size_t done = 0;
+    while (done < block->used) {
+        ssize_t n = write(file->fd, block->data + done, block->used - done);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0) {
+            fprintf(stderr, "iq-capture: write failed: %s\n", n < 0 ? strerror(errno) : "short write");
+            iqcapture_close_file(file);
+            atomic_fetch_add(&iqcapture.bytes_dropped, block->used - done);
+            break;
+        }
+        done += n;
+    }
+
+    file->written += done;
+    atomic_fetch_add(&iqcapture.bytes_written, done);
+}
+
+static void *iqcapture_thread_entry(void *arg)
+{
+    MODES_NOTUSED(arg);
+    set_thread_name("dump1090-iqcap");
+
+    pthread_mutex_lock(&iqcapture.mutex);
+    for (;;) {
+        while (!iqcapture.stop && !iqcapture.queue_length)
+            pthread_cond_wait(&iqcapture.cond, &iqcapture.mutex);
+        if (!iqcapture.queue_length)
+            break; // stopping, and everything is written
+
+        struct iqcapture_block *block = iqcapture.queue[iqcapture.queue_head];
+        iqcapture.queue_head = (iqcapture.queue_head + 1) % iqcapture.block_count;
+        --iqcapture.queue_length;
+        pthread_mutex_unlock(&iqcapture.mutex);
+
+        iqcapture_write_block(block);
+
+        pthread_mutex_lock(&iqcapture.mutex);
+        iqcapture.free_blocks[iqcapture.free_count++] = block;
+    }
+    pthread_mutex_unlock(&iqcapture.mutex);
+
+    for (unsigned source = 0; source < MAGBUF_MAX_SOURCES; ++source)
+        iqcapture_close_file(&iqcapture.files[source]);
+
+    return NULL;
+}
+
+bool iqcapture_init()
+{
+    if (access(Modes.iqcapture_dir, W_OK) < 0) {
+        fprintf(stderr, "iq-capture: can't write to %s: %s\n", Modes.iqcapture_dir, strerror(errno));
+        return false;
+    }
+
+    if (Modes.iqcapture_file_mb < 1)
+        Modes.iqcapture_file_mb = 1;
+    iqcapture.block_count = Modes.iqcapture_buffer_mb * 1024 * 1024 / IQCAPTURE_BLOCK_SIZE;
+    if (iqcapture.block_count < 2)
+        iqcapture.block_count = 2;
+
+    iqcapture.block_memory = aligned_alloc(IQCAPTURE_ALIGNMENT, (size_t) iqcapture.block_count * IQCAPTURE_BLOCK_SIZE);
+    iqcapture.blocks = calloc(iqcapture.block_count, sizeof(*iqcapture.blocks));
+    iqcapture.free_blocks = calloc(iqcapture.block_count, sizeof(*iqcapture.free_blocks));
+    iqcapture.queue = calloc(iqcapture.block_count, sizeof(*iqcapture.queue));
+    if (!iqcapture.block_memory || !iqcapture.blocks || !iqcapture.free_blocks || !iqcapture.queue) {
+        fprintf(stderr, "iq-capture: out of memory allocating %u MB of capture buffers\n", Modes.iqcapture_buffer_mb);
+        return false;
+    }
+
+    for (unsigned i = 0; i < iqcapture.block_count; ++i) {
+        iqcapture.blocks[i].data = iqcapture.block_memory + (size_t) i * IQCAPTURE_BLOCK_SIZE;
+        iqcapture.free_blocks[i] = &iqcapture.blocks[i];
+    }
+    iqcapture.free_count = iqcapture.block_count;
+    iqcapture.queue_head = iqcapture.queue_length = 0;
+    iqcapture.stop = false;
+
+    for (unsigned source = 0; source < MAGBUF_MAX_SOURCES; ++source) {
+        iqcapture.taps[source].filling = NULL;
+        iqcapture.taps[source].gap = true;
+        iqcapture.taps[source].dropping = false;
+        iqcapture.files[source].fd = -1;
+        iqcapture.files[source].container = NULL;
+        iqcapture.files[source].sequence = 0;
+        iqcapture.files[source].names = (Modes.iqcapture_files ? calloc(Modes.iqcapture_files, sizeof(char *)) : NULL);
+    }
+
+    pthread_mutex_init(&iqcapture.mutex, NULL);
+    pthread_cond_init(&iqcapture.cond, NULL);
+    if (pthread_create(&iqcapture.thread, NULL, iqcapture_thread_entry, NULL) != 0) {
+        fprintf(stderr, "iq-capture: can't start writer thread\n");
+        return false;
+    }
+    iqcapture.running = true;
+
+    atomic_store(&iqcapture.capturing, Modes.iqcapture_on_demand ? 0 : 1);
+    iqcapture.reported_capturing = 0;
+    return true;
+}
+
+static void iqcapture_queue_block(struct iqcapture_block *block)
+{
+    pthread_mutex_lock(&iqcapture.mutex);
+    iqcapture.queue[(iqcapture.queue_head + iqcapture.queue_length) % iqcapture.block_count] = block;
+    ++iqcapture.queue_length;
+    pthread_cond_signal(&iqcapture.cond);
+    pthread_mutex_unlock(&iqcapture.mutex);
+}
+
+void iqcapture_tap(unsigned source, input_format_t format, const void *data, size_t bytes)
+{
+    if (!iqcapture.running)
+        return;
+
+    struct iqcapture_tap_state *tap = &iqcapture.taps[source];
+    if (!atomic_load_explicit(&iqcapture.capturing, memory_order_relaxed)) {
+        // not capturing; finish off any capture in progress
+        if (tap->filling) {
+            iqcapture_queue_block(tap->filling);
+            tap->filling = NULL;
+        }
+        tap->gap = true;
+        return;
+    }
+
+    const unsigned char *p = data;
+    while (bytes > 0) {
+        if (!tap->filling) {
+            pthread_mutex_lock(&iqcapture.mutex);
+            if (iqcapture.free_count)
+                tap->filling = iqcapture.free_blocks[--iqcapture.free_count];
+            pthread_mutex_unlock(&iqcapture.mutex);
+
+            if (!tap->filling) {
+                // the writer is behind; drop the rest rather than wait
+                if (!tap->dropping)
+                    atomic_fetch_add(&iqcapture.overruns, 1);
+                tap->dropping = true;
+                atomic_fetch_add(&iqcapture.bytes_dropped, bytes);
+                tap->gap = true;
+                return;
+            }
+
+            tap->filling->source = source;
+            tap->filling->format = format;
+            tap->filling->discontinuous = tap->gap;
+            tap->filling->sys_timestamp = mstime();
+            tap->filling->used = 0;
+            tap->gap = false;
+            tap->dropping = false;
+        }
+
+        size_t n = IQCAPTURE_BLOCK_SIZE - tap->filling->used;
+        if (n > bytes)
+            n = bytes;
+        memcpy(tap->filling->data + tap->filling->used, p, n);
+        tap->filling->used += n;
+        p += n;
+        bytes -= n;
+
+        if (tap->filling->used == IQCAPTURE_BLOCK_SIZE) {
+            iqcapture_queue_block(tap->filling);
+            tap->filling = NULL;
+        }
+    }
+}
+
+void iqcapture_toggle()
+{
+    atomic_fetch_xor(&iqcapture.capturing, 1);
+}
+
+void iqcapture_shutdown()
+{
+    if (!iqcapture.running)
+        return;
+
+    // the reader threads have stopped, so their partial blocks can be taken over
+    for (unsigned source = 0; source < MAGBUF_MAX_SOURCES; ++source) {
+        if (iqcapture.taps[source].filling) {
+            iqcapture_queue_block(iqcapture.taps[source].filling);
+            iqcapture.taps[source].filling = NULL;
+        }
+    }
+
+    pthread_mutex_lock(&iqcapture.mutex);
+    iqcapture.stop = true;
+    pthread_cond_signal(&iqcapture.cond);
+    pthread_mutex_unlock(&iqcapture.mutex);
+    pthread_join(iqcapture.thread, NULL);
+    iqcapture.running = false;
+
+    pthread_cond_destroy(&iqcapture.cond);
+    pthread_mutex_destroy(&iqcapture.mutex);
+
+    for (unsigned source = 0; source < MAGBUF_MAX_SOURCES; ++source) {
+        if (iqcapture.files[source].names) {
+            for (unsigned i = 0; i < Modes.iqcapture_files; ++i)
+                free(iqcapture.files[source].names[i]);
+            free(iqcapture.files[source].names);
+            iqcapture.files[source].names = NULL;
+        }
+    }
+
+    free(iqcapture.queue);
+    free(iqcapture.free_blocks);
+    free(iqcapture.blocks);
+    free(iqcapture.block_memory);
+    iqcapture.queue = iqcapture.free_blocks = NULL;
+    iqcapture.blocks = NULL;
+    iqcapture.block_memory = NULL;
+}
+
+void iqcapture_update_stats(struct stats *st)
+{
+    st->iqcapture_bytes += atomic_exchange(&iqcapture.bytes_written, 0);
+    st->iqcapture_dropped_bytes += atomic_exchange(&iqcapture.bytes_dropped, 0);
+    st->iqcapture_overruns += atomic_exchange(&iqcapture.overruns, 0);
+    st->iqcapture_files += atomic_exchange(&iqcapture.files_started, 0);
+
+    int capturing = atomic_load(&iqcapture.capturing);
+    if (iqcapture.running && capturing != iqcapture.reported_capturing) {
+        fprintf(stderr, "iq-capture: %s capturing samples to %s\n", capturing ? "started" : "stopped", Modes.iqcapture_dir);
+        iqcapture.reported_capturing = capturing;
+    }
+}
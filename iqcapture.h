@@ -0,0 +1,44 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// iqcapture.h: raw sample capture prototypes
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef IQCAPTURE_H
+#define IQCAPTURE_H
+
+struct stats;
+
+// Allocate the capture buffers and start the writer thread (--iq-capture).
+// Returns false on error.
+bool iqcapture_init();
+
+// Write out everything captured so far and stop the writer thread. Call
+// after the reader threads have stopped.
+void iqcapture_shutdown();
+
+// Called by the SDR reader thread of 'source' with raw samples in 'format',
+// as delivered by the SDR and before conversion. The samples are copied into
+// the capture buffers; if the writer thread has fallen behind, they are
+// dropped instead. Never blocks. Does nothing unless capturing.
+void iqcapture_tap(unsigned source, input_format_t format, const void *data, size_t bytes);
+
+// Start or stop capturing (--iq-capture-on-demand, on SIGUSR1). Async-signal-safe.
+void iqcapture_toggle();
+
+// Called periodically from the main thread: add capture counters to *st
+// and report starts and stops
+void iqcapture_update_stats(struct stats *st);
+
+#endif
@@ -0,0 +1,585 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// iqz.c: compressed, indexed sample container
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+#include "iqz.h"
+
+#include <inttypes.h>
+#include <sys/uio.h>
+
+#ifdef ENABLE_ZLIB
+#include <zlib.h>
+#endif
+
+// The on-disk structures are read and written directly, so they must have
+// the documented layout, in little-endian byte order
+_Static_assert(sizeof(struct iqz_header) == 64, "iqz header layout");
+_Static_assert(sizeof(struct iqz_chunk_header) == 24, "iqz chunk header layout");
+_Static_assert(sizeof(struct iqz_index_entry) == 16, "iqz index layout");
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "iqz.c assumes a little-endian host"
+#endif
+
+#define IQZ_MAX_WORKERS 8
+#define IQZ_DEFLATE_LEVEL 1     // the capture path must keep up with the SDR; higher levels gain little on noise
+
+unsigned iqz_bytes_per_sample(input_format_t format)
+{
+    switch (format) {
+    case INPUT_UC8:
+        return 2;
+    case INPUT_SC16:
+    case INPUT_SC16Q11:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+static bool iqz_pwrite_all(int fd, const void *data, size_t length, uint64_t offset)
+{
+    const char *p = data;
+    while (length > 0) {
+        ssize_t n = pwrite(fd, p, length, offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        length -= n;
+        offset += n;
+    }
+    return true;
+}
+
+static bool iqz_pread_all(int fd, void *data, size_t length, uint64_t offset)
+{
+    char *p = data;
+    while (length > 0) {
+        ssize_t n = pread(fd, p, length, offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        length -= n;
+        offset += n;
+    }
+    return true;
+}
+
+bool iqz_detect(int fd)
+{
+    char magic[4];
+    return iqz_pread_all(fd, magic, sizeof(magic), 0) && !memcmp(magic, IQZ_MAGIC, sizeof(magic));
+}
+
+//
+// Writing
+//
+
+struct iqz_writer {
+    int fd;
+    struct iqz_header header;
+    unsigned bytes_per_sample;
+    bool compress;
+
+    uint64_t offset;                    // where the next chunk goes
+    struct iqz_index_entry *index;
+    unsigned index_size;                // allocated entries
+
+    unsigned char *scratch;             // compressed chunk data
+    size_t scratch_size;
+};
+
+struct iqz_writer *iqz_writer_open(int fd, const struct iqz_info *info, unsigned chunk_samples, bool compress)
+{
+    struct iqz_writer *writer = calloc(1, sizeof(*writer));
+    if (!writer)
+        return NULL;
+
+    writer->fd = fd;
+    writer->bytes_per_sample = iqz_bytes_per_sample(info->format);
+#ifdef ENABLE_ZLIB
+    writer->compress = compress;
+#else
+    MODES_NOTUSED(compress);
+    writer->compress = false;
+#endif
+
+    memcpy(writer->header.magic, IQZ_MAGIC, sizeof(writer->header.magic));
+    writer->header.header_size = sizeof(struct iqz_header);
+    writer->header.format = info->format;
+    writer->header.chunk_samples = chunk_samples;
+    writer->header.sample_rate = info->sample_rate;
+    writer->header.gain_db = info->gain_db;
+    writer->header.start_time_ms = info->start_time_ms;
+
+#ifdef ENABLE_ZLIB
+    if (writer->compress) {
+        writer->scratch_size = compressBound((uLong) chunk_samples * writer->bytes_per_sample);
+        if (!(writer->scratch = malloc(writer->scratch_size))) {
+            free(writer);
+            return NULL;
+        }
+    }
+#endif
+
+    // the header is rewritten with the totals on close
+    writer->offset = sizeof(struct iqz_header);
+    if (!writer->bytes_per_sample || !iqz_pwrite_all(fd, &writer->header, sizeof(writer->header), 0)) {
+        free(writer->scratch);
+        free(writer);
+        return NULL;
+    }
+
+    return writer;
+}
+
+bool iqz_write_chunk(struct iqz_writer *writer, const void *data, unsigned samples)
+{
+    if (!samples)
+        return true;
+    if (samples > writer->header.chunk_samples)
+        return false;
+
+    size_t raw_size = (size_t) samples * writer->bytes_per_sample;
+    struct iqz_chunk_header chunk = {
+        .magic = IQZ_CHUNK_MAGIC,
+        .codec = IQZ_CODEC_STORED,
+        .stored_size = raw_size,
+        .samples = samples,
+        .first_sample = writer->header.total_samples
+    };
+    const void *stored = data;
+
+#ifdef ENABLE_ZLIB
+    if (writer->compress) {
+        uLongf compressed_size = writer->scratch_size;
+        if (compress2(writer->scratch, &compressed_size, data, raw_size, IQZ_DEFLATE_LEVEL) == Z_OK && compressed_size < raw_size) {
+            chunk.codec = IQZ_CODEC_DEFLATE;
+            chunk.stored_size = compressed_size;
+            stored = writer->scratch;
+        }
+    }
+#endif
+
+    if (writer->header.chunk_count == writer->index_size) {
+        unsigned new_size = writer->index_size ? writer->index_size * 2 : 256;
+        struct iqz_index_entry *new_index = realloc(writer->index, new_size * sizeof(*new_index));
+        if (!new_index)
+            return false;
+        writer->index = new_index;
+        writer->index_size = new_size;
+    }
+
+    struct iovec iov[2] = {
+        { .iov_base = &chunk, .iov_len = sizeof(chunk) },
+        { .iov_base = (void *) stored, .iov_len = chunk.stored_size }
+    };
+    size_t total = sizeof(chunk) + chunk.stored_size;
+    ssize_t n = pwritev(writer->fd, iov, 2, writer->offset);
+    if (n < 0 || (size_t) n < sizeof(chunk)) {
+        return false;
+    } else if ((size_t) n < total) {
+        // finish a short write
+        size_t done = n - sizeof(chunk);
+        if (!iqz_pwrite_all(writer->fd, (const char *) stored + done, chunk.stored_size - done, writer->offset + n))
+            return false;
+    }
+
+    writer->index[writer->header.chunk_count].offset = writer->offset;
+    writer->index[writer->header.chunk_count].first_sample = chunk.first_sample;
+    writer->header.chunk_count++;
+    writer->header.total_samples += samples;
+    writer->offset += total;
+    return true;
+}
+
+uint64_t iqz_writer_size(const struct iqz_writer *writer)
+{
+    return writer->offset + (uint64_t) writer->header.chunk_count * sizeof(struct iqz_index_entry);
+}
+
+bool iqz_writer_close(struct iqz_writer *writer)
+{
+    if (!writer)
+        return true;
+
+    bool ok = iqz_pwrite_all(writer->fd, writer->index, (size_t) writer->header.chunk_count * sizeof(*writer->index), writer->offset);
+    if (ok) {
+        writer->header.index_offset = writer->offset;
+        ok = iqz_pwrite_all(writer->fd, &writer->header, sizeof(writer->header), 0);
+    }
+
+    free(writer->index);
+    free(writer->scratch);
+    free(writer);
+    return ok;
+}
+
+//
+// Reading. Chunks are decompressed into a ring of slots, by worker threads
+// running ahead of the reader, or on the reader's thread if there are no
+// workers. Chunk 'c' always decompresses into slot c % slot_count; the
+// workers never run more than slot_count chunks ahead of the reader, so a
+// slot is only reused once its chunk has been read.
+//
+
+typedef enum { IQZ_SLOT_EMPTY, IQZ_SLOT_BUSY, IQZ_SLOT_READY, IQZ_SLOT_FAILED } iqz_slot_state_t;
+
+struct iqz_slot {
+    iqz_slot_state_t state;
+    uint64_t chunk;
+    size_t length;                      // bytes of samples in data
+    unsigned char *data;
+};
+
+struct iqz_decoder {
+    struct iqz_reader *reader;
+    pthread_t thread;
+    unsigned char *scratch;             // compressed chunk data
+};
+
+struct iqz_reader {
+    int fd;
+    struct iqz_header header;
+    unsigned bytes_per_sample;
+    size_t chunk_bytes;                 // largest chunk, uncompressed
+
+    struct iqz_index_entry *index;
+    unsigned chunk_count;
+
+    struct iqz_slot *slots;
+    unsigned slot_count;
+    struct iqz_decoder inline_decoder;  // used when there are no workers
+
+    struct iqz_decoder workers[IQZ_MAX_WORKERS];
+    unsigned worker_count;
+
+    pthread_mutex_t mutex;              // protects everything below
+    pthread_cond_t work_cond;           // signalled when a slot is freed, or on stop
+    pthread_cond_t ready_cond;          // signalled when a slot is decoded
+    uint64_t read_chunk;                // chunk being read
+    size_t read_offset;                 // bytes of read_chunk already read
+    uint64_t next_decode;               // next chunk to hand to a worker
+    unsigned busy;                      // slots being decoded
+    bool stop;
+};
+
+// Decode chunk 'chunk' into 'slot'; called without the mutex held
+static bool iqz_decode_chunk(struct iqz_decoder *decoder, uint64_t chunk, struct iqz_slot *slot)
+{
+    struct iqz_reader *reader = decoder->reader;
+    struct iqz_chunk_header header;
+
+    if (!iqz_pread_all(reader->fd, &header, sizeof(header), reader->index[chunk].offset))
+        return false;
+    if (header.magic != IQZ_CHUNK_MAGIC || header.first_sample != reader->index[chunk].first_sample)
+        return false;
+
+    size_t raw_size = (size_t) header.samples * reader->bytes_per_sample;
+    if (raw_size > reader->chunk_bytes)
+        return false;
+
+    uint64_t data_offset = reader->index[chunk].offset + sizeof(header);
+    switch (header.codec) {
+    case IQZ_CODEC_STORED:
+        if (header.stored_size != raw_size || !iqz_pread_all(reader->fd, slot->data, raw_size, data_offset))
+            return false;
+        break;
+
+#ifdef ENABLE_ZLIB
+    case IQZ_CODEC_DEFLATE: {
+        if (header.stored_size > compressBound(reader->chunk_bytes))
+            return false;
+        if (!iqz_pread_all(reader->fd, decoder->scratch, header.stored_size, data_offset))
+            return false;
+        uLongf length = raw_size;
+        if (uncompress(slot->data, &length, decoder->scratch, header.stored_size) != Z_OK || length != raw_size)
+            return false;
+        break;
+    }
+#endif
+
+    default:
+        fprintf(stderr, "iqz: chunk %" PRIu64 " uses unsupported codec %u\n", chunk, header.codec);
+        return false;
+    }
+
+    slot->length = raw_size;
+    return true;
+}
+
+static void *iqz_worker_entry(void *arg)
+{
+    struct iqz_decoder *decoder = arg;
+    struct iqz_reader *reader = decoder->reader;
+
+    pthread_mutex_lock(&reader->mutex);
+    for (;;) {
+        while (!reader->stop && (reader->next_decode >= reader->chunk_count || reader->next_decode >= reader->read_chunk + reader->slot_count))
+            pthread_cond_wait(&reader->work_cond, &reader->mutex);
+        if (reader->stop)
+            break;
+
+        uint64_t chunk = reader->next_decode++;
+        struct iqz_slot *slot = &reader->slots[chunk % reader->slot_count];
+        slot->state = IQZ_SLOT_BUSY;
+        slot->chunk = chunk;
+        ++reader->busy;
+        pthread_mutex_unlock(&reader->mutex);
+
+        bool ok = iqz_decode_chunk(decoder, chunk, slot);
+
+        pthread_mutex_lock(&reader->mutex);
+        slot->state = ok ? IQZ_SLOT_READY : IQZ_SLOT_FAILED;
+        --reader->busy;
+        pthread_cond_broadcast(&reader->ready_cond);
+    }
+    pthread_mutex_unlock(&reader->mutex);
+
+    return NULL;
+}
+
+// Build the index of a file that was not closed cleanly by walking its chunk headers
+static bool iqz_scan_chunks(struct iqz_reader *reader)
+{
+    struct stat st;
+    if (fstat(reader->fd, &st) < 0)
+        return false;
+
+    unsigned size = 0;
+    uint64_t offset = reader->header.header_size;
+    uint64_t samples = 0;
+    for (;;) {
+        struct iqz_chunk_header chunk;
+        if (offset + sizeof(chunk) > (uint64_t) st.st_size || !iqz_pread_all(reader->fd, &chunk, sizeof(chunk), offset))
+            break;
+        if (chunk.magic != IQZ_CHUNK_MAGIC || chunk.first_sample != samples || offset + sizeof(chunk) + chunk.stored_size > (uint64_t) st.st_size)
+            break;  // truncated or corrupt; keep what we have
+
+        if (reader->chunk_count == size) {
+            size = size ? size * 2 : 256;
+            struct iqz_index_entry *new_index = realloc(reader->index, size * sizeof(*new_index));
+            if (!new_index)
+                return false;
+            reader->index = new_index;
+        }
+
+        reader->index[reader->chunk_count].offset = offset;
+        reader->index[reader->chunk_count].first_sample = chunk.first_sample;
+        ++reader->chunk_count;
+        samples += chunk.samples;
+        offset += sizeof(chunk) + chunk.stored_size;
+    }
+
+    reader->header.total_samples = samples;
+    return true;
+}
+
+void iqz_reader_close(struct iqz_reader *reader)
+{
+    if (!reader)
+        return;
+
+    if (reader->worker_count) {
+        pthread_mutex_lock(&reader->mutex);
+        reader->stop = true;
+        pthread_cond_broadcast(&reader->work_cond);
+        pthread_mutex_unlock(&reader->mutex);
+
+        for (unsigned i = 0; i < reader->worker_count; ++i) {
+            pthread_join(reader->workers[i].thread, NULL);
+            free(reader->workers[i].scratch);
+        }
+    }
+
+    pthread_cond_destroy(&reader->ready_cond);
+    pthread_cond_destroy(&reader->work_cond);
+    pthread_mutex_destroy(&reader->mutex);
+
+    if (reader->slots) {
+        for (unsigned i = 0; i < reader->slot_count; ++i)
+            free(reader->slots[i].data);
+        free(reader->slots);
+    }
+    free(reader->inline_decoder.scratch);
+    free(reader->index);
+    free(reader);
+}
+
+static unsigned char *iqz_alloc_scratch(size_t chunk_bytes)
+{
+#ifdef ENABLE_ZLIB
+    return malloc(compressBound(chunk_bytes));
+#else
+    MODES_NOTUSED(chunk_bytes);
+    return NULL;
+#endif
+}
+
+struct iqz_reader *iqz_reader_open(int fd, struct iqz_info *info, unsigned workers)
+{
+    struct iqz_reader *reader = calloc(1, sizeof(*reader));
+    if (!reader)
+        return NULL;
+
+    reader->fd = fd;
+    pthread_mutex_init(&reader->mutex, NULL);
+    pthread_cond_init(&reader->work_cond, NULL);
+    pthread_cond_init(&reader->ready_cond, NULL);
+
+    if (!iqz_pread_all(fd, &reader->header, sizeof(reader->header), 0) ||
+        memcmp(reader->header.magic, IQZ_MAGIC, sizeof(reader->header.magic)) ||
+        reader->header.header_size < sizeof(struct iqz_header)) {
+        fprintf(stderr, "iqz: not a sample container\n");
+        goto fail;
+    }
+
+    reader->bytes_per_sample = iqz_bytes_per_sample(reader->header.format);
+    if (!reader->bytes_per_sample || !reader->header.chunk_samples || reader->header.chunk_samples > UINT32_MAX / 4) {
+        fprintf(stderr, "iqz: unsupported sample format or chunk size\n");
+        goto fail;
+    }
+    reader->chunk_bytes = (size_t) reader->header.chunk_samples * reader->bytes_per_sample;
+
+    if (reader->header.index_offset) {
+        reader->chunk_count = reader->header.chunk_count;
+        if (reader->chunk_count && !(reader->index = malloc((size_t) reader->chunk_count * sizeof(*reader->index))))
+            goto fail;
+        if (!iqz_pread_all(fd, reader->index, (size_t) reader->chunk_count * sizeof(*reader->index), reader->header.index_offset)) {
+            fprintf(stderr, "iqz: can't read the chunk index\n");
+            goto fail;
+        }
+    } else {
+        fprintf(stderr, "iqz: file has no index (capture interrupted?), scanning chunks\n");
+        if (!iqz_scan_chunks(reader))
+            goto fail;
+    }
+
+    if (workers > IQZ_MAX_WORKERS)
+        workers = IQZ_MAX_WORKERS;
+
+    // two slots per worker, so that each worker can start on its next chunk
+    // while the reader consumes the previous one
+    reader->slot_count = workers ? workers * 2 : 1;
+    if (!(reader->slots = calloc(reader->slot_count, sizeof(*reader->slots))))
+        goto fail;
+    for (unsigned i = 0; i < reader->slot_count; ++i) {
+        if (!(reader->slots[i].data = malloc(reader->chunk_bytes)))
+            goto fail;
+    }
+
+    reader->inline_decoder.reader = reader;
+    reader->inline_decoder.scratch = iqz_alloc_scratch(reader->chunk_bytes);
+
+    for (unsigned i = 0; i < workers; ++i) {
+        struct iqz_decoder *decoder = &reader->workers[i];
+        decoder->reader = reader;
+        decoder->scratch = iqz_alloc_scratch(reader->chunk_bytes);
+        if (pthread_create(&decoder->thread, NULL, iqz_worker_entry, decoder) != 0) {
+            free(decoder->scratch);
+            break;
+        }
+        ++reader->worker_count;
+    }
+
+    info->format = reader->header.format;
+    info->sample_rate = reader->header.sample_rate;
+    info->gain_db = reader->header.gain_db;
+    info->start_time_ms = reader->header.start_time_ms;
+    info->total_samples = reader->header.total_samples;
+    return reader;
+
+ fail:
+    iqz_reader_close(reader);
+    return NULL;
+}
+
+bool iqz_seek(struct iqz_reader *reader, uint64_t sample)
+{
+    if (sample >= reader->header.total_samples)
+        return false;
+
+    // find the last chunk starting at or before 'sample'
+    unsigned lo = 0, hi = reader->chunk_count;
+    while (hi - lo > 1) {
+        unsigned mid = lo + (hi - lo) / 2;
+        if (reader->index[mid].first_sample <= sample)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    pthread_mutex_lock(&reader->mutex);
+    // let in-flight decodes finish before their slots are discarded
+    while (reader->busy)
+        pthread_cond_wait(&reader->ready_cond, &reader->mutex);
+    for (unsigned i = 0; i < reader->slot_count; ++i)
+        reader->slots[i].state = IQZ_SLOT_EMPTY;
+    reader->read_chunk = reader->next_decode = lo;
+    reader->read_offset = (sample - reader->index[lo].first_sample) * reader->bytes_per_sample;
+    pthread_cond_broadcast(&reader->work_cond);
+    pthread_mutex_unlock(&reader->mutex);
+    return true;
+}
+
+ssize_t iqz_read(struct iqz_reader *reader, void *buf, size_t bytes)
+{
+    size_t done = 0;
+
+    pthread_mutex_lock(&reader->mutex);
+    while (done < bytes && reader->read_chunk < reader->chunk_count) {
+        uint64_t chunk = reader->read_chunk;
+        struct iqz_slot *slot = &reader->slots[chunk % reader->slot_count];
+
+        if (!reader->worker_count) {
+            if (slot->state != IQZ_SLOT_READY || slot->chunk != chunk) {
+                slot->chunk = chunk;
+                slot->state = iqz_decode_chunk(&reader->inline_decoder, chunk, slot) ? IQZ_SLOT_READY : IQZ_SLOT_FAILED;
+            }
+        } else {
+            while (slot->chunk != chunk || slot->state == IQZ_SLOT_EMPTY || slot->state == IQZ_SLOT_BUSY)
+                pthread_cond_wait(&reader->ready_cond, &reader->mutex);
+        }
+
+        if (slot->state == IQZ_SLOT_FAILED) {
+            fprintf(stderr, "iqz: chunk %" PRIu64 " is corrupt\n", chunk);
+            pthread_mutex_unlock(&reader->mutex);
+            return done ? (ssize_t) done : -1;
+        }
+
+        size_t n = slot->length - reader->read_offset;
+        if (n > bytes - done)
+            n = bytes - done;
+        memcpy((char *) buf + done, slot->data + reader->read_offset, n);
+        done += n;
+        reader->read_offset += n;
+
+        if (reader->read_offset >= slot->length) {
+            // finished with this chunk; its slot can be reused
+            slot->state = IQZ_SLOT_EMPTY;
+            reader->read_offset = 0;
+            ++reader->read_chunk;
+            pthread_cond_broadcast(&reader->work_cond);
+        }
+    }
+    pthread_mutex_unlock(&reader->mutex);
+
+    return done;
+}
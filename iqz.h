@@ -0,0 +1,113 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// iqz.h: compressed, indexed sample container (prototypes)
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef IQZ_H
+#define IQZ_H
+
+// An .iqz file holds raw SDR samples (UC8, SC16 or SC16Q11, exactly as the
+// SDR delivered them) in independently compressed chunks, so that a file
+// can be decompressed in parallel and read from any point. All integers are
+// little-endian.
+//
+//   header     64 bytes, see struct iqz_header
+//   chunks     each a 24-byte chunk header (struct iqz_chunk_header)
+//              followed by the chunk data
+//   index      one struct iqz_index_entry per chunk, at header.index_offset
+//
+// The index is written when the file is closed; a file without one (e.g.
+// after a crash) is indexed by walking the chunk headers when it is opened.
+
+#define IQZ_MAGIC "IQZ1"
+#define IQZ_CHUNK_MAGIC 0x4b4e4843U      // "CHNK"
+
+// Chunk compression. Each chunk records its own codec, as a chunk that
+// doesn't compress is stored instead.
+typedef enum {
+    IQZ_CODEC_STORED = 0,   // uncompressed
+    IQZ_CODEC_DEFLATE = 1,  // zlib deflate (needs a build with zlib)
+    IQZ_CODECS
+} iqz_codec_t;
+
+struct iqz_header {
+    char magic[4];              // IQZ_MAGIC
+    uint32_t header_size;       // sizeof(struct iqz_header)
+    uint32_t format;            // input_format_t of the samples
+    uint32_t chunk_samples;     // samples per chunk (the last chunk may be shorter)
+    double sample_rate;         // samples per second
+    double gain_db;             // SDR gain when the capture started, NAN if unknown
+    uint64_t start_time_ms;     // wall clock time of the first sample, ms since the epoch, 0 if unknown
+    uint64_t total_samples;     // number of samples in the file, 0 until closed
+    uint64_t index_offset;      // file offset of the index, 0 until closed
+    uint32_t chunk_count;       // number of chunks in the index, 0 until closed
+    uint32_t reserved;
+};
+
+struct iqz_chunk_header {
+    uint32_t magic;             // IQZ_CHUNK_MAGIC
+    uint32_t codec;             // iqz_codec_t
+    uint32_t stored_size;       // bytes of chunk data that follow
+    uint32_t samples;           // samples in the chunk
+    uint64_t first_sample;      // sample number of the first sample in the chunk
+};
+
+struct iqz_index_entry {
+    uint64_t offset;            // file offset of the chunk header
+    uint64_t first_sample;
+};
+
+// Description of the samples in a file
+struct iqz_info {
+    input_format_t format;
+    double sample_rate;
+    double gain_db;
+    uint64_t start_time_ms;
+    uint64_t total_samples;     // reading only
+};
+
+// Bytes per sample of each input format
+unsigned iqz_bytes_per_sample(input_format_t format);
+
+// Does the file start with an .iqz header? Doesn't move the file offset.
+bool iqz_detect(int fd);
+
+//
+// Writing. Samples are passed in one chunk at a time; chunks may have
+// different sizes, up to 'chunk_samples'.
+//
+struct iqz_writer;
+
+struct iqz_writer *iqz_writer_open(int fd, const struct iqz_info *info, unsigned chunk_samples, bool compress);
+bool iqz_write_chunk(struct iqz_writer *writer, const void *data, unsigned samples);
+// Bytes written so far, including the index still to be written
+uint64_t iqz_writer_size(const struct iqz_writer *writer);
+// Write the index and complete the header. Does not close fd. Frees the writer.
+bool iqz_writer_close(struct iqz_writer *writer);
+
+//
+// Reading. Chunks are decompressed by up to 'workers' threads ahead of
+// the reader.
+//
+struct iqz_reader;
+
+struct iqz_reader *iqz_reader_open(int fd, struct iqz_info *info, unsigned workers);
+// Continue reading from sample 'sample'; returns false if it is past the end
+bool iqz_seek(struct iqz_reader *reader, uint64_t sample);
+// Read up to 'bytes' bytes of raw samples; returns 0 at the end of the file, -1 on error
+ssize_t iqz_read(struct iqz_reader *reader, void *buf, size_t bytes);
+void iqz_reader_close(struct iqz_reader *reader);
+
+#endif
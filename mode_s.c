@@ -249,7 +249,79 @@ static bool isShortPIMessage(const unsigned char *msg)
 
 #define UNCHECKED_SYNDROME 0xFFFFFFFFU
 
-static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t *short_syndrome, uint32_t *long_syndrome)
+// The most bits that may be corrected in one message
+int modesMaxCorrectedBits(void)
+{
+    return Modes.fix_soft ? MODES_MAX_BITERRORS : Modes.nfix_crc;
+}
+
+// Only one in FIX_TIMING_SAMPLE diagnoses is timed, and that time is
+// scaled up: reading the clock costs about as much as a table lookup
+#define FIX_TIMING_SAMPLE 16
+
+static uint64_t fix_clock_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Find a correction for a message with the given syndrome. With per-bit
+// slicer confidence (and --fix-soft), first try flipping the least
+// confident bits; then fall back to the syndrome table. *type is set to
+// the kind of correction found. The work done is counted in *fix, if not
+// NULL.
+static struct errorinfo *diagnoseMessage(uint32_t syndrome, int bitlen, const uint16_t *confidence, struct errorinfo *soft_ei, struct fix_stats *fix, fix_type *type)
+{
+    struct errorinfo *ei;
+    bool timed;
+    uint64_t start = 0;
+
+    *type = FIX_TABLE;
+    if (syndrome == 0)
+        return modesChecksumDiagnose(syndrome, bitlen);
+
+    // error correction is shed when the demodulator is overloaded
+    if (Modes.overload_level >= OVERLOAD_NO_FIX)
+        return NULL;
+
+    if (confidence && Modes.fix_soft) {
+        timed = (fix && fix->attempts[FIX_SOFT] % FIX_TIMING_SAMPLE == 0);
+        if (timed)
+            start = fix_clock_ns();
+
+        ei = (modesChecksumSoftDiagnose(syndrome, bitlen, confidence, soft_ei) ? soft_ei : NULL);
+
+        if (fix) {
+            if (timed)
+                fix->ns[FIX_SOFT] += (fix_clock_ns() - start) * FIX_TIMING_SAMPLE;
+            fix->attempts[FIX_SOFT]++;
+            fix->found[FIX_SOFT] += (ei != NULL);
+        }
+
+        if (ei) {
+            *type = FIX_SOFT;
+            return ei;
+        }
+    }
+
+    timed = (fix && fix->attempts[FIX_TABLE] % FIX_TIMING_SAMPLE == 0);
+    if (timed)
+        start = fix_clock_ns();
+
+    ei = modesChecksumDiagnose(syndrome, bitlen);
+
+    if (fix) {
+        if (timed)
+            fix->ns[FIX_TABLE] += (fix_clock_ns() - start) * FIX_TIMING_SAMPLE;
+        fix->attempts[FIX_TABLE]++;
+        fix->found[FIX_TABLE] += (ei != NULL);
+    }
+
+    return ei;
+}
+
+static int correctMessage(const unsigned char *in, const uint16_t *confidence, unsigned char *out, uint32_t *short_syndrome, uint32_t *long_syndrome, struct fix_stats *fix, fix_type *fixtype)
 {
     // Possible DF values of the first byte of a message that could be a valid DF11/17/18
     // message after correction. See tools/df-correction-arrays.py for generator code.
@@ -266,6 +338,7 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
 
     *short_syndrome = UNCHECKED_SYNDROME;
     *long_syndrome = UNCHECKED_SYNDROME;
+    *fixtype = FIX_NONE;
 
     // Try to correct, including corrections to the initial 5 bit DF field
     // that determines message format
@@ -276,9 +349,11 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
     // Select the right bitset based on the maximum number of bit errors in the DF field that we could correct.
     // nb: strictly speaking, --no-fix-df doesn't _entirely_ disable correction of the DF field when nfix_crc == 2
     // (DF17 could be corrected to DF18 or vice versa), but it does disable the CPU hungry part of it.
-    const unsigned fix_df_bits = (Modes.fix_df ? Modes.nfix_crc : 0);
+    const unsigned fix_df_bits = (Modes.fix_df && Modes.overload_level < OVERLOAD_NO_FIX ? Modes.nfix_crc : 0);
 
     struct errorinfo *long_ei = NULL;
+    struct errorinfo long_soft_ei;
+    fix_type long_type = FIX_NONE;
     if (df_correctable_long[fix_df_bits] & df_bit) {
         *long_syndrome = modesChecksum(in, MODES_LONG_MSG_BITS);
         if (isLongPIMessage(in) && *long_syndrome == 0) {
@@ -287,10 +362,11 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
             return 0;
         }
 
-        long_ei = modesChecksumDiagnose(*long_syndrome, MODES_LONG_MSG_BITS);
+        long_ei = diagnoseMessage(*long_syndrome, MODES_LONG_MSG_BITS, confidence, &long_soft_ei, fix, &long_type);
     }
 
     struct errorinfo *short_ei = NULL;
+    fix_type short_type = FIX_NONE;
     if (df_correctable_short[fix_df_bits] & df_bit) {
         *short_syndrome = modesChecksum(in, MODES_SHORT_MSG_BITS);
         if (isShortPIMessage(in) && (*short_syndrome & 0xFFFF80) == 0) {
@@ -300,7 +376,9 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
             return 0;
         }
 
-        short_ei = modesChecksumDiagnose(*short_syndrome, MODES_SHORT_MSG_BITS); // assume IID == 0
+        // assume IID == 0; DF11 only gets 1-bit corrections (below), which
+        // the table always finds, so there is no point in a soft search
+        short_ei = diagnoseMessage(*short_syndrome, MODES_SHORT_MSG_BITS, NULL, NULL, fix, &short_type);
     }
 
     // Might be a damaged DF11/17/18, or might be another message type that doesn't have a full CRC
@@ -317,6 +395,7 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
         modesChecksumFix(out, long_ei);
         if (isLongPIMessage(out)) {
             // valid DF17/18 message after corrections
+            *fixtype = (long_errors ? long_type : FIX_NONE);
             return long_errors;
         }
     }
@@ -327,6 +406,7 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
         modesChecksumFix(out, short_ei);
         if (isShortPIMessage(out)) {
             // valid DF11 message after corrections
+            *fixtype = short_type;
             return short_errors;
         }
     }
@@ -336,6 +416,7 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
         modesChecksumFix(out, long_ei);
         if (isLongPIMessage(out)) {
             // valid DF17/18 message after corrections
+            *fixtype = (long_errors ? long_type : FIX_NONE);
             return long_errors;
         }
     }
@@ -348,6 +429,13 @@ static int correctMessage(const unsigned char *in, unsigned char *out, uint32_t
 // Score how plausible this ModeS message looks.
 // The more positive, the more reliable the message is.
 score_rank scoreModesMessage(const unsigned char *uncorrected)
+{
+    return scoreModesMessageSoft(uncorrected, NULL, NULL);
+}
+
+// As scoreModesMessage, with optional per-bit slicer confidence for
+// soft-decision error correction, and optional error correction stats.
+score_rank scoreModesMessageSoft(const unsigned char *uncorrected, const uint16_t *confidence, struct fix_stats *fix)
 {
     // This is a "valid" DF0 message, but it's not useful; we discard these messages
     static const unsigned char all_zeros[MODES_SHORT_MSG_BYTES] = { 0, 0, 0, 0, 0, 0, 0 };
@@ -357,7 +445,8 @@ score_rank scoreModesMessage(const unsigned char *uncorrected)
     // try to produce a corrected DF11/17/18, including correcting the DF bits
     unsigned char corrected[14];
     uint32_t short_syndrome, long_syndrome;
-    int corrections = correctMessage(uncorrected, corrected, &short_syndrome, &long_syndrome);
+    fix_type fixtype;
+    int corrections = correctMessage(uncorrected, confidence, corrected, &short_syndrome, &long_syndrome, fix, &fixtype);
 
     unsigned df = getbits(corrected, 1, 5); // Downlink Format
     switch (df) {
@@ -521,7 +610,7 @@ int decodeModesMessage(struct modesMessage *mm, const unsigned char *in)
 {
     // score the message if needed (it might be coming off the network)
     if (mm->score == SR_NOT_SET)
-        mm->score = scoreModesMessage(in);
+        mm->score = scoreModesMessageSoft(in, mm->confidence, NULL);
 
     if (mm->score < SR_UNKNOWN_THRESHOLD)
         return -1;
@@ -533,7 +622,7 @@ int decodeModesMessage(struct modesMessage *mm, const unsigned char *in)
 
     // Apply corrections to our local copy
     uint32_t short_syndrome, long_syndrome;
-    int corrections = correctMessage(in, mm->msg, &short_syndrome, &long_syndrome);
+    int corrections = correctMessage(in, mm->confidence, mm->msg, &short_syndrome, &long_syndrome, NULL, &mm->fixtype);
     const unsigned char *msg = mm->msg;
 
     // Get the message type ASAP as other operations depend on this
@@ -730,7 +819,8 @@ int decodeModesMessage(struct modesMessage *mm, const unsigned char *in)
     // MB (messsage, Comm-B)
     if (mm->msgtype == 20 || mm->msgtype == 21) {
         memcpy(mm->MB, &msg[4], 7);
-        decodeCommB(mm);
+        if (Modes.overload_level < OVERLOAD_NO_COMMB)
+            decodeCommB(mm);
     }
 
     // MD (message, Comm-D)
@@ -2264,24 +2354,90 @@ void displayModesMessage(struct modesMessage *mm) {
 //
 //=========================================================================
 //
-// When a new message is available, because it was decoded from the RTL device,
-// file, or received in the TCP input port, or any other way we can receive a
-// decoded message, we call this function in order to use the message.
-//
-// Basically this function passes a raw message to the upper layers for further
-// processing and visualization
+// With more than one SDR source (--add-source), the same transmission is
+// usually received by several sources. Remember the recent messages in a
+// small hash table keyed on the message bits; a message is a duplicate if a
+// different source delivered the same bits within SOURCE_DUPLICATE_WINDOW_MS.
 //
-void useModesMessage(struct modesMessage *mm) {
-    struct aircraft *a;
+
+#define SOURCE_DUPLICATE_BUCKETS 4096
+#define SOURCE_DUPLICATE_PROBES 4
+#define SOURCE_DUPLICATE_WINDOW_MS 100
+
+static struct {
+    uint64_t sysTimestamp;
+    unsigned source;
+    int msgbits;
+    unsigned char msg[MODES_LONG_MSG_BYTES];
+} source_duplicates[SOURCE_DUPLICATE_BUCKETS];
+
+static bool sourceDuplicate(struct modesMessage *mm)
+{
+    unsigned bytes = mm->msgbits / 8;
+
+    // FNV-1a over the (corrected) message bits
+    uint32_t hash = 2166136261U;
+    for (unsigned i = 0; i < bytes; ++i)
+        hash = (hash ^ mm->msg[i]) * 16777619U;
+
+    // Look at a few buckets, so that unrelated messages landing in the same
+    // bucket don't push out a message before its duplicates arrive; a new
+    // message replaces the oldest of them
+    unsigned oldest = hash % SOURCE_DUPLICATE_BUCKETS;
+    for (unsigned probe = 0; probe < SOURCE_DUPLICATE_PROBES; ++probe) {
+        unsigned bucket = (hash + probe) % SOURCE_DUPLICATE_BUCKETS;
+        if (source_duplicates[bucket].sysTimestamp < source_duplicates[oldest].sysTimestamp)
+            oldest = bucket;
+
+        if (source_duplicates[bucket].msgbits != mm->msgbits || memcmp(source_duplicates[bucket].msg, mm->msg, bytes))
+            continue;
+
+        uint64_t seen = source_duplicates[bucket].sysTimestamp;
+        uint64_t delta = (seen > mm->sysTimestampMsg ? seen - mm->sysTimestampMsg : mm->sysTimestampMsg - seen);
+        if (delta <= SOURCE_DUPLICATE_WINDOW_MS && source_duplicates[bucket].source != mm->sdr_source)
+            return true;
+
+        // same message again from the same source, or a while later: start over
+        oldest = bucket;
+        break;
+    }
+
+    source_duplicates[oldest].sysTimestamp = mm->sysTimestampMsg;
+    source_duplicates[oldest].source = mm->sdr_source;
+    source_duplicates[oldest].msgbits = mm->msgbits;
+    memcpy(source_duplicates[oldest].msg, mm->msg, bytes);
+    return false;
+}
+
+// Duplicate suppression and message counts; returns false if the message
+// should be dropped
+static bool countModesMessage(struct modesMessage *mm)
+{
+    if (Modes.sdr_sources > 1 && !mm->remote) {
+        // Merge the output of several local sources
+        if (sourceDuplicate(mm)) {
+            ++Modes.stats_current.source_duplicates[mm->sdr_source];
+            return false;
+        }
+        ++Modes.stats_current.source_messages[mm->sdr_source];
+
+        // The 12MHz clocks of the different devices are unrelated, so only
+        // the first source's timestamps can be used for multilateration
+        if (mm->sdr_source > 0)
+            mm->timestampMsg = 0;
+    }
 
     ++Modes.stats_current.messages_total;
     if (mm->msgtype >= 0 && mm->msgtype < 32) {
         ++Modes.stats_current.messages_by_df[mm->msgtype];
     }
 
-    // Track aircraft state
-    a = trackUpdateFromMessage(mm);
+    return true;
+}
 
+// Display a message and pass it to the network output
+static void outputModesMessage(struct modesMessage *mm, struct aircraft *a)
+{
     // In non-interactive non-quiet mode, display messages on standard output
     if (!Modes.interactive && !Modes.quiet && (!Modes.show_only || mm->addr == Modes.show_only)) {
         displayModesMessage(mm);
@@ -2293,6 +2449,95 @@ void useModesMessage(struct modesMessage *mm) {
     }
 }
 
+//
+//=========================================================================
+//
+// When a new message is available, because it was decoded from the RTL device,
+// file, or received in the TCP input port, or any other way we can receive a
+// decoded message, we call this function in order to use the message.
+//
+// Basically this function passes a raw message to the upper layers for further
+// processing and visualization
+//
+void useModesMessage(struct modesMessage *mm) {
+    struct aircraft *a;
+
+    if (!countModesMessage(mm))
+        return;
+
+    // Track aircraft state
+    a = trackUpdateFromMessage(mm);
+
+    outputModesMessage(mm, a);
+}
+
+//
+// The demodulators don't pass messages on as they find them: the messages of
+// a sample buffer are queued, and delivered together once the whole buffer
+// has been demodulated. Demodulation, tracking and output then each run with
+// their own working set in cache, rather than taking turns evicting each
+// other's.
+//
+static struct modesMessage *queued_messages;
+static unsigned queued_count;
+static unsigned queued_capacity;
+
+// Queue a demodulated message for deliverModesMessages()
+void queueModesMessage(const struct modesMessage *mm)
+{
+    if (queued_count == queued_capacity) {
+        unsigned capacity = queued_capacity ? queued_capacity * 2 : 64;
+        struct modesMessage *messages = realloc(queued_messages, capacity * sizeof(*messages));
+        if (!messages) {
+            // deliver what we have, then this one
+            struct modesMessage copy = *mm;
+            deliverModesMessages();
+            useModesMessage(&copy);
+            return;
+        }
+        queued_messages = messages;
+        queued_capacity = capacity;
+    }
+
+    queued_messages[queued_count++] = *mm;
+}
+
+// Pass all queued messages on, in the order they were queued (which is
+// timestamp order, within each buffer)
+void deliverModesMessages()
+{
+    struct timespec phase_start;
+    unsigned i;
+
+    if (!queued_count)
+        return;
+
+    start_phase_timing(&phase_start);
+    for (i = 0; i < queued_count; ++i) {
+        struct modesMessage *mm = &queued_messages[i];
+
+        if (!countModesMessage(mm))
+            continue;
+
+        // The output of a message may depend on the aircraft state it
+        // produced, so this is done message by message
+        struct aircraft *a = trackUpdateFromMessage(mm);
+        update_phase_timing(&phase_start, &Modes.stats_current.track_cpu);
+
+        outputModesMessage(mm, a);
+        update_phase_timing(&phase_start, &Modes.stats_current.output_cpu);
+    }
+
+    queued_count = 0;
+}
+
+void modesMessageQueueCleanup()
+{
+    free(queued_messages);
+    queued_messages = NULL;
+    queued_count = queued_capacity = 0;
+}
+
 //
 // ===================== Mode S detection and decoding  ===================
 //
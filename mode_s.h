@@ -80,10 +80,15 @@ typedef enum {
 } score_rank;
 
 int modesMessageLenByType(int type);
+int modesMaxCorrectedBits(void);
 score_rank scoreModesMessage(const unsigned char *msg);
+score_rank scoreModesMessageSoft(const unsigned char *msg, const uint16_t *confidence, struct fix_stats *fix);
 int decodeModesMessage (struct modesMessage *mm, const unsigned char *msg);
 void displayModesMessage(struct modesMessage *mm);
 void useModesMessage    (struct modesMessage *mm);
+void queueModesMessage  (const struct modesMessage *mm);
+void deliverModesMessages();
+void modesMessageQueueCleanup();
 
 // datafield extraction helpers
 
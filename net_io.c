@@ -1811,13 +1811,62 @@ static char * appendStatsJson(char *p,
                            st->demod_rejected_bad,
                            st->demod_rejected_unknown_icao);
 
-        for (i=0; i <= Modes.nfix_crc; ++i) {
+        for (i=0; i <= modesMaxCorrectedBits(); ++i) {
             if (i == 0) p = safe_snprintf(p, end, ",\"accepted\":[%u", st->demod_accepted[i]);
             else p = safe_snprintf(p, end, ",%u", st->demod_accepted[i]);
         }
 
         p = safe_snprintf(p, end, "]");
 
+        for (i = 0; i < 6; ++i) {
+            if (st->demod_phases_scored[i])
+                break;
+        }
+        if (i < 6) {
+            for (i = 0; i < 6; ++i)
+                p = safe_snprintf(p, end, "%s%u", i == 0 ? ",\"phases_scored\":[" : ",", st->demod_phases_scored[i]);
+            p = safe_snprintf(p, end, "]");
+        }
+
+        if (st->demod_correlate_preambles) {
+            p = safe_snprintf(p, end, ",\"correlate\":{\"modes\":%u", st->demod_correlate_preambles);
+            for (i = 0; i <= modesMaxCorrectedBits(); ++i)
+                p = safe_snprintf(p, end, "%s%u", i == 0 ? ",\"accepted\":[" : ",", st->demod_correlate_accepted[i]);
+            p = safe_snprintf(p, end, "],\"correlate_only\":%u}", st->demod_correlate_only);
+        }
+
+        if (Modes.nfix_crc) {
+            p = safe_snprintf(p, end, ",\"fix\":{");
+            for (i = FIX_TABLE; i < FIX_TYPES; ++i) {
+                p = safe_snprintf(p, end, "%s\"%s\":{\"attempts\":%u,\"found\":%u,\"accepted\":%u,\"ms\":%.1f}",
+                                  i == FIX_TABLE ? "" : ",", fix_type_name(i),
+                                  st->fix.attempts[i], st->fix.found[i], st->fix.accepted[i], st->fix.ns[i] / 1e6);
+            }
+            p = safe_snprintf(p, end, "}");
+        }
+
+        for (i = 0; i < MAGBUF_DROP_CAUSES; ++i) {
+            p = safe_snprintf(p, end, "%s\"%s\":%llu", i == 0 ? ",\"samples_dropped_by_cause\":{" : ",",
+                              fifo_drop_cause_name(i), (unsigned long long)st->samples_dropped_by_cause[i]);
+        }
+        for (i = 0; i < MAGBUF_DROP_CAUSES; ++i) {
+            p = safe_snprintf(p, end, "%s\"%s\":%u", i == 0 ? "},\"discontinuities\":{" : ",",
+                              fifo_drop_cause_name(i), st->discontinuities[i]);
+        }
+        p = safe_snprintf(p, end, "}");
+
+        if (Modes.sdr_sources > 1) {
+            for (unsigned source = 0; source < Modes.sdr_sources; ++source) {
+                p = safe_snprintf(p, end, "%s{\"samples_processed\":%llu,\"samples_dropped\":%llu,\"messages\":%u,\"duplicates\":%u}",
+                                  source == 0 ? ",\"sources\":[" : ",",
+                                  (unsigned long long)st->source_samples_processed[source],
+                                  (unsigned long long)st->source_samples_dropped[source],
+                                  st->source_messages[source],
+                                  st->source_duplicates[source]);
+            }
+            p = safe_snprintf(p, end, "]");
+        }
+
         if (st->signal_power_sum > 0 && st->signal_power_count > 0)
             p = safe_snprintf(p, end, ",\"signal\":%.1f", 10 * log10(st->signal_power_sum / st->signal_power_count));
         if (st->noise_power_sum > 0 && st->noise_power_count > 0)
@@ -1839,7 +1888,7 @@ static char * appendStatsJson(char *p,
                            st->remote_rejected_bad,
                            st->remote_rejected_unknown_icao);
 
-        for (i=0; i <= Modes.nfix_crc; ++i) {
+        for (i=0; i <= modesMaxCorrectedBits(); ++i) {
             if (i == 0) p = safe_snprintf(p, end, ",\"accepted\":[%u", st->remote_accepted[i]);
             else p = safe_snprintf(p, end, ",%u", st->remote_accepted[i]);
         }
@@ -1850,6 +1899,9 @@ static char * appendStatsJson(char *p,
     uint64_t demod_cpu_millis = (uint64_t)st->demod_cpu.tv_sec*1000UL + st->demod_cpu.tv_nsec/1000000UL;
     uint64_t reader_cpu_millis = (uint64_t)st->reader_cpu.tv_sec*1000UL + st->reader_cpu.tv_nsec/1000000UL;
     uint64_t background_cpu_millis = (uint64_t)st->background_cpu.tv_sec*1000UL + st->background_cpu.tv_nsec/1000000UL;
+    uint64_t decode_cpu_millis = (uint64_t)st->decode_cpu.tv_sec*1000UL + st->decode_cpu.tv_nsec/1000000UL;
+    uint64_t track_cpu_millis = (uint64_t)st->track_cpu.tv_sec*1000UL + st->track_cpu.tv_nsec/1000000UL;
+    uint64_t output_cpu_millis = (uint64_t)st->output_cpu.tv_sec*1000UL + st->output_cpu.tv_nsec/1000000UL;
 
     p = safe_snprintf(p, end,
                       ",\"cpr\":{\"surface\":%u"
@@ -1867,11 +1919,7 @@ static char * appendStatsJson(char *p,
                       ",\"local_speed\":%u"
                       ",\"filtered\":%u}"
                       ",\"altitude_suppressed\":%u"
-                      ",\"cpu\":{\"demod\":%llu,\"reader\":%llu,\"background\":%llu}"
-                      ",\"tracks\":{\"all\":%u"
-                      ",\"single_message\":%u"
-                      ",\"unreliable\":%u}"
-                      ",\"messages\":%u",
+                      ",\"cpu\":{\"demod\":%llu,\"decode\":%llu,\"track\":%llu,\"output\":%llu,\"reader\":%llu,\"background\":%llu",
                       st->cpr_surface,
                       st->cpr_airborne,
                       st->cpr_global_ok,
@@ -1888,8 +1936,26 @@ static char * appendStatsJson(char *p,
                       st->cpr_filtered,
                       st->suppressed_altitude_messages,
                       (unsigned long long)demod_cpu_millis,
+                      (unsigned long long)decode_cpu_millis,
+                      (unsigned long long)track_cpu_millis,
+                      (unsigned long long)output_cpu_millis,
                       (unsigned long long)reader_cpu_millis,
-                      (unsigned long long)background_cpu_millis,
+                      (unsigned long long)background_cpu_millis);
+
+    if (Modes.demod_threads > 1) {
+        for (i = 0; i < (int)Modes.demod_threads && i < MODES_MAX_DEMOD_THREADS; ++i) {
+            uint64_t worker_cpu_millis = (uint64_t)st->demod_worker_cpu[i].tv_sec*1000UL + st->demod_worker_cpu[i].tv_nsec/1000000UL;
+            p = safe_snprintf(p, end, "%s%llu", i == 0 ? ",\"demod_workers\":[" : ",", (unsigned long long)worker_cpu_millis);
+        }
+        p = safe_snprintf(p, end, "]");
+    }
+
+    p = safe_snprintf(p, end,
+                      "}"
+                      ",\"tracks\":{\"all\":%u"
+                      ",\"single_message\":%u"
+                      ",\"unreliable\":%u}"
+                      ",\"messages\":%u",
                       st->unique_aircraft,
                       st->single_message_aircraft,
                       st->unreliable_aircraft,
@@ -1930,10 +1996,69 @@ static char * appendStatsJson(char *p,
         }
         p = safe_snprintf(p, end, "]}");
     }
+    if (st->overload_valid) {
+        p = safe_snprintf(p, end,
+                          ",\"overload\":"
+                          "{\"level\":%d"
+                          ",\"changes\":%u"
+                          ",\"level_seconds\":[",
+                          st->overload_level,
+                          st->overload_changes);
+        for (unsigned i = 0; i < OVERLOAD_LEVELS; ++i)
+            p = safe_snprintf(p, end, "%s%u", i ? "," : "", st->overload_level_seconds[i]);
+        p = safe_snprintf(p, end, "]}");
+    }
+    if (Modes.iqcapture_dir) {
+        p = safe_snprintf(p, end,
+                          ",\"iq_capture\":"
+                          "{\"bytes\":%llu"
+                          ",\"dropped_bytes\":%llu"
+                          ",\"overruns\":%u"
+                          ",\"files\":%u}",
+                          (unsigned long long)st->iqcapture_bytes,
+                          (unsigned long long)st->iqcapture_dropped_bytes,
+                          st->iqcapture_overruns,
+                          st->iqcapture_files);
+    }
     p = safe_snprintf(p, end, "}");
     return p;
 }
 
+static char *appendThreadPolicyJson(char *p, char *end, const struct thread_policy *policy, const char *key)
+{
+    p = safe_snprintf(p, end, "\"%s\":{", key);
+    const char *sep = "";
+    if (policy->pinned) {
+        p = safe_snprintf(p, end, "\"cpu\":%d", policy->cpu);
+        sep = ",";
+    }
+    if (policy->realtime) {
+        p = safe_snprintf(p, end, "%s\"priority\":%d", sep, policy->priority);
+        sep = ",";
+    }
+    if (policy->error[0])
+        p = safe_snprintf(p, end, "%s\"error\":\"%s\"", sep, policy->error);
+    return safe_snprintf(p, end, "}");
+}
+
+// Scheduling applied to the pipeline threads; only present if some was requested
+static char *appendSchedulingJson(char *p, char *end)
+{
+    if (!Modes.reader_policy.pin && !Modes.reader_policy.priority &&
+        !Modes.demod_policy.pin && !Modes.demod_policy.priority &&
+        !Modes.mlock)
+        return p;
+
+    p = safe_snprintf(p, end, ",\n\"scheduling\":{");
+    p = appendThreadPolicyJson(p, end, &Modes.reader_policy, "reader");
+    p = safe_snprintf(p, end, ",");
+    p = appendThreadPolicyJson(p, end, &Modes.demod_policy, "demod");
+    p = safe_snprintf(p, end, ",\"mlock\":%s", Modes.mlocked ? "true" : "false");
+    if (Modes.mlock_error[0])
+        p = safe_snprintf(p, end, ",\"mlock_error\":\"%s\"", Modes.mlock_error);
+    return safe_snprintf(p, end, "}");
+}
+
 char *generateStatsJson(const char *url_path, int *len) {
     MODES_NOTUSED(url_path);
 
@@ -1964,6 +2089,7 @@ char *generateStatsJson(const char *url_path, int *len) {
     p = safe_snprintf(p, end, ",\n");
 
     p = appendStatsJson(p, end, &Modes.stats_alltime, "total");
+    p = appendSchedulingJson(p, end);
     p = safe_snprintf(p, end, "\n}\n");
 
     int used = p - buf;
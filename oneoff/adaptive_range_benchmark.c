@@ -0,0 +1,253 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// adaptive_range_benchmark.c: compare noise percentile estimators for adaptive range control
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// This feeds synthetic noise (with occasional loud bursts) through two
+// implementations of the adaptive range noise measurement, in the same
+// pattern as adaptive.c: many short runs of samples between decoded
+// messages, then a percentile search and reset at the end of each block.
+//
+//   radix     - the original full-resolution 65536-bucket radix sort
+//   histogram - the 4096-bucket log-spaced histogram (log_histogram_u16)
+//
+// For each it reports CPU time per block and, where the kernel allows
+// perf_event_open, cache references and misses. It also reports the
+// largest difference between the two percentile estimates, in dB.
+//
+// Usage: adaptive_range_benchmark [wisdom-file|- [blocks [samples_per_block [percentile]]]]
+
+#include "../dump1090.h"
+#include "../dsp/helpers/log_histogram.h"
+
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+static unsigned bench_blocks = 20;
+static unsigned bench_block_samples = 1200000;  // one block at 2.4MHz with a 50% duty cycle
+static unsigned bench_percentile = 40;
+
+static uint16_t *testdata;
+static unsigned *run_lengths;
+static unsigned run_count;
+
+//
+// Original estimator
+//
+
+static unsigned *radix;
+static unsigned radix_counter;
+
+static void radix_update(const uint16_t *buf, unsigned length)
+{
+    radix_counter += length;
+    while (length--) {
+        ++radix[buf[0]];
+        ++buf;
+    }
+}
+
+static uint16_t radix_end_of_block()
+{
+    unsigned n = 0, i = 0;
+    unsigned count_n = radix_counter * bench_percentile / 100;
+    while (i < 65536 && n <= count_n)
+        n += radix[i++];
+
+    memset(radix, 0, 65536 * sizeof(unsigned));
+    radix_counter = 0;
+    return i - 1;
+}
+
+//
+// Log-spaced histogram estimator
+//
+
+static uint32_t histogram[LOG_HISTOGRAM_SIZE];
+static unsigned histogram_counter;
+
+static void histogram_update(const uint16_t *buf, unsigned length)
+{
+    histogram_counter += length;
+    starch_log_histogram_u16(buf, length, histogram);
+}
+
+static uint16_t histogram_end_of_block()
+{
+    unsigned n = 0, i = 0;
+    unsigned count_n = histogram_counter * bench_percentile / 100;
+    while (i < LOG_HISTOGRAM_BUCKETS && n <= count_n)
+        n += log_histogram_count(histogram, i++);
+
+    memset(histogram, 0, sizeof(histogram));
+    histogram_counter = 0;
+    return log_histogram_value(i - 1);
+}
+
+//
+// Harness
+//
+
+static int perf_open(uint32_t type, uint64_t config)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static uint64_t perf_read(int fd)
+{
+    uint64_t value = 0;
+    if (fd < 0 || read(fd, &value, sizeof(value)) != sizeof(value))
+        return 0;
+    return value;
+}
+
+static void generate_testdata()
+{
+    // Rayleigh-distributed noise around -30dBFS, with a loud burst now and then
+    srand(1);
+    for (unsigned i = 0; i < bench_block_samples; ++i) {
+        double u = (rand() + 1.0) / (RAND_MAX + 2.0);
+        double mag = 2048.0 * sqrt(-2.0 * log(u));
+        if (rand() % 1000 == 0)
+            mag *= 20;
+        testdata[i] = (mag > 65535.0 ? 65535 : (uint16_t) mag);
+    }
+
+    // Split each block into runs, as if interrupted by decoded messages
+    run_count = 0;
+    unsigned remaining = bench_block_samples;
+    while (remaining > 0) {
+        unsigned run = 50 + rand() % 4000;
+        if (run > remaining)
+            run = remaining;
+        run_lengths[run_count++] = run;
+        remaining -= run;
+    }
+}
+
+static void run_one(const char *name,
+                    void (*update)(const uint16_t *, unsigned),
+                    uint16_t (*end_of_block)(),
+                    uint16_t *results)
+{
+    int fd_refs = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES);
+    int fd_misses = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+
+    struct timespec start, end;
+
+    if (fd_refs >= 0)
+        ioctl(fd_refs, PERF_EVENT_IOC_ENABLE, 0);
+    if (fd_misses >= 0)
+        ioctl(fd_misses, PERF_EVENT_IOC_ENABLE, 0);
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &start);
+
+    for (unsigned block = 0; block < bench_blocks; ++block) {
+        const uint16_t *p = testdata;
+        for (unsigned r = 0; r < run_count; ++r) {
+            if (p + run_lengths[r] > testdata + bench_block_samples)
+                p = testdata;
+            update(p, run_lengths[r]);
+            p += run_lengths[r] + 120; // skip a "decoded message"
+        }
+        results[block] = end_of_block();
+    }
+
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &end);
+    if (fd_refs >= 0)
+        ioctl(fd_refs, PERF_EVENT_IOC_DISABLE, 0);
+    if (fd_misses >= 0)
+        ioctl(fd_misses, PERF_EVENT_IOC_DISABLE, 0);
+
+    double elapsed_us = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / 1e3;
+    fprintf(stderr, "  %-10s %10.1f us/block  %6.2f ns/sample",
+            name, elapsed_us / bench_blocks, elapsed_us * 1e3 / bench_blocks / bench_block_samples);
+
+    if (fd_refs >= 0 && fd_misses >= 0) {
+        uint64_t refs = perf_read(fd_refs);
+        uint64_t misses = perf_read(fd_misses);
+        fprintf(stderr, "  %10.0f cache refs/block  %10.0f cache misses/block\n",
+                (double) refs / bench_blocks, (double) misses / bench_blocks);
+    } else {
+        fprintf(stderr, "  (cache counters unavailable: %s)\n", strerror(errno));
+    }
+
+    if (fd_refs >= 0)
+        close(fd_refs);
+    if (fd_misses >= 0)
+        close(fd_misses);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "-"))
+        starch_read_wisdom(argv[1]);
+    if (argc > 2)
+        bench_blocks = atoi(argv[2]);
+    if (argc > 3)
+        bench_block_samples = atoi(argv[3]);
+    if (argc > 4)
+        bench_percentile = atoi(argv[4]);
+
+    if (!bench_blocks || bench_block_samples < 4096 || bench_percentile > 100) {
+        fprintf(stderr, "usage: %s [wisdom-file|- [blocks [samples_per_block [percentile]]]]\n", argv[0]);
+        return 1;
+    }
+
+    testdata = malloc(bench_block_samples * sizeof(testdata[0]));
+    run_lengths = malloc((bench_block_samples / 50 + 1) * sizeof(run_lengths[0]));
+    radix = calloc(65536, sizeof(radix[0]));
+    uint16_t *radix_results = calloc(bench_blocks, sizeof(uint16_t));
+    uint16_t *histogram_results = calloc(bench_blocks, sizeof(uint16_t));
+    if (!testdata || !run_lengths || !radix || !radix_results || !histogram_results) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    generate_testdata();
+
+    fprintf(stderr, "%u blocks of %u samples in %u runs, %u%% percentile, log_histogram_u16 = %s\n",
+            bench_blocks, bench_block_samples, run_count, bench_percentile,
+            starch_log_histogram_u16_select()->name);
+
+    run_one("radix", radix_update, radix_end_of_block, radix_results);
+    run_one("histogram", histogram_update, histogram_end_of_block, histogram_results);
+
+    double worst_db = 0;
+    for (unsigned block = 0; block < bench_blocks; ++block) {
+        if (!radix_results[block] || !histogram_results[block])
+            continue;
+        double db = fabs(20 * log10((double) histogram_results[block] / radix_results[block]));
+        if (db > worst_db)
+            worst_db = db;
+    }
+
+    fprintf(stderr, "  percentile: radix %u, histogram %u, worst difference %.3f dB\n",
+            radix_results[0], histogram_results[0], worst_db);
+
+    free(testdata);
+    free(run_lengths);
+    free(radix);
+    free(radix_results);
+    free(histogram_results);
+    return 0;
+}
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+# Compare the demodulator CPU use of several option sets on a recorded
+# capture, and check whether they produce the same messages.
+#
+# Run me like this:
+#  oneoff/demod_benchmark.py capture.uc8 -- "--modeac" "--modeac --modeac-separate"
+#
+# Each option set is run --runs times, interleaved with the others so that
+# they all see the same machine load. The CPU use is the "ms for
+# demodulation" figure from --stats; the output check compares --raw output.
+# (dump1090-rb exits with an error status at the end of a capture, so that
+# is not checked.)
+
+import argparse, hashlib, re, statistics, subprocess, sys
+
+parser = argparse.ArgumentParser(description='Benchmark dump1090-rb demodulation on a recorded capture')
+parser.add_argument('--dump1090', default='./dump1090-rb', help='dump1090-rb binary to run')
+parser.add_argument('--runs', type=int, default=5, help='number of timed runs of each option set')
+parser.add_argument('--format', default='UC8', help='sample format of the capture (--iformat)')
+parser.add_argument('capture', help='recorded capture to read with --device-type ifile')
+parser.add_argument('options', nargs='+', help='option sets to compare, one per argument')
+args = parser.parse_args()
+
+demod_ms = re.compile(r'^\s*(\d+) ms for demodulation$', re.M)
+
+def run(options, extra):
+    cmd = [args.dump1090, '--device-type', 'ifile', '--ifile', args.capture, '--iformat', args.format] + extra + options.split()
+    return subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL).stdout
+
+outputs = {}
+for options in args.options:
+    outputs[options] = hashlib.sha1(run(options, ['--raw'])).hexdigest()
+
+times = {options: [] for options in args.options}
+for i in range(args.runs):
+    for options in args.options:
+        match = demod_ms.search(run(options, ['--quiet', '--stats']).decode())
+        if not match:
+            sys.exit('no demodulation time in the --stats output of: ' + options)
+        times[options].append(int(match.group(1)))
+
+for options in args.options:
+    print('%-40s median %6d ms  min %6d ms  output %s' % (options or '(defaults)',
+                                                         statistics.median(times[options]), min(times[options]),
+                                                         outputs[options][:12]))
+
+if len(set(outputs.values())) > 1:
+    print('the option sets produce different output')
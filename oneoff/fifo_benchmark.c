@@ -0,0 +1,234 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// fifo_benchmark.c: stress test / benchmark for the SDR to demodulator FIFO
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// The producer thread behaves like an SDR callback: it wakes up once per
+// block period, tries fifo_acquire(0), and drops the block if no buffer is
+// free. The consumer thread behaves like the demodulator: it dequeues,
+// burns a random amount of CPU time, and releases the buffer.
+//
+// For each FIFO implementation this reports the handoff latency (from
+// fifo_enqueue to fifo_dequeue returning) and the number of dropped blocks,
+// and checks that every delivered buffer (including its overlap region)
+// holds the expected sample sequence.
+//
+// Usage: fifo_benchmark [blocks [period_us [buffer_samples]]]
+
+#include "../dump1090.h"
+
+static unsigned bench_blocks = 20000;
+static unsigned bench_period_us = 500;
+static unsigned bench_buffer_samples = 16384;
+static unsigned bench_overlap = 326;
+
+static uint64_t *latencies;   // per-block handoff latency, ns
+static unsigned latency_count;
+static unsigned dropped_blocks;
+static volatile bool producer_done;
+
+static uint64_t now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Busy-wait for roughly "ns" nanoseconds, touching the buffer like the demodulator would
+static unsigned simulate_work(struct mag_buf *buf, uint64_t ns)
+{
+    unsigned sum = 0;
+    uint64_t end = now_ns() + ns;
+    unsigned i = 0;
+    while (now_ns() < end) {
+        for (unsigned j = 0; j < 256 && i < buf->validLength; ++j, ++i)
+            sum += buf->data[i];
+        if (i >= buf->validLength)
+            i = 0;
+    }
+    return sum;
+}
+
+static void *producer_thread(void *arg)
+{
+    MODES_NOTUSED(arg);
+
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    uint16_t sample = 0;
+    bool discontinuous = false;
+
+    for (unsigned block = 0; block < bench_blocks; ++block) {
+        next.tv_nsec += bench_period_us * 1000;
+        normalize_timespec(&next);
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+
+        struct mag_buf *buf = fifo_acquire(0 /* don't wait */);
+        if (!buf) {
+            ++dropped_blocks;
+            sample += bench_buffer_samples - bench_overlap;
+            discontinuous = true;
+            continue;
+        }
+
+        // Vary the block length a little, like a short read would
+        buf->validLength = buf->totalLength - (block % 7 == 0 ? block % 1000 : 0);
+        for (unsigned i = buf->overlap; i < buf->validLength; ++i)
+            buf->data[i] = sample++;
+        buf->flags = discontinuous ? MAGBUF_DISCONTINUOUS : 0;
+        discontinuous = false;
+        buf->sampleTimestamp = block;
+        buf->sysTimestamp = now_ns();
+        fifo_enqueue(buf);
+    }
+
+    fifo_drain();
+    producer_done = true;
+    fifo_halt();
+    return NULL;
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static double percentile_us(double p)
+{
+    if (!latency_count)
+        return 0;
+    unsigned idx = (unsigned) (p / 100.0 * (latency_count - 1) + 0.5);
+    return latencies[idx] / 1000.0;
+}
+
+// Check that the buffer holds a contiguous sample sequence (with a zeroed
+// overlap if discontinuous, or if it's the first buffer)
+static bool verify_buffer(struct mag_buf *buf, bool first)
+{
+    uint16_t start = buf->data[buf->overlap];
+    bool zero_overlap = first || (buf->flags & MAGBUF_DISCONTINUOUS);
+
+    for (unsigned i = 0; i < buf->validLength; ++i) {
+        uint16_t expected = (i < buf->overlap && zero_overlap) ? 0 : (uint16_t) (start - buf->overlap + i);
+        if (buf->data[i] != expected)
+            return false;
+    }
+    return true;
+}
+
+static void run(fifo_impl_t impl, bool mirror)
+{
+    fprintf(stderr, "Benchmarking: %s%s FIFO, %u blocks of %u samples every %uus\n",
+            fifo_impl_name(impl), mirror ? " mirrored" : "", bench_blocks, bench_buffer_samples, bench_period_us);
+
+    fifo_set_impl(impl);
+    fifo_set_mirror(mirror);
+    if (!fifo_create(MODES_MAG_BUFFERS, bench_buffer_samples, bench_overlap)) {
+        fprintf(stderr, "  can't create FIFO\n");
+        return;
+    }
+
+    latency_count = 0;
+    dropped_blocks = 0;
+    producer_done = false;
+    srand(1);
+
+    struct timespec consumer_cpu = { 0, 0 };
+    struct timespec cpu_start;
+
+    pthread_t producer;
+    if (pthread_create(&producer, NULL, producer_thread, NULL)) {
+        fprintf(stderr, "  can't create producer thread\n");
+        fifo_destroy();
+        return;
+    }
+
+    unsigned checksum = 0;
+    uint64_t last_block = 0;
+    unsigned out_of_order = 0;
+    unsigned corrupt = 0;
+    for (;;) {
+        start_cpu_timing(&cpu_start);
+        struct mag_buf *buf = fifo_dequeue(100 /* milliseconds */);
+        end_cpu_timing(&cpu_start, &consumer_cpu);
+
+        if (!buf) {
+            if (producer_done)
+                break;
+            continue;
+        }
+
+        latencies[latency_count++] = now_ns() - buf->sysTimestamp;
+        if (latency_count > 1 && buf->sampleTimestamp <= last_block)
+            ++out_of_order;
+        last_block = buf->sampleTimestamp;
+        if (!verify_buffer(buf, latency_count == 1))
+            ++corrupt;
+
+        // Mostly keep up, with an occasional long stall (e.g. a burst of
+        // messages, or the demodulator thread being descheduled)
+        uint64_t work = (uint64_t) bench_period_us * 1000 * (rand() % 90) / 100;
+        if (rand() % 200 == 0)
+            work = (uint64_t) bench_period_us * 1000 * 8;
+        checksum += simulate_work(buf, work);
+
+        start_cpu_timing(&cpu_start);
+        fifo_release(buf);
+        end_cpu_timing(&cpu_start, &consumer_cpu);
+    }
+
+    pthread_join(producer, NULL);
+    if (mirror && !fifo_is_mirrored())
+        fprintf(stderr, "  (mirror-mapped ring not available)\n");
+    fifo_destroy();
+
+    qsort(latencies, latency_count, sizeof(latencies[0]), compare_u64);
+
+    fprintf(stderr, "  delivered %u, dropped %u (%.3f%%), out of order %u, corrupt %u (checksum %08x)\n",
+            latency_count, dropped_blocks, 100.0 * dropped_blocks / bench_blocks, out_of_order, corrupt, checksum);
+    fprintf(stderr, "  handoff latency (us): p50 %.1f  p90 %.1f  p99 %.1f  p99.9 %.1f  max %.1f\n",
+            percentile_us(50), percentile_us(90), percentile_us(99), percentile_us(99.9),
+            latency_count ? latencies[latency_count - 1] / 1000.0 : 0);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+        bench_blocks = atoi(argv[1]);
+    if (argc > 2)
+        bench_period_us = atoi(argv[2]);
+    if (argc > 3)
+        bench_buffer_samples = atoi(argv[3]);
+
+    if (!bench_blocks || !bench_period_us || bench_buffer_samples <= bench_overlap) {
+        fprintf(stderr, "usage: %s [blocks [period_us [buffer_samples]]]\n", argv[0]);
+        return 1;
+    }
+
+    latencies = calloc(bench_blocks, sizeof(latencies[0]));
+    if (!latencies) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    run(FIFO_IMPL_MUTEX, false);
+    run(FIFO_IMPL_LOCKFREE, false);
+    run(FIFO_IMPL_LOCKFREE, true);
+
+    free(latencies);
+    return 0;
+}
@@ -0,0 +1,296 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// iqz_tool.c: convert between raw sample files and .iqz containers
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Usage:
+//   iqz_tool pack [options] <raw input> <output.iqz>
+//     --format <UC8|SC16|SC16Q11>   sample format of the input (default UC8)
+//     --rate <samples/s>            sample rate of the input (default 2400000)
+//     --gain <dB>                   gain to record in the header
+//     --chunk <samples>             samples per chunk (default 1048576)
+//     --store                       don't compress
+//   iqz_tool unpack [--workers <n>] <input.iqz> <raw output, or - for stdout>
+//   iqz_tool info <input.iqz>
+//
+// Packing and unpacking report their throughput, so this doubles as a
+// benchmark of the container.
+
+#include "../dump1090.h"
+#include "../iqz.h"
+
+#include <inttypes.h>
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s pack [--format UC8|SC16|SC16Q11] [--rate <samples/s>] [--gain <dB>] [--chunk <samples>] [--store] <raw input> <output.iqz>\n"
+            "       %s unpack [--workers <n>] <input.iqz> <raw output|->\n"
+            "       %s info <input.iqz>\n",
+            argv0, argv0, argv0);
+}
+
+static const char *format_name(input_format_t format)
+{
+    switch (format) {
+    case INPUT_UC8: return "UC8";
+    case INPUT_SC16: return "SC16";
+    case INPUT_SC16Q11: return "SC16Q11";
+    default: return "unknown";
+    }
+}
+
+static int pack(int argc, char **argv)
+{
+    struct iqz_info info = { .format = INPUT_UC8, .sample_rate = 2400000, .gain_db = NAN };
+    unsigned chunk_samples = 1 << 20;
+    bool compress = true;
+
+    int j;
+    for (j = 2; j < argc && !strncmp(argv[j], "--", 2); ++j) {
+        bool more = (j + 1 < argc);
+        if (!strcmp(argv[j], "--format") && more) {
+            ++j;
+            if (!strcasecmp(argv[j], "uc8"))
+                info.format = INPUT_UC8;
+            else if (!strcasecmp(argv[j], "sc16"))
+                info.format = INPUT_SC16;
+            else if (!strcasecmp(argv[j], "sc16q11"))
+                info.format = INPUT_SC16Q11;
+            else {
+                fprintf(stderr, "unknown format %s\n", argv[j]);
+                return 1;
+            }
+        } else if (!strcmp(argv[j], "--rate") && more) {
+            info.sample_rate = atof(argv[++j]);
+        } else if (!strcmp(argv[j], "--gain") && more) {
+            info.gain_db = atof(argv[++j]);
+        } else if (!strcmp(argv[j], "--chunk") && more) {
+            chunk_samples = atoi(argv[++j]);
+        } else if (!strcmp(argv[j], "--store")) {
+            compress = false;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (argc - j != 2 || !chunk_samples) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    int in = open(argv[j], O_RDONLY);
+    if (in < 0) {
+        perror(argv[j]);
+        return 1;
+    }
+
+    int out = open(argv[j + 1], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (out < 0) {
+        perror(argv[j + 1]);
+        return 1;
+    }
+
+    struct stat st;
+    if (fstat(in, &st) == 0)
+        info.start_time_ms = (uint64_t) st.st_mtime * 1000;
+
+    unsigned bytes_per_sample = iqz_bytes_per_sample(info.format);
+    size_t chunk_bytes = (size_t) chunk_samples * bytes_per_sample;
+    char *buf = malloc(chunk_bytes);
+    struct iqz_writer *writer = iqz_writer_open(out, &info, chunk_samples, compress);
+    if (!buf || !writer) {
+        fprintf(stderr, "can't start the container\n");
+        return 1;
+    }
+
+    double start = now_seconds();
+    uint64_t raw_bytes = 0;
+    for (;;) {
+        size_t filled = 0;
+        while (filled < chunk_bytes) {
+            ssize_t n = read(in, buf + filled, chunk_bytes - filled);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n < 0) {
+                perror("read");
+                return 1;
+            }
+            if (n == 0)
+                break;
+            filled += n;
+        }
+
+        unsigned samples = filled / bytes_per_sample;
+        if (!samples)
+            break;
+        if (!iqz_write_chunk(writer, buf, samples)) {
+            perror("write");
+            return 1;
+        }
+        raw_bytes += (uint64_t) samples * bytes_per_sample;
+        if (filled < chunk_bytes)
+            break;
+    }
+
+    if (!iqz_writer_close(writer)) {
+        perror("write");
+        return 1;
+    }
+    double elapsed = now_seconds() - start;
+
+    if (fstat(out, &st) == 0) {
+        fprintf(stderr, "packed %" PRIu64 " bytes into %" PRIu64 " bytes (%.1f%%) in %.2f s, %.1f MB/s\n",
+                raw_bytes, (uint64_t) st.st_size, raw_bytes ? 100.0 * st.st_size / raw_bytes : 0.0,
+                elapsed, raw_bytes / elapsed / 1e6);
+    }
+
+    free(buf);
+    close(in);
+    close(out);
+    return 0;
+}
+
+static int unpack(int argc, char **argv)
+{
+    unsigned workers = 4;
+
+    int j;
+    for (j = 2; j < argc && !strncmp(argv[j], "--", 2); ++j) {
+        if (!strcmp(argv[j], "--workers") && j + 1 < argc) {
+            workers = atoi(argv[++j]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (argc - j != 2) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    int in = open(argv[j], O_RDONLY);
+    if (in < 0) {
+        perror(argv[j]);
+        return 1;
+    }
+
+    int out = STDOUT_FILENO;
+    if (strcmp(argv[j + 1], "-") && (out = open(argv[j + 1], O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0) {
+        perror(argv[j + 1]);
+        return 1;
+    }
+
+    struct iqz_info info;
+    struct iqz_reader *reader = iqz_reader_open(in, &info, workers);
+    if (!reader)
+        return 1;
+
+    const size_t bufsize = 1 << 20;
+    char *buf = malloc(bufsize);
+    if (!buf)
+        return 1;
+
+    double start = now_seconds();
+    uint64_t raw_bytes = 0;
+    ssize_t n;
+    while ((n = iqz_read(reader, buf, bufsize)) > 0) {
+        for (ssize_t done = 0; done < n; ) {
+            ssize_t w = write(out, buf + done, n - done);
+            if (w < 0 && errno == EINTR)
+                continue;
+            if (w <= 0) {
+                perror("write");
+                return 1;
+            }
+            done += w;
+        }
+        raw_bytes += n;
+    }
+    double elapsed = now_seconds() - start;
+
+    iqz_reader_close(reader);
+    free(buf);
+    close(in);
+    if (out != STDOUT_FILENO)
+        close(out);
+
+    if (n < 0)
+        return 1;
+
+    fprintf(stderr, "unpacked %" PRIu64 " bytes with %u workers in %.2f s, %.1f MB/s\n",
+            raw_bytes, workers, elapsed, raw_bytes / elapsed / 1e6);
+    return 0;
+}
+
+static int info(int argc, char **argv)
+{
+    if (argc != 3) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    int in = open(argv[2], O_RDONLY);
+    if (in < 0) {
+        perror(argv[2]);
+        return 1;
+    }
+
+    struct iqz_info info;
+    struct iqz_reader *reader = iqz_reader_open(in, &info, 0);
+    if (!reader)
+        return 1;
+
+    time_t start = info.start_time_ms / 1000;
+    char when[64] = "unknown";
+    if (info.start_time_ms)
+        strftime(when, sizeof(when), "%Y-%m-%d %H:%M:%S UTC", gmtime(&start));
+
+    printf("format:      %s\n", format_name(info.format));
+    printf("sample rate: %.0f\n", info.sample_rate);
+    if (isnan(info.gain_db))
+        printf("gain:        unknown\n");
+    else
+        printf("gain:        %.1f dB\n", info.gain_db);
+    printf("start time:  %s\n", when);
+    printf("samples:     %" PRIu64 " (%.1f seconds)\n", info.total_samples,
+           info.sample_rate > 0 ? info.total_samples / info.sample_rate : 0.0);
+
+    iqz_reader_close(reader);
+    close(in);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc >= 2 && !strcmp(argv[1], "pack"))
+        return pack(argc, argv);
+    if (argc >= 2 && !strcmp(argv[1], "unpack"))
+        return unpack(argc, argv);
+    if (argc >= 2 && !strcmp(argv[1], "info"))
+        return info(argc, argv);
+
+    usage(argv[0]);
+    return 1;
+}
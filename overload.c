@@ -0,0 +1,147 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// overload.c: demodulator overload shedding
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+#include "overload.h"
+
+//
+// When the demodulator can't keep up, the SDR thread finds no free buffer and
+// throws away a whole block of samples. That loses far more messages than
+// giving up on some optional work, so when we see the demodulator falling
+// behind we shed that work one level at a time (see overload_level_t), and
+// restore it one level at a time once things have been calm for a while.
+//
+// Measurements are made over blocks of approximately one second of samples:
+//
+//  * samples the SDR dropped because the FIFO was full
+//  * the deepest the FIFO got (buffers waiting to be demodulated)
+//  * the duty cycle: wall time spent demodulating, relative to the duration
+//    of the samples demodulated. Wall time, not CPU time, so that it also
+//    reflects demodulator worker threads and time lost to other processes.
+//
+
+#define OVERLOAD_DUTY_HIGH 0.80    // duty cycle that counts as overload if the FIFO is also backing up
+#define OVERLOAD_DUTY_MAX 0.95     // duty cycle that counts as overload regardless of the FIFO
+#define OVERLOAD_DUTY_CALM 0.60    // duty cycle must be below this to restore a level
+#define OVERLOAD_CALM_BLOCKS 30    // consecutive calm blocks needed to restore a level
+
+static uint64_t overload_block_samples;    // samples per block
+static uint64_t overload_samples;          // samples demodulated in the current block
+static uint64_t overload_busy_ns;          // wall time spent demodulating in the current block
+static uint64_t overload_dropped;          // samples dropped because the FIFO was full, in the current block
+static unsigned overload_max_queued;       // deepest FIFO seen in the current block
+static unsigned overload_calm_blocks;      // consecutive calm blocks seen
+static struct timespec overload_start;     // when demodulation of the current buffer started
+
+static void overload_end_of_block();
+
+const char *overload_level_name(overload_level_t level)
+{
+    switch (level) {
+    case OVERLOAD_NONE: return "none";
+    case OVERLOAD_NO_MODEAC: return "no Mode A/C";
+    case OVERLOAD_NO_FIX: return "no error correction";
+    case OVERLOAD_NO_COMMB: return "no Comm-B inference";
+    case OVERLOAD_SLOW_JSON: return "slow aircraft.json";
+    default: return "unknown";
+    }
+}
+
+void overload_init()
+{
+    overload_block_samples = Modes.sample_rate;
+    overload_samples = overload_busy_ns = overload_dropped = 0;
+    overload_max_queued = 0;
+    overload_calm_blocks = 0;
+    Modes.overload_level = OVERLOAD_NONE;
+}
+
+void overload_begin_buffer()
+{
+    clock_gettime(CLOCK_MONOTONIC, &overload_start);
+}
+
+void overload_end_buffer(const struct mag_buf *buf)
+{
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    overload_busy_ns += (end.tv_sec - overload_start.tv_sec) * 1000000000LL + (end.tv_nsec - overload_start.tv_nsec);
+
+    overload_samples += buf->validLength - buf->overlap;
+    overload_dropped += buf->dropped_by_cause[MAGBUF_DROP_FIFO_FULL];
+
+    // buffers that arrived while we were busy with this one
+    unsigned queued = fifo_queued();
+    if (queued > overload_max_queued)
+        overload_max_queued = queued;
+
+    if (overload_samples >= overload_block_samples)
+        overload_end_of_block();
+}
+
+static void overload_set_level(overload_level_t level, const char *why)
+{
+    overload_level_t old = Modes.overload_level;
+
+    fprintf(stderr, "overload: changing shedding level from %d (%s) to %d (%s) because: %s\n",
+            old, overload_level_name(old), level, overload_level_name(level), why);
+
+    Modes.overload_level = level;
+    ++Modes.stats_current.overload_changes;
+}
+
+static void overload_end_of_block()
+{
+    double duty = overload_busy_ns / (1e9 * overload_samples / Modes.sample_rate);
+    unsigned capacity = fifo_capacity();
+    char why[128];
+
+    bool overloaded = false;
+    if (overload_dropped > 0) {
+        snprintf(why, sizeof(why), "%.0f ms of samples dropped with the FIFO full", 1000.0 * overload_dropped / Modes.sample_rate);
+        overloaded = true;
+    } else if (duty >= OVERLOAD_DUTY_MAX) {
+        snprintf(why, sizeof(why), "demodulator duty cycle %.0f%%", duty * 100);
+        overloaded = true;
+    } else if (duty >= OVERLOAD_DUTY_HIGH && overload_max_queued * 2 >= capacity) {
+        snprintf(why, sizeof(why), "demodulator duty cycle %.0f%% with %u of %u buffers queued", duty * 100, overload_max_queued, capacity);
+        overloaded = true;
+    }
+
+    bool calm = (!overload_dropped && duty < OVERLOAD_DUTY_CALM && overload_max_queued * 4 <= capacity);
+
+    if (overloaded) {
+        overload_calm_blocks = 0;
+        if (Modes.overload_level + 1 < OVERLOAD_LEVELS)
+            overload_set_level(Modes.overload_level + 1, why);
+    } else if (calm && Modes.overload_level > OVERLOAD_NONE) {
+        if (++overload_calm_blocks >= OVERLOAD_CALM_BLOCKS) {
+            snprintf(why, sizeof(why), "demodulator keeping up for %u seconds", OVERLOAD_CALM_BLOCKS);
+            overload_calm_blocks = 0;
+            overload_set_level(Modes.overload_level - 1, why);
+        }
+    } else {
+        overload_calm_blocks = 0;
+    }
+
+    Modes.stats_current.overload_valid = true;
+    Modes.stats_current.overload_level = Modes.overload_level;
+    ++Modes.stats_current.overload_level_seconds[Modes.overload_level];
+
+    overload_samples = overload_busy_ns = overload_dropped = 0;
+    overload_max_queued = 0;
+}
@@ -0,0 +1,48 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// overload.h: demodulator overload shedding prototypes
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef OVERLOAD_H
+#define OVERLOAD_H
+
+struct mag_buf;
+
+// Shedding levels; each level also sheds everything the lower levels do
+typedef enum {
+    OVERLOAD_NONE = 0,      // normal operation
+    OVERLOAD_NO_MODEAC,     // don't demodulate Mode A/C
+    OVERLOAD_NO_FIX,        // don't correct bit errors
+    OVERLOAD_NO_COMMB,      // don't infer Comm-B message formats
+    OVERLOAD_SLOW_JSON,     // write aircraft.json less often
+    OVERLOAD_LEVELS         // number of levels, not a level itself
+} overload_level_t;
+
+// aircraft.json interval multiplier at OVERLOAD_SLOW_JSON
+#define OVERLOAD_JSON_INTERVAL_FACTOR 4
+
+// Returns a short name for a level, for logging
+const char *overload_level_name(overload_level_t level);
+
+void overload_init();
+
+// Call before demodulating each buffer
+void overload_begin_buffer();
+
+// Call after demodulating each buffer; measures how far behind the
+// demodulator is falling and changes Modes.overload_level when needed
+void overload_end_buffer(const struct mag_buf *buf);
+
+#endif
@@ -0,0 +1,265 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// resample.c: rational-ratio polyphase resampling of magnitude data
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "dump1090.h"
+
+#include <assert.h>
+
+// The resampler converts magnitude data captured at some rate above the
+// demodulator's rate down to the demodulator's rate, by a rational factor
+// L/M (L output samples for every M input samples).
+//
+// Conceptually the input is upsampled by L (zero-stuffed), lowpass
+// filtered, and decimated by M. The lowpass filter is split into L phases
+// so that only the non-zero input samples are multiplied; each "period"
+// of M input samples produces L output samples, and output phase p of a
+// period is a short dot product over the input samples near it.
+//
+// Resampling happens after magnitude conversion. The demodulator only
+// looks at the pulse envelope, so filtering the envelope is as good as
+// filtering the IQ data, and it is half the work.
+
+// Largest L or M we'll accept; this bounds the filter size
+#define RESAMPLE_MAX_FACTOR 64
+
+// Filter half-length, in units of the input sample spacing at the
+// higher of the two rates
+#define RESAMPLE_HALF_TAPS 6
+
+// Filter cutoff, as a fraction of the output Nyquist frequency. This is a
+// little above Nyquist: the envelope of a Mode S pulse has more bandwidth
+// than that anyway (native 2.4MHz magnitude data is aliased too), and
+// keeping sharper pulse edges decodes more messages.
+#define RESAMPLE_CUTOFF 1.1
+
+struct resampler {
+    unsigned L;            // output samples per period
+    unsigned M;            // input samples per period
+    unsigned taps;         // taps per phase, a multiple of 8
+    unsigned delay;        // filter delay, in input samples
+    unsigned span;         // input samples needed to produce one period
+
+    float *coeffs;         // L * taps filter coefficients
+    unsigned *offsets;     // L input offsets, one per phase
+
+    uint16_t *buf;         // buffered input (history + new samples)
+    unsigned buffered;     // number of samples in buf
+    unsigned capacity;     // size of buf
+};
+
+static unsigned gcd(unsigned a, unsigned b)
+{
+    while (b) {
+        unsigned t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// Find L and M for the given rates, or return false if the rates are
+// not a supported combination.
+static bool resample_factors(double in_rate, double out_rate, unsigned *L, unsigned *M)
+{
+    if (in_rate <= out_rate || out_rate < 1 || in_rate > 100e6)
+        return false;
+
+    unsigned in_hz = (unsigned) round(in_rate);
+    unsigned out_hz = (unsigned) round(out_rate);
+    if (in_hz != in_rate || out_hz != out_rate)
+        return false;
+
+    unsigned g = gcd(in_hz, out_hz);
+    if (in_hz / g > RESAMPLE_MAX_FACTOR)
+        return false;
+
+    *L = out_hz / g;
+    *M = in_hz / g;
+    return true;
+}
+
+bool resampler_supported(double in_rate, double out_rate)
+{
+    unsigned L, M;
+    return resample_factors(in_rate, out_rate, &L, &M);
+}
+
+static bool design_filter(struct resampler *r)
+{
+    unsigned L = r->L, M = r->M;
+
+    // Prototype lowpass at the upsampled rate (L * input rate): a
+    // Blackman-windowed sinc, centered on c
+    int c = RESAMPLE_HALF_TAPS * M;
+    int n_proto = 2 * c + 1;
+    double fc = RESAMPLE_CUTOFF * 0.5 / M;  // cycles per upsampled sample
+
+    double *proto = malloc(n_proto * sizeof(*proto));
+    if (!proto)
+        return false;
+
+    for (int n = 0; n < n_proto; ++n) {
+        double t = n - c;
+        double sinc = (t == 0 ? 1.0 : sin(2 * M_PI * fc * t) / (2 * M_PI * fc * t));
+        double window = 0.42 - 0.5 * cos(2 * M_PI * n / (n_proto - 1)) + 0.08 * cos(4 * M_PI * n / (n_proto - 1));
+        proto[n] = sinc * window;
+    }
+
+    // Output phase p of a period sits at upsampled position p*M, so it uses
+    // input samples r_min(p) .. r_max(p) relative to the start of the period
+    int r_min[RESAMPLE_MAX_FACTOR];
+    int max_taps = 0;
+    for (unsigned p = 0; p < L; ++p) {
+        int lo = (int) ceil(((double) p * M - c) / L);
+        int hi = (int) floor(((double) p * M + c) / L);
+        r_min[p] = lo;
+        if (hi - lo + 1 > max_taps)
+            max_taps = hi - lo + 1;
+    }
+
+    r->taps = (max_taps + 7) & ~7;
+    r->delay = c / L; // == -r_min[0], so all offsets are non-negative
+
+    r->coeffs = calloc(L * r->taps, sizeof(*r->coeffs));
+    r->offsets = calloc(L, sizeof(*r->offsets));
+    if (!r->coeffs || !r->offsets) {
+        free(proto);
+        return false;
+    }
+
+    r->span = 0;
+    for (unsigned p = 0; p < L; ++p) {
+        double sum = 0;
+        for (unsigned k = 0; k < r->taps; ++k) {
+            int idx = (int) (p * M) - (r_min[p] + (int) k) * (int) L + c;
+            if (idx >= 0 && idx < n_proto)
+                sum += proto[idx];
+        }
+
+        // normalize each phase to unity DC gain
+        for (unsigned k = 0; k < r->taps; ++k) {
+            int idx = (int) (p * M) - (r_min[p] + (int) k) * (int) L + c;
+            if (idx >= 0 && idx < n_proto)
+                r->coeffs[p * r->taps + k] = proto[idx] / sum;
+        }
+
+        r->offsets[p] = r_min[p] + r->delay;
+        if (r->offsets[p] + r->taps > r->span)
+            r->span = r->offsets[p] + r->taps;
+    }
+
+    free(proto);
+    return true;
+}
+
+struct resampler *init_resampler(double in_rate, double out_rate, unsigned max_input)
+{
+    struct resampler *r = calloc(1, sizeof(*r));
+    if (!r)
+        return NULL;
+
+    if (!resample_factors(in_rate, out_rate, &r->L, &r->M) || !design_filter(r)) {
+        cleanup_resampler(r);
+        return NULL;
+    }
+
+    // after each call, fewer than 'span' samples are left over
+    r->capacity = r->span + max_input;
+    if (!(r->buf = malloc(r->capacity * sizeof(*r->buf)))) {
+        cleanup_resampler(r);
+        return NULL;
+    }
+
+    resampler_reset(r);
+    return r;
+}
+
+void resampler_reset(struct resampler *r)
+{
+    // prime the history so that output sample 0 lines up with input sample 0
+    memset(r->buf, 0, r->delay * sizeof(*r->buf));
+    r->buffered = r->delay;
+}
+
+uint16_t *resampler_input(struct resampler *r)
+{
+    return r->buf + r->buffered;
+}
+
+unsigned resampler_pending(const struct resampler *r)
+{
+    return r->buffered - r->delay;
+}
+
+unsigned resampler_max_input(const struct resampler *r, unsigned out_space)
+{
+    // we produce whole periods while at least 'span' samples remain
+    unsigned periods = out_space / r->L;
+    if (!periods)
+        return 0;
+
+    unsigned limit = (periods - 1) * r->M + r->span + r->M - 1;
+    unsigned max_input = r->capacity - r->buffered;
+    if (limit < r->buffered)
+        return 0;
+    if (limit - r->buffered < max_input)
+        max_input = limit - r->buffered;
+    return max_input;
+}
+
+unsigned resample(struct resampler *r,
+                  unsigned nsamples,
+                  uint16_t *out,
+                  double *out_mean_level,
+                  double *out_mean_power)
+{
+    assert(r->buffered + nsamples <= r->capacity);
+    r->buffered += nsamples;
+
+    unsigned periods = 0;
+    if (r->buffered >= r->span)
+        periods = (r->buffered - r->span) / r->M + 1;
+
+    if (periods) {
+        starch_resample_polyphase_u16(r->buf, periods, r->M, r->coeffs, r->offsets, r->L, r->taps, out);
+
+        unsigned consumed = periods * r->M;
+        memmove(r->buf, r->buf + consumed, (r->buffered - consumed) * sizeof(*r->buf));
+        r->buffered -= consumed;
+    }
+
+    unsigned produced = periods * r->L;
+    if (out_mean_level && out_mean_power) {
+        if (produced)
+            starch_mean_power_u16(out, produced, out_mean_level, out_mean_power);
+        else
+            *out_mean_level = *out_mean_power = 0;
+    }
+
+    return produced;
+}
+
+void cleanup_resampler(struct resampler *r)
+{
+    if (!r)
+        return;
+
+    free(r->coeffs);
+    free(r->offsets);
+    free(r->buf);
+    free(r);
+}
@@ -0,0 +1,58 @@
+// Part of dump1090, a Mode S message decoder for RTLSDR devices.
+//
+// resample.h: rational-ratio polyphase resampling of magnitude data
+//
+// This file is free software: you may copy, redistribute and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation, either version 2 of the License, or (at your
+// option) any later version.
+//
+// This file is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DUMP1090_RESAMPLE_H
+#define DUMP1090_RESAMPLE_H
+
+struct resampler;
+
+// Check whether we can resample from in_rate to out_rate (both in Hz).
+bool resampler_supported(double in_rate, double out_rate);
+
+// Create a resampler that accepts up to max_input input samples per call
+// to resample(). Returns NULL if the rate pair is not supported.
+struct resampler *init_resampler(double in_rate, double out_rate, unsigned max_input);
+
+// Return the buffer that the next call to resample() reads its new input
+// samples from; the caller converts IQ data directly into this buffer.
+uint16_t *resampler_input(struct resampler *r);
+
+// Return the largest number of new input samples that can be passed to
+// resample() without producing more than out_space output samples.
+unsigned resampler_max_input(const struct resampler *r, unsigned out_space);
+
+// Number of input samples that have been accepted but not yet consumed.
+// The next output sample corresponds to the input sample this many
+// samples before the end of the input seen so far.
+unsigned resampler_pending(const struct resampler *r);
+
+// Discard all buffered input, e.g. after a gap in the input stream.
+void resampler_reset(struct resampler *r);
+
+// Resample nsamples new input samples (already written to
+// resampler_input()) into out, returning the number of output samples
+// written. If out_mean_level and out_mean_power are non-NULL, they are
+// set to the mean level and power of the output samples.
+unsigned resample(struct resampler *r,
+                  unsigned nsamples,
+                  uint16_t *out,
+                  double *out_mean_level,
+                  double *out_mean_power);
+
+void cleanup_resampler(struct resampler *r);
+
+#endif
@@ -48,6 +48,15 @@ typedef struct {
     int (*getmaxgain)();
     double (*getgaindb)(int);
     int (*setgain)(int);
+
+    // Optional support for more than one device of this type (--add-source).
+    // Source 0 is handled by the entry points above; these handle sources
+    // 1 and up, and are NULL if the type only supports a single device.
+    bool (*handleSourceOption)(unsigned, int, char**, int*);
+    bool (*openSource)(unsigned);
+    void (*runSource)(unsigned);
+    void (*stopSource)(unsigned);
+    void (*closeSource)(unsigned);
 } sdr_handler;
 
 static void noInitConfig()
@@ -115,30 +124,37 @@ static bool unsupportedOpen()
 
 static sdr_handler sdr_handlers[] = {
 #ifdef ENABLE_RTLSDR
-    { "rtlsdr", SDR_RTLSDR, rtlsdrInitConfig, rtlsdrShowHelp, rtlsdrHandleOption, rtlsdrOpen, rtlsdrRun, rtlsdrStop, rtlsdrClose, rtlsdrGetGain, rtlsdrGetMaxGain, rtlsdrGetGainDb, rtlsdrSetGain },
+    { "rtlsdr", SDR_RTLSDR, rtlsdrInitConfig, rtlsdrShowHelp, rtlsdrHandleOption, rtlsdrOpen, rtlsdrRun, rtlsdrStop, rtlsdrClose, rtlsdrGetGain, rtlsdrGetMaxGain, rtlsdrGetGainDb, rtlsdrSetGain,
+      rtlsdrHandleSourceOption, rtlsdrOpenSource, rtlsdrRunSource, rtlsdrStopSource, rtlsdrCloseSource },
 #endif
 
 #ifdef ENABLE_BLADERF
-    { "bladerf", SDR_BLADERF, bladeRFInitConfig, bladeRFShowHelp, bladeRFHandleOption, bladeRFOpen, bladeRFRun, noStop, bladeRFClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain },
+    { "bladerf", SDR_BLADERF, bladeRFInitConfig, bladeRFShowHelp, bladeRFHandleOption, bladeRFOpen, bladeRFRun, noStop, bladeRFClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain,
+      NULL, NULL, NULL, NULL, NULL },
 #endif
 
 #ifdef ENABLE_HACKRF
-    { "hackrf", SDR_HACKRF, hackRFInitConfig, hackRFShowHelp, hackRFHandleOption, hackRFOpen, hackRFRun, noStop, hackRFClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain },
+    { "hackrf", SDR_HACKRF, hackRFInitConfig, hackRFShowHelp, hackRFHandleOption, hackRFOpen, hackRFRun, noStop, hackRFClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain,
+      NULL, NULL, NULL, NULL, NULL },
 #endif
 #ifdef ENABLE_LIMESDR
-    { "limesdr", SDR_LIMESDR, limesdrInitConfig, limesdrShowHelp, limesdrHandleOption, limesdrOpen, limesdrRun, noStop, limesdrClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain },
+    { "limesdr", SDR_LIMESDR, limesdrInitConfig, limesdrShowHelp, limesdrHandleOption, limesdrOpen, limesdrRun, noStop, limesdrClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain,
+      NULL, NULL, NULL, NULL, NULL },
 #endif
 
-    { "none", SDR_NONE, noInitConfig, noShowHelp, noHandleOption, noOpen, noRun, noStop, noClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain },
-    { "ifile", SDR_IFILE, ifileInitConfig, ifileShowHelp, ifileHandleOption, ifileOpen, ifileRun, noStop, ifileClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain },
+    { "none", SDR_NONE, noInitConfig, noShowHelp, noHandleOption, noOpen, noRun, noStop, noClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain,
+      NULL, NULL, NULL, NULL, NULL },
+    { "ifile", SDR_IFILE, ifileInitConfig, ifileShowHelp, ifileHandleOption, ifileOpen, ifileRun, noStop, ifileClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain,
+      ifileHandleSourceOption, ifileOpenSource, ifileRunSource, NULL, ifileCloseSource },
 
-    { NULL, SDR_NONE, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL } /* must come last */
+    { NULL, SDR_NONE, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL } /* must come last */
 };
 
 void sdrInitConfig()
 {
     // Default SDR is the first type available in the handlers array.
     Modes.sdr_type = sdr_handlers[0].sdr_type;
+    Modes.sdr_sources = 1;
 
     for (int i = 0; sdr_handlers[i].name; ++i) {
         sdr_handlers[i].initConfig();
@@ -148,6 +164,8 @@ void sdrInitConfig()
 void sdrShowHelp()
 {
     printf("--device-type <type>     Select SDR type (default: %s)\n", sdr_handlers[0].name);
+    printf("--add-source             Read from another device of the same type; the SDR options\n");
+    printf("                         that follow configure the new device (ifile, rtlsdr only)\n");
     printf("\n");
 
     for (int i = 0; sdr_handlers[i].name; ++i) {
@@ -155,9 +173,34 @@ void sdrShowHelp()
     }
 }
 
+static sdr_handler *current_handler();
+
 bool sdrHandleOption(int argc, char **argv, int *jptr)
 {
     int j = *jptr;
+    if (!strcmp(argv[j], "--add-source")) {
+        sdr_handler *handler = current_handler();
+        if (!handler->openSource) {
+            fprintf(stderr, "--add-source is not supported for SDR type '%s'\n", handler->name);
+            return false;
+        }
+        if (Modes.sdr_sources >= MAGBUF_MAX_SOURCES) {
+            fprintf(stderr, "--add-source: at most %d sources are supported\n", MAGBUF_MAX_SOURCES);
+            return false;
+        }
+        ++Modes.sdr_sources;
+        return true;
+    }
+
+    if (Modes.sdr_sources > 1) {
+        // everything after --add-source configures the most recently added source
+        if (!strcmp(argv[j], "--device-type")) {
+            fprintf(stderr, "--device-type must come before --add-source\n");
+            return false;
+        }
+        return current_handler()->handleSourceOption(Modes.sdr_sources - 1, argc, argv, jptr);
+    }
+
     if (!strcmp(argv[j], "--device-type")) {
         if ((j+1) < argc) {
             ++j;
@@ -189,7 +232,8 @@ bool sdrHandleOption(int argc, char **argv, int *jptr)
 
 static sdr_handler *current_handler()
 {
-    static sdr_handler unsupported_handler = { "unsupported", SDR_NONE, noInitConfig, noShowHelp, noHandleOption, unsupportedOpen, noRun, noStop, noClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain };
+    static sdr_handler unsupported_handler = { "unsupported", SDR_NONE, noInitConfig, noShowHelp, noHandleOption, unsupportedOpen, noRun, noStop, noClose, noGetGain, noGetMaxGain, noGetGainDb, noSetGain,
+                                               NULL, NULL, NULL, NULL, NULL };
 
     for (int i = 0; sdr_handlers[i].name; ++i) {
         if (Modes.sdr_type == sdr_handlers[i].sdr_type) {
@@ -203,41 +247,84 @@ static sdr_handler *current_handler()
 bool sdrOpen()
 {
     pthread_mutex_init(&Modes.reader_cpu_mutex, NULL);
-    return current_handler()->open();
+    Modes.reader_cpu_accumulator.tv_sec = 0;
+    Modes.reader_cpu_accumulator.tv_nsec = 0;
+
+    sdr_handler *handler = current_handler();
+    if (!handler->open())
+        return false;
+
+    for (unsigned source = 1; source < Modes.sdr_sources; ++source) {
+        if (!handler->openSource(source)) {
+            while (--source > 0)
+                handler->closeSource(source);
+            handler->close();
+            return false;
+        }
+    }
+
+    return true;
 }
 
 void sdrRun()
 {
-    set_thread_name("dump1090-sdr");
+    sdrRunSource(0);
+}
+
+void sdrRunSource(unsigned source)
+{
+    if (source == 0) {
+        set_thread_name("dump1090-sdr");
+    } else {
+        char name[32];
+        snprintf(name, sizeof(name), "dump1090-sdr%u", source);
+        set_thread_name(name);
+    }
 
     pthread_mutex_lock(&Modes.reader_cpu_mutex);
-    Modes.reader_cpu_accumulator.tv_sec = 0;
-    Modes.reader_cpu_accumulator.tv_nsec = 0;
-    start_cpu_timing(&Modes.reader_cpu_start);
+    start_cpu_timing(&Modes.reader_cpu_start[source]);
     pthread_mutex_unlock(&Modes.reader_cpu_mutex);
 
-    current_handler()->run();
+    if (source == 0)
+        current_handler()->run();
+    else
+        current_handler()->runSource(source);
 
     pthread_mutex_lock(&Modes.reader_cpu_mutex);
-    end_cpu_timing(&Modes.reader_cpu_start, &Modes.reader_cpu_accumulator);
+    end_cpu_timing(&Modes.reader_cpu_start[source], &Modes.reader_cpu_accumulator);
     pthread_mutex_unlock(&Modes.reader_cpu_mutex);
 }
 
 void sdrStop()
 {
-    current_handler()->stop();
+    sdr_handler *handler = current_handler();
+    handler->stop();
+    for (unsigned source = 1; source < Modes.sdr_sources; ++source) {
+        if (handler->stopSource)
+            handler->stopSource(source);
+    }
 }
 
 void sdrClose()
 {
+    sdrStopGainControl();
     pthread_mutex_destroy(&Modes.reader_cpu_mutex);
-    current_handler()->close();
+
+    sdr_handler *handler = current_handler();
+    for (unsigned source = 1; source < Modes.sdr_sources; ++source)
+        handler->closeSource(source);
+    handler->close();
 }
 
 void sdrMonitor()
+{
+    sdrMonitorSource(0);
+}
+
+void sdrMonitorSource(unsigned source)
 {
     pthread_mutex_lock(&Modes.reader_cpu_mutex);
-    update_cpu_timing(&Modes.reader_cpu_start, &Modes.reader_cpu_accumulator);
+    update_cpu_timing(&Modes.reader_cpu_start[source], &Modes.reader_cpu_accumulator);
     pthread_mutex_unlock(&Modes.reader_cpu_mutex);
 }
 
@@ -270,4 +357,111 @@ int sdrSetGain(int step)
     return current_handler()->setgain(step);
 }
 
+//
+// Gain control thread. Requests go through a single-slot mailbox: a new
+// request replaces one that hasn't been started yet, as only the most recent
+// gain asked for matters. Only source 0 has gain control.
+//
+static struct {
+    bool running;
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    bool stop;
+    int request;                // requested gain step, or -1 if the mailbox is empty
+
+    atomic_uint completed;      // number of requests completed
+    unsigned tagged;            // value of 'completed' at the last buffer tagged (reader thread only)
+} gain_control = { .request = -1 };
+
+static void *gainControlEntryPoint(void *arg)
+{
+    MODES_NOTUSED(arg);
+    set_thread_name("dump1090-gain");
+
+    pthread_mutex_lock(&gain_control.mutex);
+    while (!gain_control.stop) {
+        if (gain_control.request < 0) {
+            pthread_cond_wait(&gain_control.cond, &gain_control.mutex);
+            continue;
+        }
+
+        int step = gain_control.request;
+        gain_control.request = -1;
+        pthread_mutex_unlock(&gain_control.mutex);
+
+        sdrSetGain(step);
+        atomic_fetch_add(&gain_control.completed, 1);
+
+        pthread_mutex_lock(&gain_control.mutex);
+    }
+    pthread_mutex_unlock(&gain_control.mutex);
+
+    return NULL;
+}
+
+bool sdrStartGainControl()
+{
+    if (gain_control.running)
+        return true;
+
+    pthread_mutex_init(&gain_control.mutex, NULL);
+    pthread_cond_init(&gain_control.cond, NULL);
+    gain_control.stop = false;
+    gain_control.request = -1;
+
+    if (pthread_create(&gain_control.thread, NULL, gainControlEntryPoint, NULL) != 0) {
+        fprintf(stderr, "sdr: failed to start the gain control thread, gain changes will be made synchronously\n");
+        pthread_cond_destroy(&gain_control.cond);
+        pthread_mutex_destroy(&gain_control.mutex);
+        return false;
+    }
+
+    gain_control.running = true;
+    return true;
+}
+
+void sdrStopGainControl()
+{
+    if (!gain_control.running)
+        return;
+
+    pthread_mutex_lock(&gain_control.mutex);
+    gain_control.stop = true;
+    pthread_cond_signal(&gain_control.cond);
+    pthread_mutex_unlock(&gain_control.mutex);
+
+    pthread_join(gain_control.thread, NULL);
+    pthread_cond_destroy(&gain_control.cond);
+    pthread_mutex_destroy(&gain_control.mutex);
+    gain_control.running = false;
+}
+
+void sdrRequestGain(int step)
+{
+    if (!gain_control.running) {
+        // no control thread, do it here
+        sdrSetGain(step);
+        atomic_fetch_add(&gain_control.completed, 1);
+        return;
+    }
+
+    pthread_mutex_lock(&gain_control.mutex);
+    gain_control.request = step;
+    pthread_cond_signal(&gain_control.cond);
+    pthread_mutex_unlock(&gain_control.mutex);
+}
+
+void sdrTagGainChange(struct mag_buf *buf)
+{
+    if (buf->source != 0)
+        return;
+
+    unsigned completed = atomic_load(&gain_control.completed);
+    if (completed != gain_control.tagged) {
+        gain_control.tagged = completed;
+        buf->flags |= MAGBUF_GAIN_CHANGED;
+    }
+}
+
 
@@ -31,14 +31,31 @@ void sdrRun();
 void sdrStop();
 void sdrClose();
 
+// Additional sources (--add-source): sdrOpen/sdrStop/sdrClose cover all
+// Modes.sdr_sources sources, and each source is run on its own thread.
+// sdrRun() is equivalent to sdrRunSource(0).
+void sdrRunSource(unsigned source);
+
 // Gain control
 int sdrGetGain();              // return current gain step 0..N, or -1 if gain control is not supported
 int sdrGetMaxGain();           // return maximum gain step, or -1 if gain control is not supported
 double sdrGetGainDb(int step); // return gain in dB for the given gain step, or 0.0 if gain control is not supported
 int sdrSetGain(int step);      // set gain step; return actual gain step used, or -1 if gain control is not supported
 
+// Asynchronous gain control. Changing the gain can block for tens of
+// milliseconds (an rtlsdr USB control transfer), so callers on the sample
+// path hand the change to a control thread instead of calling sdrSetGain.
+bool sdrStartGainControl();    // start the control thread
+void sdrStopGainControl();     // stop it; called by sdrClose
+void sdrRequestGain(int step); // ask for a gain change; replaces any request not yet started, never blocks
+// Called by the reader for each new buffer from 'buf->source' before it is
+// enqueued; sets MAGBUF_GAIN_CHANGED on the first buffer after each requested
+// gain change was completed (successfully or not)
+void sdrTagGainChange(struct mag_buf *buf);
+
 // Call periodically from the SDR read thread to update reader thread CPU stats:
 void sdrMonitor();
+void sdrMonitorSource(unsigned source);
 // Retrieve CPU stats and add new CPU time to *addTo
 void sdrUpdateCPUTime(struct timespec *addTo);
 
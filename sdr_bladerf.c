@@ -178,6 +178,12 @@ bool bladeRFOpen()
 
     int status;
 
+    // bladeRF does its own decimation (--bladerf-decimation) instead
+    if (Modes.capture_rate != Modes.sample_rate) {
+        fprintf(stderr, "bladeRF: --capture-rate is not supported, use --bladerf-decimation\n");
+        return false;
+    }
+
     bladerf_set_usb_reset_on_open(true);
     if ((status = bladerf_open(&BladeRF.device, Modes.dev_name)) < 0) {
         fprintf(stderr, "Failed to open bladeRF: %s\n", bladerf_strerror(status));
@@ -311,7 +317,8 @@ static void *handle_bladerf_samples(struct bladerf *dev,
 {
     static uint64_t nextTimestamp = 0;  // what's the next timestamp we expect to see?
     static bool overrun = false;        // do we have a pending overrun to report?
-    static bool dropped = 0;            // do we have some dropped samples to report?
+    static unsigned dropped[MAGBUF_DROP_CAUSES]; // dropped samples to report, by cause
+    static bool fifo_full = false;      // did we drop data because the FIFO was full?
     static bool first_buffer = true;    // is this the very first callback?
 
     MODES_NOTUSED(dev);
@@ -358,9 +365,7 @@ static void *handle_bladerf_samples(struct bladerf *dev,
             // dropped data or lost sync
             overrun = true;
             if (metadata_timestamp > nextTimestamp)
-                dropped = (metadata_timestamp - nextTimestamp);
-            else
-                dropped = 0;
+                dropped[fifo_full ? MAGBUF_DROP_FIFO_FULL : MAGBUF_DROP_DEVICE] += (metadata_timestamp - nextTimestamp) / BladeRF.decimation;
         }
 
         if (outbuf && (overrun || (outbuf->validLength + samples_per_block > outbuf->totalLength))) {
@@ -375,6 +380,7 @@ static void *handle_bladerf_samples(struct bladerf *dev,
             if (!outbuf) {
                 // we have nowhere to put this data, drop it. nb: don't update nextTimestamp
                 overrun = true;
+                fifo_full = true;
                 continue;
             }
 
@@ -383,7 +389,7 @@ static void *handle_bladerf_samples(struct bladerf *dev,
             if (overrun) {
                 outbuf->flags |= MAGBUF_DISCONTINUOUS;
             }
-            outbuf->dropped = dropped;
+            fifo_add_dropped(outbuf, dropped);
             outbuf->validLength = outbuf->overlap;
             outbuf->sampleTimestamp = metadata_timestamp * 12e6 / Modes.sample_rate / BladeRF.decimation;
             outbuf->sysTimestamp = entryTimestamp + (num_samples - offset / 4) * 1000 / Modes.sample_rate / BladeRF.decimation;
@@ -391,7 +397,7 @@ static void *handle_bladerf_samples(struct bladerf *dev,
             outbuf->mean_power = 0;
 
             overrun = false;
-            dropped = 0;
+            fifo_full = false;
         }
 
         // Convert one block of sample data
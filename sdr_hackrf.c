@@ -35,6 +35,7 @@ static struct {
 
     iq_convert_fn converter;
     struct converter_state *converter_state;
+    struct resampler *resampler;  // non-NULL if capturing at a different rate to Modes.sample_rate
 } HackRF;
 
 void hackRFInitConfig()
@@ -45,10 +46,11 @@ void hackRFInitConfig()
     HackRF.enable_ant_pwr = 0;
     HackRF.lna_gain = 32;
     HackRF.vga_gain = 50;
-    HackRF.rate = 2400000;
+    HackRF.rate = 0; // default: --capture-rate
     HackRF.ppm = 0;
     HackRF.converter = NULL;
     HackRF.converter_state = NULL;
+    HackRF.resampler = NULL;
 }
 
 bool hackRFHandleOption(int argc, char **argv, int *jptr)
@@ -126,6 +128,9 @@ bool hackRFOpen()
         return true;
     }
 
+    if (!HackRF.rate)
+        HackRF.rate = Modes.capture_rate;
+
     // Calculate sample rate and frequency deviation if ppm is specified
     if (HackRF.ppm != 0) {
         HackRF.rate = (uint32_t)((double)HackRF.rate * (1000000 - HackRF.ppm)/1000000+0.5);
@@ -199,7 +204,7 @@ bool hackRFOpen()
     show_config();
 
     HackRF.converter = init_converter(INPUT_UC8,
-                                      Modes.sample_rate,
+                                      Modes.capture_rate,
                                       Modes.dc_filter,
                                       &HackRF.converter_state);
     if (!HackRF.converter) {
@@ -207,12 +212,19 @@ bool hackRFOpen()
         return false;
     }
 
+    if (Modes.capture_rate != Modes.sample_rate) {
+        if (!(HackRF.resampler = init_resampler(Modes.capture_rate, Modes.sample_rate, MODES_MAG_BUF_SAMPLES))) {
+            fprintf(stderr, "HackRF: can't initialize resampler\n");
+            return false;
+        }
+    }
+
     return true;
 }
 
 static int handle_hackrf_samples(hackrf_transfer *transfer)
 {
-    static unsigned dropped = 0;
+    static unsigned dropped[MAGBUF_DROP_CAUSES];
     static uint64_t sampleCounter = 0;
 
     sdrMonitor();
@@ -233,39 +245,48 @@ static int handle_hackrf_samples(hackrf_transfer *transfer)
     struct mag_buf *outbuf = fifo_acquire(0 /* don't wait */);
     if (!outbuf) {
         // FIFO is full. Drop this block.
-        dropped += samples_read;
+        dropped[MAGBUF_DROP_FIFO_FULL] += samples_read;
         sampleCounter += samples_read;
+        if (HackRF.resampler)
+            resampler_reset(HackRF.resampler);
         return 0;
     }
 
     outbuf->flags = 0;
 
-    if (dropped) {
-        // We previously dropped some samples due to no buffers being available
-        outbuf->flags |= MAGBUF_DISCONTINUOUS;
-        outbuf->dropped = dropped;
-    }
-
-    dropped = 0;
+    // Report any samples we previously dropped
+    fifo_add_dropped(outbuf, dropped);
 
     // Compute the sample timestamp and system timestamp for the start of the block
-    outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
+    // (when resampling, the block starts with the input samples still held by the resampler)
+    unsigned pending = (HackRF.resampler ? resampler_pending(HackRF.resampler) : 0);
+    outbuf->sampleTimestamp = (sampleCounter - pending) * 12e6 / Modes.capture_rate;
     sampleCounter += samples_read;
 
     // Get the approx system time for the start of this block
-    uint64_t block_duration = 1e3 * samples_read / Modes.sample_rate;
+    uint64_t block_duration = 1e3 * (samples_read + pending) / Modes.capture_rate;
     outbuf->sysTimestamp = mstime() - block_duration;
 
     // Convert the new data
     unsigned to_convert = samples_read;
-    if (to_convert + outbuf->overlap > outbuf->totalLength) {
+    unsigned max_convert = outbuf->totalLength - outbuf->overlap;
+    if (HackRF.resampler)
+        max_convert = resampler_max_input(HackRF.resampler, max_convert);
+    if (to_convert > max_convert) {
         // how did that happen?
-        to_convert = outbuf->totalLength - outbuf->overlap;
-        dropped = samples_read - to_convert;
+        to_convert = max_convert;
+        dropped[MAGBUF_DROP_OVERSIZE] += samples_read - to_convert;
     }
 
-    HackRF.converter(buf, &outbuf->data[outbuf->overlap], to_convert, HackRF.converter_state, &outbuf->mean_level, &outbuf->mean_power);
-    outbuf->validLength = outbuf->overlap + to_convert;
+    if (HackRF.resampler) {
+        HackRF.converter(buf, resampler_input(HackRF.resampler), to_convert, HackRF.converter_state, NULL, NULL);
+        outbuf->validLength = outbuf->overlap + resample(HackRF.resampler, to_convert, &outbuf->data[outbuf->overlap], &outbuf->mean_level, &outbuf->mean_power);
+        if (to_convert < samples_read)
+            resampler_reset(HackRF.resampler);
+    } else {
+        HackRF.converter(buf, &outbuf->data[outbuf->overlap], to_convert, HackRF.converter_state, &outbuf->mean_level, &outbuf->mean_power);
+        outbuf->validLength = outbuf->overlap + to_convert;
+    }
 
     // Push to the demodulation thread
     fifo_enqueue(outbuf);
@@ -307,4 +328,7 @@ void hackRFClose()
         hackrf_exit();
         HackRF.device = NULL;
     }
+
+    cleanup_resampler(HackRF.resampler);
+    HackRF.resampler = NULL;
 }
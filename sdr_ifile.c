@@ -50,11 +50,40 @@
 
 #include "dump1090.h"
 #include "sdr_ifile.h"
-
-static struct {
+#include "iqz.h"
+
+#include <sys/mman.h>
+
+// Maximum number of sample conversion threads
+#define IFILE_MAX_WORKERS 8
+
+// A buffer being converted by a worker thread. Jobs are handed out and
+// completed in order, so that buffers reach the FIFO in file order.
+struct ifile_job {
+    struct mag_buf *buf;
+    void *map;                      // mapping holding the input samples
+    size_t map_length;
+    char *input;                    // start of the input samples within the mapping
+    unsigned samples;               // number of samples to convert
+    bool done;
+};
+
+struct ifile_source;
+
+struct ifile_worker {
+    struct ifile_source *ifile;
+    struct converter_state *state;  // each worker needs its own converter state
+    pthread_t thread;
+};
+
+// State for one input file; there is one of these per --add-source
+struct ifile_source {
+    unsigned source;                // index of this source, and of its FIFO
     const char *filename;
     input_format_t input_format;
-    bool throttle;
+    double speed;                   // replay speed relative to the capture, 0 = as fast as possible
+    int workers;                    // number of conversion threads, 0 = automatic
+    double start;                   // seconds of samples to skip at the start of the file
 
     int fd;
     unsigned bytes_per_sample;
@@ -62,19 +91,60 @@ static struct {
     char *readbuf;
     iq_convert_fn converter;
     struct converter_state *converter_state;
-} ifile;
+    struct resampler *resampler;    // non-NULL if the capture rate differs from Modes.sample_rate
+
+    struct iqz_reader *container;   // non-NULL if reading an .iqz container
+    uint64_t start_sample;          // first input sample to process
+
+    bool mapped;                    // reading via mmap rather than read()
+    uint64_t file_size;             // size of the input file, if mapped
+    long page_size;
+
+    // for the final report
+    uint64_t samples_read;
+    struct timespec run_start;
+    struct timespec run_end;
+
+    // conversion threads, if used
+    struct {
+        unsigned count;
+        struct ifile_worker workers[IFILE_MAX_WORKERS];
+
+        pthread_mutex_t mutex;          // protects everything below
+        pthread_cond_t job_cond;        // signalled when a job is posted
+        pthread_cond_t done_cond;       // signalled when a job is completed
+        struct ifile_job jobs[IFILE_MAX_WORKERS];
+        unsigned posted;                // number of jobs posted so far
+        unsigned taken;                 // number of jobs taken by workers so far
+        bool stop;
+    } pool;
+};
+
+static struct ifile_source ifile_sources[MAGBUF_MAX_SOURCES];
 
 void ifileInitConfig(void)
 {
-    ifile.filename = NULL;
-    ifile.input_format = INPUT_UC8;
-    ifile.throttle = false;
-    ifile.fd = -1;
-    ifile.bytes_per_sample = 0;
-    ifile.bufsize = 0;
-    ifile.readbuf = NULL;
-    ifile.converter = NULL;
-    ifile.converter_state = NULL;
+    for (unsigned source = 0; source < MAGBUF_MAX_SOURCES; ++source) {
+        struct ifile_source *ifile = &ifile_sources[source];
+        ifile->source = source;
+        ifile->filename = NULL;
+        ifile->input_format = INPUT_UC8;
+        ifile->speed = 0;
+        ifile->workers = 0;
+        ifile->start = 0;
+        ifile->fd = -1;
+        ifile->bytes_per_sample = 0;
+        ifile->bufsize = 0;
+        ifile->readbuf = NULL;
+        ifile->converter = NULL;
+        ifile->converter_state = NULL;
+        ifile->resampler = NULL;
+        ifile->container = NULL;
+        ifile->start_sample = 0;
+        ifile->mapped = false;
+        ifile->file_size = 0;
+        ifile->samples_read = 0;
+    }
 }
 
 void ifileShowHelp()
@@ -82,35 +152,57 @@ void ifileShowHelp()
     printf("      ifile-specific options (use with --ifile)\n");
     printf("\n");
     printf("--ifile <path>           read samples from given file ('-' for stdin)\n");
-    printf("--iformat <type>         set sample format (UC8, SC16, SC16Q11)\n");
+    printf("--iformat <type>         set sample format (UC8, SC16, SC16Q11); ignored for .iqz containers\n");
     printf("--throttle               process samples at the original capture speed\n");
+    printf("--speed <x>              process samples at <x> times the original capture speed\n");
+    printf("--ifile-workers <n>      use <n> threads for sample conversion and decompression (default: automatic)\n");
+    printf("--ifile-start <seconds>  start processing <seconds> into the file\n");
+    printf("                         (after --add-source, these options configure the added file)\n");
     printf("\n");
 }
 
 bool ifileHandleOption(int argc, char **argv, int *jptr)
 {
+    return ifileHandleSourceOption(0, argc, argv, jptr);
+}
+
+bool ifileHandleSourceOption(unsigned source, int argc, char **argv, int *jptr)
+{
+    struct ifile_source *ifile = &ifile_sources[source];
     int j = *jptr;
     bool more = (j +1  < argc);
 
     if (!strcmp(argv[j], "--ifile") && more) {
         // implies --device-type ifile
-        ifile.filename = strdup(argv[++j]);
+        ifile->filename = strdup(argv[++j]);
         Modes.sdr_type = SDR_IFILE;
     } else if (!strcmp(argv[j],"--iformat") && more) {
         ++j;
         if (!strcasecmp(argv[j], "uc8")) {
-            ifile.input_format = INPUT_UC8;
+            ifile->input_format = INPUT_UC8;
         } else if (!strcasecmp(argv[j], "sc16")) {
-            ifile.input_format = INPUT_SC16;
+            ifile->input_format = INPUT_SC16;
         } else if (!strcasecmp(argv[j], "sc16q11")) {
-            ifile.input_format = INPUT_SC16Q11;
+            ifile->input_format = INPUT_SC16Q11;
         } else {
             fprintf(stderr, "Input format '%s' not understood (supported values: UC8, SC16, SC16Q11)\n",
                     argv[j]);
             return false;
         }
     } else if (!strcmp(argv[j],"--throttle")) {
-        ifile.throttle = true;
+        ifile->speed = 1.0;
+    } else if (!strcmp(argv[j],"--speed") && more) {
+        ifile->speed = atof(argv[++j]);
+        if (ifile->speed < 0)
+            ifile->speed = 0;
+    } else if (!strcmp(argv[j],"--ifile-workers") && more) {
+        ifile->workers = atoi(argv[++j]);
+        if (ifile->workers > IFILE_MAX_WORKERS)
+            ifile->workers = IFILE_MAX_WORKERS;
+    } else if (!strcmp(argv[j],"--ifile-start") && more) {
+        ifile->start = atof(argv[++j]);
+        if (ifile->start < 0)
+            ifile->start = 0;
     } else {
         return false;
     }
@@ -119,6 +211,104 @@ bool ifileHandleOption(int argc, char **argv, int *jptr)
     return true;
 }
 
+// The converter for this file's samples, 8-bit if --demod-u8
+static iq_convert_fn ifileInitConverter(struct ifile_source *ifile, struct converter_state **state)
+{
+    if (Modes.demod_u8)
+        return init_converter_u8(ifile->input_format, state);
+    return init_converter(ifile->input_format, Modes.capture_rate, Modes.dc_filter, state);
+}
+
+static void *ifileWorkerEntryPoint(void *arg)
+{
+    struct ifile_worker *worker = arg;
+    struct ifile_source *ifile = worker->ifile;
+
+    pthread_mutex_lock(&ifile->pool.mutex);
+    for (;;) {
+        while (!ifile->pool.stop && ifile->pool.taken == ifile->pool.posted)
+            pthread_cond_wait(&ifile->pool.job_cond, &ifile->pool.mutex);
+        if (ifile->pool.stop)
+            break;
+
+        struct ifile_job *job = &ifile->pool.jobs[ifile->pool.taken++ % IFILE_MAX_WORKERS];
+        pthread_mutex_unlock(&ifile->pool.mutex);
+
+        struct mag_buf *buf = job->buf;
+        ifile->converter(job->input, mag_buf_sample(buf, buf->overlap), job->samples, worker->state, &buf->mean_level, &buf->mean_power);
+        buf->validLength = buf->overlap + job->samples;
+
+        pthread_mutex_lock(&ifile->pool.mutex);
+        job->done = true;
+        pthread_cond_broadcast(&ifile->pool.done_cond);
+    }
+    pthread_mutex_unlock(&ifile->pool.mutex);
+
+    return NULL;
+}
+
+static void ifileStopWorkers(struct ifile_source *ifile)
+{
+    pthread_mutex_lock(&ifile->pool.mutex);
+    ifile->pool.stop = true;
+    pthread_cond_broadcast(&ifile->pool.job_cond);
+    pthread_mutex_unlock(&ifile->pool.mutex);
+
+    for (unsigned i = 0; i < ifile->pool.count; ++i) {
+        pthread_join(ifile->pool.workers[i].thread, NULL);
+        cleanup_converter(ifile->pool.workers[i].state);
+    }
+
+    ifile->pool.count = 0;
+    pthread_cond_destroy(&ifile->pool.done_cond);
+    pthread_cond_destroy(&ifile->pool.job_cond);
+    pthread_mutex_destroy(&ifile->pool.mutex);
+}
+
+static bool ifileStartWorkers(struct ifile_source *ifile, unsigned count)
+{
+    pthread_mutex_init(&ifile->pool.mutex, NULL);
+    pthread_cond_init(&ifile->pool.job_cond, NULL);
+    pthread_cond_init(&ifile->pool.done_cond, NULL);
+    ifile->pool.stop = false;
+    ifile->pool.count = 0;
+
+    for (unsigned i = 0; i < count; ++i) {
+        struct ifile_worker *worker = &ifile->pool.workers[i];
+        worker->ifile = ifile;
+
+        // each worker needs its own converter state
+        if (!ifileInitConverter(ifile, &worker->state)) {
+            ifileStopWorkers(ifile);
+            return false;
+        }
+
+        if (pthread_create(&worker->thread, NULL, ifileWorkerEntryPoint, worker) != 0) {
+            cleanup_converter(worker->state);
+            ifileStopWorkers(ifile);
+            return false;
+        }
+
+        ++ifile->pool.count;
+    }
+
+    return true;
+}
+
+// Number of helper threads to use when --ifile-workers isn't given
+static unsigned ifileWorkerCount(struct ifile_source *ifile)
+{
+    if (ifile->workers > 0)
+        return ifile->workers;
+
+    // leave a core for the demodulator
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned workers = (cpus > 2 ? cpus - 1 : 1);
+    if (workers > 4)
+        workers = 4;
+    return workers;
+}
+
 //
 //=========================================================================
 //
@@ -127,86 +317,216 @@ bool ifileHandleOption(int argc, char **argv, int *jptr)
 //
 bool ifileOpen(void)
 {
-    if (!ifile.filename) {
+    return ifileOpenSource(0);
+}
+
+bool ifileOpenSource(unsigned source)
+{
+    struct ifile_source *ifile = &ifile_sources[source];
+
+    if (!ifile->filename) {
         fprintf(stderr, "SDR type 'ifile' requires an --ifile argument\n");
         return false;
     }
 
-    if (!strcmp(ifile.filename, "-")) {
-        ifile.fd = STDIN_FILENO;
-    } else if ((ifile.fd = open(ifile.filename, O_RDONLY)) < 0) {
+    if (!strcmp(ifile->filename, "-")) {
+        ifile->fd = STDIN_FILENO;
+    } else if ((ifile->fd = open(ifile->filename, O_RDONLY)) < 0) {
         fprintf(stderr, "ifile: could not open %s: %s\n",
-                ifile.filename, strerror(errno));
+                ifile->filename, strerror(errno));
         return false;
     }
 
-    switch (ifile.input_format) {
+    // .iqz containers describe their own samples
+    struct stat st;
+    bool regular = (ifile->fd != STDIN_FILENO && fstat(ifile->fd, &st) == 0 && S_ISREG(st.st_mode));
+    if (regular && iqz_detect(ifile->fd)) {
+        struct iqz_info info;
+        if (!(ifile->container = iqz_reader_open(ifile->fd, &info, ifileWorkerCount(ifile)))) {
+            fprintf(stderr, "ifile: could not read container %s\n", ifile->filename);
+            ifileCloseSource(ifile->source);
+            return false;
+        }
+
+        ifile->input_format = info.format;
+        if (fabs(info.sample_rate - Modes.capture_rate) >= 1) {
+            fprintf(stderr, "ifile: %s was captured at %.3f MS/s, but is being processed as %.3f MS/s (see --capture-rate)\n",
+                    ifile->filename, info.sample_rate / 1e6, Modes.capture_rate / 1e6);
+        }
+    }
+
+    switch (ifile->input_format) {
     case INPUT_UC8:
-        ifile.bytes_per_sample = 2;
+        ifile->bytes_per_sample = 2;
         break;
     case INPUT_SC16:
     case INPUT_SC16Q11:
-        ifile.bytes_per_sample = 4;
+        ifile->bytes_per_sample = 4;
         break;
     default:
         fprintf(stderr, "ifile: unhandled input format\n");
-        ifileClose();
+        ifileCloseSource(ifile->source);
         return false;
     }
 
-    ifile.bufsize = ifile.bytes_per_sample * MODES_MAG_BUF_SAMPLES; /* ~1M samples, about half a second's worth */
+    ifile->bufsize = ifile->bytes_per_sample * MODES_MAG_BUF_SAMPLES; /* ~1M samples, about half a second's worth */
+
+    if (Modes.interactive && ifile->speed == 0)
+        ifile->speed = 1.0;
 
-    if (!(ifile.readbuf = malloc(ifile.bufsize))) {
+    // Regular files are mapped a buffer at a time rather than read(), which
+    // avoids a copy and lets several threads convert buffers concurrently
+    if (regular && !ifile->container) {
+        ifile->mapped = true;
+        ifile->file_size = st.st_size;
+        ifile->page_size = sysconf(_SC_PAGESIZE);
+        posix_fadvise(ifile->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+
+    ifile->start_sample = ifile->start * Modes.capture_rate;
+    if (ifile->start_sample) {
+        bool past_end;
+        if (ifile->container)
+            past_end = !iqz_seek(ifile->container, ifile->start_sample);
+        else if (ifile->mapped)
+            past_end = (ifile->start_sample * ifile->bytes_per_sample >= ifile->file_size);
+        else
+            past_end = false; // can't tell until we get there
+        if (past_end) {
+            fprintf(stderr, "ifile: --ifile-start %.1f is past the end of %s\n", ifile->start, ifile->filename);
+            ifileCloseSource(ifile->source);
+            return false;
+        }
+    }
+
+    if (!ifile->mapped && !(ifile->readbuf = malloc(ifile->bufsize))) {
         fprintf(stderr, "ifile: failed to allocate read buffer\n");
-        ifileClose();
+        ifileCloseSource(ifile->source);
         return false;
     }
 
-    ifile.converter = init_converter(ifile.input_format,
-                                     Modes.sample_rate,
-                                     Modes.dc_filter,
-                                     &ifile.converter_state);
-    if (!ifile.converter) {
+    ifile->converter = ifileInitConverter(ifile, &ifile->converter_state);
+    if (!ifile->converter) {
         fprintf(stderr, "ifile: can't initialize sample converter\n");
-        ifileClose();
+        ifileCloseSource(ifile->source);
         return false;
     }
 
+    if (Modes.capture_rate != Modes.sample_rate) {
+        if (!(ifile->resampler = init_resampler(Modes.capture_rate, Modes.sample_rate, MODES_MAG_BUF_SAMPLES))) {
+            fprintf(stderr, "ifile: can't initialize resampler\n");
+            ifileCloseSource(ifile->source);
+            return false;
+        }
+    }
+
     return true;
 }
 
-void ifileRun()
+// Number of input samples to put in a buffer with 'space' free samples
+static unsigned ifileBufferSamples(struct ifile_source *ifile, unsigned space)
 {
-    if (ifile.fd < 0)
-        return;
+    if (space > MODES_MAG_BUF_SAMPLES)
+        space = MODES_MAG_BUF_SAMPLES;
+    if (ifile->resampler)
+        space = resampler_max_input(ifile->resampler, space);
+    return space;
+}
 
-    struct timespec next_buffer_delivery;
-    clock_gettime(CLOCK_MONOTONIC, &next_buffer_delivery);
+// Timestamp of the first new sample in a buffer, given the number of
+// input samples seen so far
+static uint64_t ifileSampleTimestamp(struct ifile_source *ifile, uint64_t input_samples)
+{
+    // when resampling, the buffer starts with the input samples still held by the resampler
+    if (ifile->resampler)
+        input_samples -= resampler_pending(ifile->resampler);
+    return input_samples * 12e6 / Modes.capture_rate;
+}
 
+// Convert 'samples' input samples into 'outbuf' on the reader thread
+static void ifileConvert(struct ifile_source *ifile, void *input, unsigned samples, struct mag_buf *outbuf)
+{
+    if (ifile->resampler) {
+        ifile->converter(input, resampler_input(ifile->resampler), samples, ifile->converter_state, NULL, NULL);
+        outbuf->validLength = outbuf->overlap + resample(ifile->resampler, samples, &outbuf->data[outbuf->overlap], &outbuf->mean_level, &outbuf->mean_power);
+    } else {
+        ifile->converter(input, mag_buf_sample(outbuf, outbuf->overlap), samples, ifile->converter_state, &outbuf->mean_level, &outbuf->mean_power);
+        outbuf->validLength = outbuf->overlap + samples;
+    }
+}
+
+// Deliver a converted buffer to the FIFO, pacing it if needed
+static void ifileDeliver(struct ifile_source *ifile, struct mag_buf *outbuf, unsigned samples, struct timespec *next_buffer_delivery)
+{
+    if (ifile->speed > 0) {
+        // Wait until we are allowed to release this buffer to the FIFO
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, next_buffer_delivery, NULL) == EINTR)
+            ;
+
+        // compute the time we can deliver the next buffer. At low speeds
+        // the delay can be many seconds, more than fits in a 32-bit tv_nsec,
+        // so add the whole seconds separately
+        double delay = samples / Modes.capture_rate / ifile->speed;
+        time_t delay_sec = (time_t) delay;
+        next_buffer_delivery->tv_sec += delay_sec;
+        next_buffer_delivery->tv_nsec += (long) ((delay - delay_sec) * 1e9);
+        normalize_timespec(next_buffer_delivery);
+    }
+
+    // Push the new data to the FIFO
+    fifo_enqueue(outbuf);
+    ifile->samples_read += samples;
+}
+
+// Read up to 'bytes' bytes of samples, from the container if there is one
+static ssize_t ifileReadInput(struct ifile_source *ifile, void *buf, size_t bytes)
+{
+    if (ifile->container)
+        return iqz_read(ifile->container, buf, bytes);
+    return read(ifile->fd, buf, bytes);
+}
+
+// Read the input with read(); used for stdin and other non-mappable input,
+// and for containers
+static void ifileRunRead(struct ifile_source *ifile, struct timespec *next_buffer_delivery)
+{
     bool eof = false;
-    uint64_t sampleCounter = 0;
+
+    // skip to --ifile-start; containers have already seeked there
+    if (!ifile->container) {
+        uint64_t skip = ifile->start_sample * ifile->bytes_per_sample;
+        while (skip > 0 && !Modes.exit) {
+            ssize_t nread = read(ifile->fd, ifile->readbuf, skip < ifile->bufsize ? skip : ifile->bufsize);
+            if (nread <= 0) {
+                if (nread < 0)
+                    fprintf(stderr, "ifile: error reading input file: %s\n", strerror(errno));
+                else
+                    fprintf(stderr, "ifile: --ifile-start %.1f is past the end of %s\n", ifile->start, ifile->filename);
+                return;
+            }
+            skip -= nread;
+        }
+    }
 
     while (!Modes.exit && !eof) {
-        sdrMonitor();
+        sdrMonitorSource(ifile->source);
 
         /* wait for up to 1000ms for a buffer */
-        struct mag_buf *outbuf = fifo_acquire(100 /* milliseconds */);
+        struct mag_buf *outbuf = fifo_acquire_source(ifile->source, 100 /* milliseconds */);
         if (!outbuf) {
             // maybe we're slow, maybe we halted
             continue;
         }
 
         // Compute the sample timestamp and system time for the start of the block
-        outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
+        outbuf->sampleTimestamp = ifileSampleTimestamp(ifile, ifile->start_sample + ifile->samples_read);
         outbuf->sysTimestamp = mstime();
 
-        unsigned bytes_wanted = (outbuf->totalLength - outbuf->overlap) * ifile.bytes_per_sample;
-        if (bytes_wanted > ifile.bufsize)
-            bytes_wanted = ifile.bufsize;
+        unsigned bytes_wanted = ifileBufferSamples(ifile, outbuf->totalLength - outbuf->overlap) * ifile->bytes_per_sample;
 
         unsigned bytes_read = 0;
         while (bytes_read < bytes_wanted) {
-            ssize_t nread = read(ifile.fd, ifile.readbuf + bytes_read, bytes_wanted - bytes_read);
+            ssize_t nread = ifileReadInput(ifile, ifile->readbuf + bytes_read, bytes_wanted - bytes_read);
             if (nread <= 0) {
                 if (nread < 0) {
                     fprintf(stderr, "ifile: error reading input file: %s\n", strerror(errno));
@@ -218,47 +538,235 @@ void ifileRun()
             bytes_read += nread;
         }
 
-        unsigned samples_read = bytes_read / ifile.bytes_per_sample;
+        unsigned samples_read = bytes_read / ifile->bytes_per_sample;
+        iqcapture_tap(ifile->source, ifile->input_format, ifile->readbuf, samples_read * ifile->bytes_per_sample);
 
         // Convert the new data
-        ifile.converter(ifile.readbuf, &outbuf->data[outbuf->overlap], samples_read, ifile.converter_state, &outbuf->mean_level, &outbuf->mean_power);
-        outbuf->validLength = outbuf->overlap + samples_read;
+        ifileConvert(ifile, ifile->readbuf, samples_read, outbuf);
         outbuf->flags = 0;
 
-        if (ifile.throttle || Modes.interactive) {
-            // Wait until we are allowed to release this buffer to the FIFO
-            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_buffer_delivery, NULL) == EINTR)
-                ;
+        ifileDeliver(ifile, outbuf, samples_read, next_buffer_delivery);
+    }
+}
+
+// Map the next chunk of the input file for 'outbuf'; returns false on error
+static bool ifileMapNext(struct ifile_source *ifile, uint64_t *offset, struct mag_buf *outbuf, struct ifile_job *job)
+{
+    uint64_t remaining = (ifile->file_size - *offset) / ifile->bytes_per_sample;
+    unsigned samples = ifileBufferSamples(ifile, outbuf->totalLength - outbuf->overlap);
+    if (samples > remaining)
+        samples = remaining;
+
+    // mmap offsets must be page-aligned
+    uint64_t map_offset = *offset - *offset % ifile->page_size;
+    size_t map_length = *offset - map_offset + (size_t) samples * ifile->bytes_per_sample;
+    void *map = mmap(NULL, map_length, PROT_READ, MAP_PRIVATE, ifile->fd, map_offset);
+    if (map == MAP_FAILED) {
+        fprintf(stderr, "ifile: error mapping input file: %s\n", strerror(errno));
+        return false;
+    }
+    madvise(map, map_length, MADV_SEQUENTIAL | MADV_WILLNEED);
+
+    job->buf = outbuf;
+    job->map = map;
+    job->map_length = map_length;
+    job->input = (char *) map + (*offset - map_offset);
+    job->samples = samples;
+    job->done = false;
+
+    *offset += (uint64_t) samples * ifile->bytes_per_sample;
+    return true;
+}
+
+// Read the input via mmap, converting up to 'workers' buffers concurrently
+static void ifileRunMapped(struct ifile_source *ifile, unsigned workers, struct timespec *next_buffer_delivery)
+{
+    uint64_t offset = ifile->start_sample * ifile->bytes_per_sample;
+    unsigned completed = 0;
+    bool eof = false;
+    struct mag_buf *failed = NULL;
 
-            // compute the time we can deliver the next buffer.
-            next_buffer_delivery.tv_nsec += samples_read * 1e9 / Modes.sample_rate;
-            normalize_timespec(&next_buffer_delivery);
+    ifile->pool.posted = ifile->pool.taken = 0;
+
+    if (workers > 1 && !ifileStartWorkers(ifile, workers)) {
+        fprintf(stderr, "ifile: failed to start conversion threads, converting on the reader thread\n");
+        workers = 1;
+    }
+
+    while (!Modes.exit) {
+        sdrMonitorSource(ifile->source);
+
+        // keep every worker busy
+        while (!eof && ifile->pool.posted - completed < workers) {
+            if (offset + ifile->bytes_per_sample > ifile->file_size) {
+                // Done.
+                eof = true;
+                break;
+            }
+
+            struct mag_buf *outbuf = fifo_acquire_source(ifile->source, 100 /* milliseconds */);
+            if (!outbuf) {
+                // maybe we're slow, maybe we halted
+                break;
+            }
+
+            // Compute the sample timestamp and system time for the start of the block
+            outbuf->sampleTimestamp = ifileSampleTimestamp(ifile, offset / ifile->bytes_per_sample);
+            outbuf->sysTimestamp = mstime();
+            outbuf->flags = 0;
+
+            struct ifile_job *job = &ifile->pool.jobs[ifile->pool.posted % IFILE_MAX_WORKERS];
+            if (!ifileMapNext(ifile, &offset, outbuf, job)) {
+                // Can't go any further; deliver this buffer empty once
+                // everything before it has been delivered
+                outbuf->validLength = outbuf->overlap;
+                failed = outbuf;
+                eof = true;
+                break;
+            }
+
+            if (workers > 1) {
+                pthread_mutex_lock(&ifile->pool.mutex);
+                ++ifile->pool.posted;
+                pthread_cond_signal(&ifile->pool.job_cond);
+                pthread_mutex_unlock(&ifile->pool.mutex);
+            } else {
+                ifileConvert(ifile, job->input, job->samples, outbuf);
+                job->done = true;
+                ++ifile->pool.posted;
+            }
+        }
+
+        if (ifile->pool.posted == completed) {
+            if (eof)
+                break;
+            continue;
         }
 
-        // Push the new data to the FIFO
-        fifo_enqueue(outbuf);
-        sampleCounter += samples_read;
+        // deliver the oldest buffer once it is converted
+        struct ifile_job *job = &ifile->pool.jobs[completed % IFILE_MAX_WORKERS];
+        if (workers > 1) {
+            pthread_mutex_lock(&ifile->pool.mutex);
+            while (!job->done)
+                pthread_cond_wait(&ifile->pool.done_cond, &ifile->pool.mutex);
+            pthread_mutex_unlock(&ifile->pool.mutex);
+        }
+
+        iqcapture_tap(ifile->source, ifile->input_format, job->input, (size_t) job->samples * ifile->bytes_per_sample);
+        munmap(job->map, job->map_length);
+        ifileDeliver(ifile, job->buf, job->samples, next_buffer_delivery);
+        ++completed;
+    }
+
+    // On early exit, wait for and unmap any buffers still being converted
+    while (completed != ifile->pool.posted) {
+        struct ifile_job *job = &ifile->pool.jobs[completed % IFILE_MAX_WORKERS];
+        if (workers > 1) {
+            pthread_mutex_lock(&ifile->pool.mutex);
+            while (!job->done)
+                pthread_cond_wait(&ifile->pool.done_cond, &ifile->pool.mutex);
+            pthread_mutex_unlock(&ifile->pool.mutex);
+        }
+        munmap(job->map, job->map_length);
+        ++completed;
+    }
+
+    if (failed)
+        fifo_enqueue(failed);
+
+    if (workers > 1)
+        ifileStopWorkers(ifile);
+}
+
+void ifileRun()
+{
+    ifileRunSource(0);
+}
+
+void ifileRunSource(unsigned source)
+{
+    struct ifile_source *ifile = &ifile_sources[source];
+
+    if (ifile->fd < 0)
+        return;
+
+    struct timespec next_buffer_delivery;
+    clock_gettime(CLOCK_MONOTONIC, &next_buffer_delivery);
+    clock_gettime(CLOCK_MONOTONIC, &ifile->run_start);
+
+    if (ifile->mapped) {
+        // Conversion is only split across threads when buffers can be
+        // converted independently: the DC filter carries state from one
+        // buffer to the next, and a mirror-mapped FIFO places each buffer
+        // directly after the previous one, so it can't hand out more than
+        // one buffer at a time. The resampler also carries state between
+        // buffers.
+        unsigned workers = 1;
+        if (!Modes.dc_filter && !fifo_is_mirrored() && !ifile->resampler)
+            workers = ifileWorkerCount(ifile);
+
+        ifileRunMapped(ifile, workers, &next_buffer_delivery);
+    } else {
+        ifileRunRead(ifile, &next_buffer_delivery);
     }
 
     // Wait for the FIFO to drain so we don't throw away trailing data
-    fifo_drain();
+    fifo_drain_source(ifile->source);
+    clock_gettime(CLOCK_MONOTONIC, &ifile->run_end);
 }
 
 void ifileClose()
 {
-    if (ifile.converter) {
-        cleanup_converter(ifile.converter_state);
-        ifile.converter = NULL;
-        ifile.converter_state = NULL;
+    ifileCloseSource(0);
+}
+
+void ifileCloseSource(unsigned source)
+{
+    struct ifile_source *ifile = &ifile_sources[source];
+
+    if (ifile->samples_read) {
+        // Report how fast we got through the file
+        double elapsed = (ifile->run_end.tv_sec - ifile->run_start.tv_sec) + (ifile->run_end.tv_nsec - ifile->run_start.tv_nsec) / 1e9;
+        double duration = ifile->samples_read / Modes.capture_rate;
+        if (elapsed <= 0)
+            elapsed = 1e-9;
+
+        if (source == 0) {
+            fprintf(stderr,
+                    "ifile: processed %.1f seconds of samples in %.1f seconds (%.1fx real time)\n"
+                    "ifile:   %.0f samples/s, %.1f messages/s (%u messages)\n",
+                    duration, elapsed, duration / elapsed,
+                    ifile->samples_read / elapsed,
+                    Modes.stats_alltime.messages_total / elapsed,
+                    Modes.stats_alltime.messages_total);
+        } else {
+            // message counts are only reported for the merged output, with source 0
+            fprintf(stderr,
+                    "ifile %u: processed %.1f seconds of samples in %.1f seconds (%.1fx real time)\n",
+                    source, duration, elapsed, duration / elapsed);
+        }
+        ifile->samples_read = 0;
     }
 
-    if (ifile.readbuf) {
-        free(ifile.readbuf);
-        ifile.readbuf = NULL;
+    if (ifile->converter) {
+        cleanup_converter(ifile->converter_state);
+        ifile->converter = NULL;
+        ifile->converter_state = NULL;
     }
 
-    if (ifile.fd >= 0 && ifile.fd != STDIN_FILENO) {
-        close(ifile.fd);
-        ifile.fd = -1;
+    cleanup_resampler(ifile->resampler);
+    ifile->resampler = NULL;
+
+    if (ifile->readbuf) {
+        free(ifile->readbuf);
+        ifile->readbuf = NULL;
+    }
+
+    iqz_reader_close(ifile->container);
+    ifile->container = NULL;
+
+    if (ifile->fd >= 0 && ifile->fd != STDIN_FILENO) {
+        close(ifile->fd);
+        ifile->fd = -1;
     }
 }
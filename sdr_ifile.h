@@ -30,4 +30,10 @@ bool ifileOpen();
 void ifileRun();
 void ifileClose();
 
+// Additional input files (--add-source)
+bool ifileHandleSourceOption(unsigned source, int argc, char **argv, int *jptr);
+bool ifileOpenSource(unsigned source);
+void ifileRunSource(unsigned source);
+void ifileCloseSource(unsigned source);
+
 #endif
@@ -66,6 +66,7 @@ static struct {
     int bytes_in_sample;
     iq_convert_fn converter;
     struct converter_state *converter_state;
+    struct resampler *resampler;  // non-NULL if capturing at a different rate to Modes.sample_rate
 } LimeSDR;
 
 static void limesdrLogHandler(int lvl, const char *msg)
@@ -268,7 +269,7 @@ bool limesdrOpen(void)
         goto error;
     }
 
-    if (LMS_SetSampleRate(LimeSDR.dev, Modes.sample_rate, LimeSDR.oversample)) {
+    if (LMS_SetSampleRate(LimeSDR.dev, Modes.capture_rate, LimeSDR.oversample)) {
         limesdrLogHandler(LMS_LOG_ERROR, "unable to set sampling rate");
         goto error;
     }
@@ -310,7 +311,7 @@ bool limesdrOpen(void)
     }
 
     LimeSDR.converter = init_converter(INPUT_SC16,
-                                      Modes.sample_rate,
+                                      Modes.capture_rate,
                                       Modes.dc_filter,
                                       &LimeSDR.converter_state);
     if (!LimeSDR.converter) {
@@ -318,6 +319,13 @@ bool limesdrOpen(void)
         goto error;
     }
 
+    if (Modes.capture_rate != Modes.sample_rate) {
+        if (!(LimeSDR.resampler = init_resampler(Modes.capture_rate, Modes.sample_rate, MODES_MAG_BUF_SAMPLES))) {
+            limesdrLogHandler(LMS_LOG_ERROR, "can't initialize resampler");
+            goto error;
+        }
+    }
+
     return true;
 
   error:
@@ -336,7 +344,7 @@ bool limesdrOpen(void)
 
 static void limesdrCallback(unsigned char *buf, uint32_t len, void *ctx)
 {
-    static int dropped = 0;
+    static unsigned dropped[MAGBUF_DROP_CAUSES];
     static uint64_t sampleCounter = 0;
 
     MODES_NOTUSED(ctx);
@@ -348,39 +356,48 @@ static void limesdrCallback(unsigned char *buf, uint32_t len, void *ctx)
     struct mag_buf *outbuf = fifo_acquire(0 /* don't wait */);
     if (!outbuf) {
         // FIFO is full. Drop this block.
-        dropped += samples_read;
+        dropped[MAGBUF_DROP_FIFO_FULL] += samples_read;
         sampleCounter += samples_read;
+        if (LimeSDR.resampler)
+            resampler_reset(LimeSDR.resampler);
         return;
     }
 
     outbuf->flags = 0;
 
-    if (dropped) {
-        // We previously dropped some samples due to no buffers being available
-        outbuf->flags |= MAGBUF_DISCONTINUOUS;
-        outbuf->dropped = dropped;
-    }
-
-    dropped = 0;
+    // Report any samples we previously dropped
+    fifo_add_dropped(outbuf, dropped);
 
     // Compute the sample timestamp and system timestamp for the start of the block
-    outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
+    // (when resampling, the block starts with the input samples still held by the resampler)
+    unsigned pending = (LimeSDR.resampler ? resampler_pending(LimeSDR.resampler) : 0);
+    outbuf->sampleTimestamp = (sampleCounter - pending) * 12e6 / Modes.capture_rate;
     sampleCounter += samples_read;
 
     // Get the approx system time for the start of this block
-    unsigned block_duration = 1e3 * samples_read / Modes.sample_rate;
+    unsigned block_duration = 1e3 * (samples_read + pending) / Modes.capture_rate;
     outbuf->sysTimestamp = mstime() - block_duration;
 
     // Convert the new data
     unsigned to_convert = samples_read;
-    if (to_convert + outbuf->overlap > outbuf->totalLength) {
+    unsigned max_convert = outbuf->totalLength - outbuf->overlap;
+    if (LimeSDR.resampler)
+        max_convert = resampler_max_input(LimeSDR.resampler, max_convert);
+    if (to_convert > max_convert) {
         // how did that happen?
-        to_convert = outbuf->totalLength - outbuf->overlap;
-        dropped = samples_read - to_convert;
+        to_convert = max_convert;
+        dropped[MAGBUF_DROP_OVERSIZE] += samples_read - to_convert;
     }
 
-    LimeSDR.converter(buf, &outbuf->data[outbuf->overlap], to_convert, LimeSDR.converter_state, &outbuf->mean_level, &outbuf->mean_power);
-    outbuf->validLength = outbuf->overlap + to_convert;
+    if (LimeSDR.resampler) {
+        LimeSDR.converter(buf, resampler_input(LimeSDR.resampler), to_convert, LimeSDR.converter_state, NULL, NULL);
+        outbuf->validLength = outbuf->overlap + resample(LimeSDR.resampler, to_convert, &outbuf->data[outbuf->overlap], &outbuf->mean_level, &outbuf->mean_power);
+        if (to_convert < samples_read)
+            resampler_reset(LimeSDR.resampler);
+    } else {
+        LimeSDR.converter(buf, &outbuf->data[outbuf->overlap], to_convert, LimeSDR.converter_state, &outbuf->mean_level, &outbuf->mean_power);
+        outbuf->validLength = outbuf->overlap + to_convert;
+    }
 
     // Push to the demodulation thread
     fifo_enqueue(outbuf);
@@ -424,6 +441,9 @@ void limesdrClose()
         LimeSDR.converter_state = NULL;
     }
 
+    cleanup_resampler(LimeSDR.resampler);
+    LimeSDR.resampler = NULL;
+
     LMS_StopStream(&LimeSDR.stream);
 
     if (LimeSDR.is_stream_opened) {
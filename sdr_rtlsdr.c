@@ -55,21 +55,42 @@
 
 #if defined(__arm__) || defined(__aarch64__)
 // Assume we need to use a bounce buffer to avoid performance problems on Pis running kernel 5.x and using zerocopy
-#  define USE_BOUNCE_BUFFER
+#  define DEFAULT_BOUNCE_BUFFER true
+#else
+#  define DEFAULT_BOUNCE_BUFFER false
 #endif
 
-static struct {
+// Limits on the async buffer configuration
+#define RTLSDR_MAX_BUFFERS 64
+#define RTLSDR_MIN_BUF_SIZE 16384
+
+// State for one device; there is one of these per --add-source
+struct rtlsdr_source {
+    unsigned source;            // index of this source, and of its FIFO
+    char *dev_name;             // --device for added sources; source 0 uses Modes.dev_name
     rtlsdr_dev_t *dev;
     bool digital_agc;
     int ppm_error;
     int direct_sampling;
+    unsigned buffer_count;      // number of async (USB) buffers
+    unsigned buffer_size;       // size of each async buffer, bytes
+    bool always_bounce;         // always copy samples out of the USB buffer before converting
     uint8_t *bounce_buffer;
     iq_convert_fn converter;
     struct converter_state *converter_state;
+    struct resampler *resampler;  // non-NULL if capturing at a different rate to Modes.sample_rate
     int *gains;
     int gain_steps;
     int current_gain;
-} RTLSDR;
+
+    // reader thread state
+    unsigned dropped[MAGBUF_DROP_CAUSES];
+    uint64_t sample_counter;
+};
+
+static struct rtlsdr_source rtlsdr_sources[MAGBUF_MAX_SOURCES];
+
+static int rtlsdrSetSourceGain(struct rtlsdr_source *rtl, int step);
 
 //
 // =============================== RTLSDR handling ==========================
@@ -77,16 +98,26 @@ static struct {
 
 void rtlsdrInitConfig()
 {
-    RTLSDR.dev = NULL;
-    RTLSDR.digital_agc = false;
-    RTLSDR.ppm_error = 0;
-    RTLSDR.direct_sampling = 0;
-    RTLSDR.bounce_buffer = NULL;
-    RTLSDR.converter = NULL;
-    RTLSDR.converter_state = NULL;
-    RTLSDR.gains = NULL;
-    RTLSDR.gain_steps = 0;
-    RTLSDR.current_gain = 0;
+    for (unsigned source = 0; source < MAGBUF_MAX_SOURCES; ++source) {
+        struct rtlsdr_source *rtl = &rtlsdr_sources[source];
+        rtl->source = source;
+        rtl->dev_name = NULL;
+        rtl->dev = NULL;
+        rtl->digital_agc = false;
+        rtl->ppm_error = 0;
+        rtl->direct_sampling = 0;
+        rtl->buffer_count = MODES_RTL_BUFFERS;
+        rtl->buffer_size = MODES_RTL_BUF_SIZE;
+        rtl->always_bounce = DEFAULT_BOUNCE_BUFFER;
+        rtl->bounce_buffer = NULL;
+        rtl->converter = NULL;
+        rtl->converter_state = NULL;
+        rtl->resampler = NULL;
+        rtl->gains = NULL;
+        rtl->gain_steps = 0;
+        rtl->current_gain = 0;
+        rtl->sample_counter = 0;
+    }
 }
 
 static void show_rtlsdr_devices()
@@ -157,20 +188,64 @@ void rtlsdrShowHelp()
     printf("--enable-agc             enable digital AGC (not tuner AGC!)\n");
     printf("--ppm <correction>       set oscillator frequency correction in PPM\n");
     printf("--direct <0|1|2>         set direct sampling mode\n");
+    printf("--rtl-buffers <n>        number of USB buffers to use (default: %d)\n", MODES_RTL_BUFFERS);
+    printf("--rtl-buffer-size <n>    size of each USB buffer in KiB, multiple of 16 (default: %d)\n", MODES_RTL_BUF_SIZE / 1024);
+    printf("--rtl-bounce-buffer <auto|yes|no>\n"
+           "                         copy samples out of USB buffers before converting them\n"
+           "                         (default: auto; always on ARM, otherwise only if misaligned)\n");
+    printf("                         (after --add-source, these options and --device configure\n"
+           "                         the added device; gain control applies to the first device)\n");
     printf("\n");
 }
 
 bool rtlsdrHandleOption(int argc, char **argv, int *jptr)
 {
+    return rtlsdrHandleSourceOption(0, argc, argv, jptr);
+}
+
+bool rtlsdrHandleSourceOption(unsigned source, int argc, char **argv, int *jptr)
+{
+    struct rtlsdr_source *rtl = &rtlsdr_sources[source];
     int j = *jptr;
     bool more = (j +1  < argc);
 
-    if (!strcmp(argv[j], "--enable-agc")) {
-        RTLSDR.digital_agc = true;
+    if (source > 0 && (!strcmp(argv[j], "--device") || !strcmp(argv[j], "--device-index")) && more) {
+        // source 0's device is set by the generic --device option
+        rtl->dev_name = strdup(argv[++j]);
+    } else if (!strcmp(argv[j], "--enable-agc")) {
+        rtl->digital_agc = true;
     } else if (!strcmp(argv[j], "--ppm") && more) {
-        RTLSDR.ppm_error = atoi(argv[++j]);
+        rtl->ppm_error = atoi(argv[++j]);
     } else if (!strcmp(argv[j], "--direct") && more) {
-        RTLSDR.direct_sampling = atoi(argv[++j]);
+        rtl->direct_sampling = atoi(argv[++j]);
+    } else if (!strcmp(argv[j], "--rtl-buffers") && more) {
+        int count = atoi(argv[++j]);
+        if (count < 1 || count > RTLSDR_MAX_BUFFERS) {
+            fprintf(stderr, "rtlsdr: --rtl-buffers must be between 1 and %d\n", RTLSDR_MAX_BUFFERS);
+            return false;
+        }
+        rtl->buffer_count = count;
+    } else if (!strcmp(argv[j], "--rtl-buffer-size") && more) {
+        int size = atoi(argv[++j]) * 1024;
+        // must be a multiple of the USB transfer size and fit in one sample buffer
+        if (size < RTLSDR_MIN_BUF_SIZE || size > MODES_RTL_BUF_SIZE || size % RTLSDR_MIN_BUF_SIZE) {
+            fprintf(stderr, "rtlsdr: --rtl-buffer-size must be a multiple of %d between %d and %d\n",
+                    RTLSDR_MIN_BUF_SIZE / 1024, RTLSDR_MIN_BUF_SIZE / 1024, MODES_RTL_BUF_SIZE / 1024);
+            return false;
+        }
+        rtl->buffer_size = size;
+    } else if (!strcmp(argv[j], "--rtl-bounce-buffer") && more) {
+        ++j;
+        if (!strcmp(argv[j], "auto")) {
+            rtl->always_bounce = DEFAULT_BOUNCE_BUFFER;
+        } else if (!strcmp(argv[j], "yes")) {
+            rtl->always_bounce = true;
+        } else if (!strcmp(argv[j], "no")) {
+            rtl->always_bounce = false;
+        } else {
+            fprintf(stderr, "rtlsdr: --rtl-bounce-buffer must be one of auto, yes, no\n");
+            return false;
+        }
     } else {
         return false;
     }
@@ -189,15 +264,27 @@ static int sort_gains(const void *left, const void *right)
 
 bool rtlsdrOpen(void)
 {
+    return rtlsdrOpenSource(0);
+}
+
+bool rtlsdrOpenSource(unsigned source)
+{
+    struct rtlsdr_source *rtl = &rtlsdr_sources[source];
+    char *dev_name = (source == 0 ? Modes.dev_name : rtl->dev_name);
+
     if (!rtlsdr_get_device_count()) {
         fprintf(stderr, "rtlsdr: no supported devices found.\n");
         return false;
     }
 
     int dev_index = 0;
-    if (Modes.dev_name) {
-        if ((dev_index = find_device_index(Modes.dev_name)) < 0) {
-            fprintf(stderr, "rtlsdr: no device matching '%s' found.\n", Modes.dev_name);
+    if (source > 0 && !dev_name) {
+        fprintf(stderr, "rtlsdr: --add-source requires a --device for the added device\n");
+        return false;
+    }
+    if (dev_name) {
+        if ((dev_index = find_device_index(dev_name)) < 0) {
+            fprintf(stderr, "rtlsdr: no device matching '%s' found.\n", dev_name);
             show_rtlsdr_devices();
             return false;
         }
@@ -215,29 +302,29 @@ bool rtlsdrOpen(void)
             dev_index, rtlsdr_get_device_name(dev_index),
             manufacturer, product, serial);
 
-    if (rtlsdr_open(&RTLSDR.dev, dev_index) < 0) {
+    if (rtlsdr_open(&rtl->dev, dev_index) < 0) {
         fprintf(stderr, "rtlsdr: error opening the RTLSDR device: %s\n",
             strerror(errno));
         return false;
     }
 
     // Set gain, frequency, sample rate, and reset the device
-    if (RTLSDR.direct_sampling) {
-        fprintf(stderr, "rtlsdr: direct sampling from input %d\n", RTLSDR.direct_sampling);
-        rtlsdr_set_direct_sampling(RTLSDR.dev, RTLSDR.direct_sampling);
-        RTLSDR.gain_steps = 0;
+    if (rtl->direct_sampling) {
+        fprintf(stderr, "rtlsdr: direct sampling from input %d\n", rtl->direct_sampling);
+        rtlsdr_set_direct_sampling(rtl->dev, rtl->direct_sampling);
+        rtl->gain_steps = 0;
     } else {
         int *gains;
         int numgains;
 
-        numgains = rtlsdr_get_tuner_gains(RTLSDR.dev, NULL);
+        numgains = rtlsdr_get_tuner_gains(rtl->dev, NULL);
         if (numgains <= 0) {
             fprintf(stderr, "rtlsdr: error getting tuner gains\n");
             return false;
             }
 
         gains = malloc((numgains + 1) * sizeof(int));
-        if (rtlsdr_get_tuner_gains(RTLSDR.dev, gains) != numgains) {
+        if (rtlsdr_get_tuner_gains(rtl->dev, gains) != numgains) {
             fprintf(stderr, "rtlsdr: error getting tuner gains\n");
             free(gains);
             return false;
@@ -251,8 +338,8 @@ bool rtlsdrOpen(void)
         // max" gain. :/
         gains[numgains] = gains[numgains-1] + 90; // +9.0dB
 
-        RTLSDR.gain_steps = numgains + 1;
-        RTLSDR.gains = gains;
+        rtl->gain_steps = numgains + 1;
+        rtl->gains = gains;
 
         int selected = -1;
         if (Modes.gain == MODES_LEGACY_AUTO_GAIN) {
@@ -266,37 +353,52 @@ bool rtlsdrOpen(void)
             }
         }
 
-        rtlsdrSetGain(selected);
+        rtlsdrSetSourceGain(rtl, selected);
     }
 
-    if (RTLSDR.digital_agc) {
+    if (rtl->digital_agc) {
         fprintf(stderr, "rtlsdr: enabling digital AGC\n");
-        rtlsdr_set_agc_mode(RTLSDR.dev, 1);
+        rtlsdr_set_agc_mode(rtl->dev, 1);
     }
 
-    rtlsdr_set_freq_correction(RTLSDR.dev, RTLSDR.ppm_error);
-    rtlsdr_set_center_freq(RTLSDR.dev, Modes.freq);
-    rtlsdr_set_sample_rate(RTLSDR.dev, (unsigned)Modes.sample_rate);
+    rtlsdr_set_freq_correction(rtl->dev, rtl->ppm_error);
+    rtlsdr_set_center_freq(rtl->dev, Modes.freq);
+    rtlsdr_set_sample_rate(rtl->dev, (unsigned)Modes.capture_rate);
 
-    rtlsdr_reset_buffer(RTLSDR.dev);
+    rtlsdr_reset_buffer(rtl->dev);
 
-    RTLSDR.converter = init_converter(INPUT_UC8,
-                                      Modes.sample_rate,
-                                      Modes.dc_filter,
-                                      &RTLSDR.converter_state);
-    if (!RTLSDR.converter) {
+    if (Modes.demod_u8)
+        rtl->converter = init_converter_u8(INPUT_UC8, &rtl->converter_state);
+    else
+        rtl->converter = init_converter(INPUT_UC8,
+                                        Modes.capture_rate,
+                                        Modes.dc_filter,
+                                        &rtl->converter_state);
+    if (!rtl->converter) {
         fprintf(stderr, "rtlsdr: can't initialize sample converter\n");
-        rtlsdrClose();
+        rtlsdrCloseSource(source);
         return false;
     }
 
-#ifdef USE_BOUNCE_BUFFER
-    if (!(RTLSDR.bounce_buffer = malloc(MODES_RTL_BUF_SIZE))) {
+    if (Modes.capture_rate != Modes.sample_rate) {
+        if (!(rtl->resampler = init_resampler(Modes.capture_rate, Modes.sample_rate, rtl->buffer_size / 2))) {
+            fprintf(stderr, "rtlsdr: can't initialize resampler\n");
+            rtlsdrCloseSource(source);
+            return false;
+        }
+    }
+
+    // Allocated regardless of always_bounce, as it is also used for misaligned USB buffers
+#ifdef STARCH_ALIGNMENT
+    rtl->bounce_buffer = aligned_alloc(STARCH_ALIGNMENT, rtl->buffer_size);
+#else
+    rtl->bounce_buffer = malloc(rtl->buffer_size);
+#endif
+    if (!rtl->bounce_buffer) {
         fprintf(stderr, "rtlsdr: can't allocate bounce buffer\n");
-        rtlsdrClose();
+        rtlsdrCloseSource(source);
         return false;
     }
-#endif
 
     if (Modes.adaptive_range_target == 0)
         Modes.adaptive_range_target = 30.0;
@@ -306,15 +408,13 @@ bool rtlsdrOpen(void)
 
 static void rtlsdrCallback(unsigned char *buf, uint32_t len, void *ctx)
 {
-    static unsigned dropped = 0;
-    static uint64_t sampleCounter = 0;
-
-    MODES_NOTUSED(ctx);
+    struct rtlsdr_source *rtl = ctx;
+    unsigned *dropped = rtl->dropped;
 
-    sdrMonitor();
+    sdrMonitorSource(rtl->source);
 
     if (Modes.exit) {
-        rtlsdr_cancel_async(RTLSDR.dev); // ask our caller to exit
+        rtlsdr_cancel_async(rtl->dev); // ask our caller to exit
         return;
     }
 
@@ -322,48 +422,63 @@ static void rtlsdrCallback(unsigned char *buf, uint32_t len, void *ctx)
     if (!samples_read)
         return; // that wasn't useful
 
-    struct mag_buf *outbuf = fifo_acquire(0 /* don't wait */);
+    // Capture the raw samples, if enabled; this doesn't depend on a free FIFO buffer
+    iqcapture_tap(rtl->source, INPUT_UC8, buf, samples_read * 2);
+
+    struct mag_buf *outbuf = fifo_acquire_source(rtl->source, 0 /* don't wait */);
     if (!outbuf) {
         // FIFO is full. Drop this block.
-        dropped += samples_read;
-        sampleCounter += samples_read;
+        dropped[MAGBUF_DROP_FIFO_FULL] += samples_read;
+        rtl->sample_counter += samples_read;
+        if (rtl->resampler)
+            resampler_reset(rtl->resampler);
         return;
     }
 
     outbuf->flags = 0;
+    sdrTagGainChange(outbuf);
 
-    if (dropped) {
-        // We previously dropped some samples due to no buffers being available
-        outbuf->flags |= MAGBUF_DISCONTINUOUS;
-        outbuf->dropped = dropped;
-    }
-
-    dropped = 0;
+    // Report any samples we previously dropped
+    fifo_add_dropped(outbuf, dropped);
 
     // Compute the sample timestamp and system timestamp for the start of the block
-    outbuf->sampleTimestamp = sampleCounter * 12e6 / Modes.sample_rate;
-    sampleCounter += samples_read;
+    // (when resampling, the block starts with the input samples still held by the resampler)
+    unsigned pending = (rtl->resampler ? resampler_pending(rtl->resampler) : 0);
+    outbuf->sampleTimestamp = (rtl->sample_counter - pending) * 12e6 / Modes.capture_rate;
+    rtl->sample_counter += samples_read;
 
     // Get the approx system time for the start of this block
-    uint64_t block_duration = 1e3 * samples_read / Modes.sample_rate;
+    uint64_t block_duration = 1e3 * (samples_read + pending) / Modes.capture_rate;
     outbuf->sysTimestamp = mstime() - block_duration;
 
     // Convert the new data
     unsigned to_convert = samples_read;
-    if (to_convert + outbuf->overlap > outbuf->totalLength) {
+    unsigned max_convert = outbuf->totalLength - outbuf->overlap;
+    if (rtl->resampler)
+        max_convert = resampler_max_input(rtl->resampler, max_convert);
+    if (to_convert > max_convert) {
         // how did that happen?
-        to_convert = outbuf->totalLength - outbuf->overlap;
-        dropped = samples_read - to_convert;
+        to_convert = max_convert;
+        dropped[MAGBUF_DROP_OVERSIZE] += samples_read - to_convert;
     }
 
-#ifdef USE_BOUNCE_BUFFER
-    // Work around zero-copy slowness on Pis with 5.x kernels
-    memcpy(RTLSDR.bounce_buffer, buf, to_convert * 2);
-    buf = RTLSDR.bounce_buffer;
-#endif
+    // Convert directly from the USB buffer if we can; otherwise copy it first.
+    // Always copying works around zero-copy slowness on Pis with 5.x kernels;
+    // copying misaligned buffers lets the converter use its aligned variant.
+    if ((rtl->always_bounce || !STARCH_IS_ALIGNED(buf)) && to_convert * 2 <= rtl->buffer_size) {
+        memcpy(rtl->bounce_buffer, buf, to_convert * 2);
+        buf = rtl->bounce_buffer;
+    }
 
-    RTLSDR.converter(buf, &outbuf->data[outbuf->overlap], to_convert, RTLSDR.converter_state, &outbuf->mean_level, &outbuf->mean_power);
-    outbuf->validLength = outbuf->overlap + to_convert;
+    if (rtl->resampler) {
+        rtl->converter(buf, resampler_input(rtl->resampler), to_convert, rtl->converter_state, NULL, NULL);
+        outbuf->validLength = outbuf->overlap + resample(rtl->resampler, to_convert, &outbuf->data[outbuf->overlap], &outbuf->mean_level, &outbuf->mean_power);
+        if (to_convert < samples_read)
+            resampler_reset(rtl->resampler);
+    } else {
+        rtl->converter(buf, mag_buf_sample(outbuf, outbuf->overlap), to_convert, rtl->converter_state, &outbuf->mean_level, &outbuf->mean_power);
+        outbuf->validLength = outbuf->overlap + to_convert;
+    }
 
     // Push to the demodulation thread
     fifo_enqueue(outbuf);
@@ -371,13 +486,20 @@ static void rtlsdrCallback(unsigned char *buf, uint32_t len, void *ctx)
 
 void rtlsdrRun()
 {
-    if (!RTLSDR.dev) {
+    rtlsdrRunSource(0);
+}
+
+void rtlsdrRunSource(unsigned source)
+{
+    struct rtlsdr_source *rtl = &rtlsdr_sources[source];
+
+    if (!rtl->dev) {
         return;
     }
 
-    rtlsdr_read_async(RTLSDR.dev, rtlsdrCallback, NULL,
-                      /* MODES_RTL_BUFFERS */ 4,
-                      MODES_RTL_BUF_SIZE);
+    rtlsdr_read_async(rtl->dev, rtlsdrCallback, rtl,
+                      rtl->buffer_count,
+                      rtl->buffer_size);
     if (!Modes.exit) {
         fprintf(stderr, "rtlsdr: rtlsdr_read_async returned unexpectedly, probably lost the USB device, bailing out\n");
     }
@@ -385,87 +507,112 @@ void rtlsdrRun()
 
 void rtlsdrStop()
 {
-    if (!RTLSDR.dev) {
+    rtlsdrStopSource(0);
+}
+
+void rtlsdrStopSource(unsigned source)
+{
+    struct rtlsdr_source *rtl = &rtlsdr_sources[source];
+
+    if (!rtl->dev) {
         return;
     }
 
-    rtlsdr_cancel_async(RTLSDR.dev);
+    rtlsdr_cancel_async(rtl->dev);
 }
 
 void rtlsdrClose()
 {
-    if (RTLSDR.dev) {
-        rtlsdr_close(RTLSDR.dev);
-        RTLSDR.dev = NULL;
+    rtlsdrCloseSource(0);
+}
+
+void rtlsdrCloseSource(unsigned source)
+{
+    struct rtlsdr_source *rtl = &rtlsdr_sources[source];
+
+    if (rtl->dev) {
+        rtlsdr_close(rtl->dev);
+        rtl->dev = NULL;
     }
 
-    if (RTLSDR.converter) {
-        cleanup_converter(RTLSDR.converter_state);
-        RTLSDR.converter = NULL;
-        RTLSDR.converter_state = NULL;
+    if (rtl->converter) {
+        cleanup_converter(rtl->converter_state);
+        rtl->converter = NULL;
+        rtl->converter_state = NULL;
     }
 
-    free(RTLSDR.bounce_buffer);
-    RTLSDR.bounce_buffer = NULL;
+    cleanup_resampler(rtl->resampler);
+    rtl->resampler = NULL;
+
+    free(rtl->bounce_buffer);
+    rtl->bounce_buffer = NULL;
 
-    free(RTLSDR.gains);
-    RTLSDR.gains = NULL;
+    free(rtl->gains);
+    rtl->gains = NULL;
 }
 
 int rtlsdrGetGain()
 {
-    return RTLSDR.current_gain;
+    struct rtlsdr_source *rtl = &rtlsdr_sources[0];
+    return rtl->current_gain;
 }
 
 int rtlsdrGetMaxGain()
 {
-    return RTLSDR.gain_steps - 1;
+    struct rtlsdr_source *rtl = &rtlsdr_sources[0];
+    return rtl->gain_steps - 1;
 }
 
 double rtlsdrGetGainDb(int step)
 {
-    if (!RTLSDR.gains)
+    struct rtlsdr_source *rtl = &rtlsdr_sources[0];
+    if (!rtl->gains)
         return 0.0;
 
     if (step < 0)
         step = 0;
-    if (step >= RTLSDR.gain_steps)
-        step = RTLSDR.gain_steps - 1;
-    return RTLSDR.gains[step] / 10.0;
+    if (step >= rtl->gain_steps)
+        step = rtl->gain_steps - 1;
+    return rtl->gains[step] / 10.0;
 }
 
 int rtlsdrSetGain(int step)
 {
-    if (!RTLSDR.gains)
+    return rtlsdrSetSourceGain(&rtlsdr_sources[0], step);
+}
+
+static int rtlsdrSetSourceGain(struct rtlsdr_source *rtl, int step)
+{
+    if (!rtl->gains)
         return -1;
 
     if (step < 0)
         step = 0;
-    if (step >= RTLSDR.gain_steps)
-        step = RTLSDR.gain_steps - 1;
+    if (step >= rtl->gain_steps)
+        step = rtl->gain_steps - 1;
 
-    if (step == RTLSDR.gain_steps - 1) {
-        if (rtlsdr_set_tuner_gain_mode(RTLSDR.dev, 0) < 0) {
+    if (step == rtl->gain_steps - 1) {
+        if (rtlsdr_set_tuner_gain_mode(rtl->dev, 0) < 0) {
             fprintf(stderr, "rtlsdr: failed to enable tuner AGC\n");
-            return RTLSDR.current_gain;
+            return rtl->current_gain;
         }            
 
-        fprintf(stderr, "rtlsdr: tuner gain set to about %.1f dB (gain step %d) (tuner AGC enabled)\n", RTLSDR.gains[step] / 10.0, step);
+        fprintf(stderr, "rtlsdr: tuner gain set to about %.1f dB (gain step %d) (tuner AGC enabled)\n", rtl->gains[step] / 10.0, step);
     } else {
-        if (rtlsdr_set_tuner_gain_mode(RTLSDR.dev, 1) < 0) {
+        if (rtlsdr_set_tuner_gain_mode(rtl->dev, 1) < 0) {
             fprintf(stderr, "rtlsdr: failed to disable tuner AGC\n");
-            return RTLSDR.current_gain;
+            return rtl->current_gain;
         }
 
-        if (rtlsdr_set_tuner_gain(RTLSDR.dev, RTLSDR.gains[step]) < 0) {
-            fprintf(stderr, "rtlsdr: failed to set tuner gain to %.1fdB\n", RTLSDR.gains[step] / 10.0);
-            return RTLSDR.current_gain;
+        if (rtlsdr_set_tuner_gain(rtl->dev, rtl->gains[step]) < 0) {
+            fprintf(stderr, "rtlsdr: failed to set tuner gain to %.1fdB\n", rtl->gains[step] / 10.0);
+            return rtl->current_gain;
         }
 
-        fprintf(stderr, "rtlsdr: tuner gain set to %.1f dB (gain step %d)\n", RTLSDR.gains[step] / 10.0, step);
+        fprintf(stderr, "rtlsdr: tuner gain set to %.1f dB (gain step %d)\n", rtl->gains[step] / 10.0, step);
     }
 
-    RTLSDR.current_gain = step;
+    rtl->current_gain = step;
     return step;
 }
 
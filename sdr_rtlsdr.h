@@ -33,4 +33,11 @@ int rtlsdrGetMaxGain();
 double rtlsdrGetGainDb(int step);
 int rtlsdrSetGain(int step);
 
+// Additional devices (--add-source); gain control only applies to source 0
+bool rtlsdrHandleSourceOption(unsigned source, int argc, char **argv, int *jptr);
+bool rtlsdrOpenSource(unsigned source);
+void rtlsdrRunSource(unsigned source);
+void rtlsdrStopSource(unsigned source);
+void rtlsdrCloseSource(unsigned source);
+
 #endif
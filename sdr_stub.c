@@ -47,6 +47,11 @@ void sdrRun()
     /* nothing */
 }
 
+void sdrRunSource(unsigned source)
+{
+    MODES_NOTUSED(source);
+}
+
 void sdrStop()
 {
     /* nothing */
@@ -62,6 +67,11 @@ void sdrMonitor()
     /* nothing */
 }
 
+void sdrMonitorSource(unsigned source)
+{
+    MODES_NOTUSED(source);
+}
+
 void sdrUpdateCPUTime(struct timespec *addTo)
 {
     MODES_NOTUSED(addTo);
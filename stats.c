@@ -81,15 +81,57 @@ void display_stats(struct stats *st) {
         printf("Local receiver:\n");
         printf("  %12llu samples processed\n",                        (unsigned long long)st->samples_processed);
         printf("  %12llu samples dropped\n",                          (unsigned long long)st->samples_dropped);
+        for (j = 0; j < MAGBUF_DROP_CAUSES; ++j) {
+            if (st->discontinuities[j])
+                printf("    %12llu in %u gaps caused by %s\n",
+                       (unsigned long long)st->samples_dropped_by_cause[j], st->discontinuities[j], fifo_drop_cause_name(j));
+        }
+
+        if (Modes.sdr_sources > 1) {
+            for (unsigned source = 0; source < Modes.sdr_sources; ++source) {
+                printf("  source %u:\n", source);
+                printf("    %12llu samples processed\n",             (unsigned long long)st->source_samples_processed[source]);
+                printf("    %12llu samples dropped\n",               (unsigned long long)st->source_samples_dropped[source]);
+                printf("    %12u messages used\n",                   st->source_messages[source]);
+                printf("    %12u messages discarded as duplicates\n", st->source_duplicates[source]);
+            }
+        }
 
         printf("  %12u Mode A/C messages received\n",                 st->demod_modeac);
         printf("  %12u Mode-S message preambles received\n",          st->demod_preambles);
         printf("    %12u with bad message format or invalid CRC\n",   st->demod_rejected_bad);
         printf("    %12u with unrecognized ICAO address\n",           st->demod_rejected_unknown_icao);
         printf("    %12u accepted with correct CRC\n",                st->demod_accepted[0]);
-        for (j = 1; j <= Modes.nfix_crc; ++j)
+        for (j = 1; j <= modesMaxCorrectedBits(); ++j)
             printf("    %12u accepted with %d-bit error repaired\n", st->demod_accepted[j], j);
 
+        unsigned phase_preambles = 0, phases_scored = 0;
+        for (j = 0; j < 6; ++j) {
+            phase_preambles += st->demod_phases_scored[j];
+            phases_scored += j * st->demod_phases_scored[j];
+        }
+        if (phase_preambles) {
+            printf("  %12u Mode-S message phases scored (%.2f per preamble)\n", phases_scored, (double) phases_scored / phase_preambles);
+            for (j = 0; j < 6; ++j)
+                printf("    %12u preambles with %d phases scored\n", st->demod_phases_scored[j], j);
+        }
+
+        if (st->demod_correlate_preambles) {
+            printf("  %12u Mode-S preambles found by the correlation detector\n", st->demod_correlate_preambles);
+            printf("    %12u accepted with correct CRC\n",                st->demod_correlate_accepted[0]);
+            for (j = 1; j <= modesMaxCorrectedBits(); ++j)
+                printf("    %12u accepted with %d-bit error repaired\n", st->demod_correlate_accepted[j], j);
+            printf("    %12u accepted that the peak/valley tests would miss\n", st->demod_correlate_only);
+        }
+
+        for (j = FIX_TABLE; j < FIX_TYPES; ++j) {
+            if (!st->fix.attempts[j])
+                continue;
+            printf("  %12u messages diagnosed by %s error correction (%.1f ms)\n", st->fix.attempts[j], fix_type_name(j), st->fix.ns[j] / 1e6);
+            printf("    %12u corrections found\n", st->fix.found[j]);
+            printf("    %12u accepted\n", st->fix.accepted[j]);
+        }
+
         if (st->noise_power_sum > 0 && st->noise_power_count > 0) {
             printf("  %5.1f dBFS noise power\n",
                    10 * log10(st->noise_power_sum / st->noise_power_count));
@@ -156,6 +198,31 @@ void display_stats(struct stats *st) {
         }
     }
 
+    if (st->overload_valid) {
+        printf("Overload shedding:\n"
+               "  %5d current shedding level (%s)\n"
+               "  %5u shedding level changes\n",
+               st->overload_level, overload_level_name(st->overload_level),
+               st->overload_changes);
+
+        for (unsigned i = 0; i < OVERLOAD_LEVELS; ++i) {
+            if (st->overload_level_seconds[i])
+                printf("    level %u: %5u seconds\n", i, st->overload_level_seconds[i]);
+        }
+    }
+
+    if (Modes.iqcapture_dir) {
+        printf("Raw sample capture:\n"
+               "  %12llu bytes written\n"
+               "  %12llu bytes left out\n"
+               "  %12u overruns\n"
+               "  %12u files started\n",
+               (unsigned long long)st->iqcapture_bytes,
+               (unsigned long long)st->iqcapture_dropped_bytes,
+               st->iqcapture_overruns,
+               st->iqcapture_files);
+    }
+
     if (Modes.net) {
         printf("Messages from network clients:\n");
         printf("  %8u Mode A/C messages received\n",               st->remote_received_modeac);
@@ -163,7 +230,7 @@ void display_stats(struct stats *st) {
         printf("    %8u with bad message format or invalid CRC\n", st->remote_rejected_bad);
         printf("    %8u with unrecognized ICAO address\n",         st->remote_rejected_unknown_icao);
         printf("    %8u accepted with correct CRC\n",              st->remote_accepted[0]);
-        for (j = 1; j <= Modes.nfix_crc; ++j)
+        for (j = 1; j <= modesMaxCorrectedBits(); ++j)
             printf("    %8u accepted with %d-bit error repaired\n", st->remote_accepted[j], j);
     }
 
@@ -214,15 +281,37 @@ void display_stats(struct stats *st) {
         uint64_t demod_cpu_millis = (uint64_t)st->demod_cpu.tv_sec*1000UL + st->demod_cpu.tv_nsec/1000000UL;
         uint64_t reader_cpu_millis = (uint64_t)st->reader_cpu.tv_sec*1000UL + st->reader_cpu.tv_nsec/1000000UL;
         uint64_t background_cpu_millis = (uint64_t)st->background_cpu.tv_sec*1000UL + st->background_cpu.tv_nsec/1000000UL;
+        uint64_t decode_cpu_millis = (uint64_t)st->decode_cpu.tv_sec*1000UL + st->decode_cpu.tv_nsec/1000000UL;
+        uint64_t track_cpu_millis = (uint64_t)st->track_cpu.tv_sec*1000UL + st->track_cpu.tv_nsec/1000000UL;
+        uint64_t output_cpu_millis = (uint64_t)st->output_cpu.tv_sec*1000UL + st->output_cpu.tv_nsec/1000000UL;
+        uint64_t worker_cpu_millis[MODES_MAX_DEMOD_THREADS];
+        uint64_t total_worker_cpu_millis = 0;
+        unsigned i;
+
+        for (i = 0; i < Modes.demod_threads && i < MODES_MAX_DEMOD_THREADS; ++i) {
+            worker_cpu_millis[i] = (uint64_t)st->demod_worker_cpu[i].tv_sec*1000UL + st->demod_worker_cpu[i].tv_nsec/1000000UL;
+            total_worker_cpu_millis += worker_cpu_millis[i];
+        }
 
         printf("CPU load: %5.1f%%\n"
                "  %5llu ms for demodulation\n"
+               "    %5llu ms of that for decoding messages\n"
+               "    %5llu ms of that for aircraft tracking\n"
+               "    %5llu ms of that for message output\n"
                "  %5llu ms for reading from USB\n"
                "  %5llu ms for network input and background tasks\n",
-               100.0 * (demod_cpu_millis + reader_cpu_millis + background_cpu_millis) / (st->end - st->start + 1),
+               100.0 * (demod_cpu_millis + total_worker_cpu_millis + reader_cpu_millis + background_cpu_millis) / (st->end - st->start + 1),
                (unsigned long long) demod_cpu_millis,
+               (unsigned long long) decode_cpu_millis,
+               (unsigned long long) track_cpu_millis,
+               (unsigned long long) output_cpu_millis,
                (unsigned long long) reader_cpu_millis,
                (unsigned long long) background_cpu_millis);
+
+        if (Modes.demod_threads > 1) {
+            for (i = 0; i < Modes.demod_threads && i < MODES_MAX_DEMOD_THREADS; ++i)
+                printf("  %5llu ms for demodulation in worker %u\n", (unsigned long long) worker_cpu_millis[i], i);
+        }
     }
 
     if (Modes.stats_range_histo)
@@ -298,6 +387,15 @@ static void display_range_histogram(struct stats *st)
     printf("km\n");
 }
 
+void add_fix_stats(const struct fix_stats *st1, const struct fix_stats *st2, struct fix_stats *target) {
+    for (int i = 0; i < FIX_TYPES; ++i) {
+        target->attempts[i] = st1->attempts[i] + st2->attempts[i];
+        target->found[i] = st1->found[i] + st2->found[i];
+        target->accepted[i] = st1->accepted[i] + st2->accepted[i];
+        target->ns[i] = st1->ns[i] + st2->ns[i];
+    }
+}
+
 void reset_stats(struct stats *st) {
     static struct stats st_zero;
     *st = st_zero;
@@ -329,12 +427,38 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
     target->demod_rejected_unknown_icao = st1->demod_rejected_unknown_icao + st2->demod_rejected_unknown_icao;
     for (i = 0; i < MODES_MAX_BITERRORS+1; ++i)
         target->demod_accepted[i]  = st1->demod_accepted[i] + st2->demod_accepted[i];
+    for (i = 0; i < 6; ++i)
+        target->demod_phases_scored[i] = st1->demod_phases_scored[i] + st2->demod_phases_scored[i];
+    target->demod_correlate_preambles = st1->demod_correlate_preambles + st2->demod_correlate_preambles;
+    for (i = 0; i < MODES_MAX_BITERRORS+1; ++i)
+        target->demod_correlate_accepted[i] = st1->demod_correlate_accepted[i] + st2->demod_correlate_accepted[i];
+    target->demod_correlate_only = st1->demod_correlate_only + st2->demod_correlate_only;
+    add_fix_stats(&st1->fix, &st2->fix, &target->fix);
     target->demod_modeac = st1->demod_modeac + st2->demod_modeac;
 
     target->samples_processed = st1->samples_processed + st2->samples_processed;
     target->samples_dropped = st1->samples_dropped + st2->samples_dropped;
+    for (i = 0; i < MAGBUF_DROP_CAUSES; ++i) {
+        target->samples_dropped_by_cause[i] = st1->samples_dropped_by_cause[i] + st2->samples_dropped_by_cause[i];
+        target->discontinuities[i] = st1->discontinuities[i] + st2->discontinuities[i];
+    }
+    for (i = 0; i < MAGBUF_MAX_SOURCES; ++i) {
+        target->source_samples_processed[i] = st1->source_samples_processed[i] + st2->source_samples_processed[i];
+        target->source_samples_dropped[i] = st1->source_samples_dropped[i] + st2->source_samples_dropped[i];
+        target->source_messages[i] = st1->source_messages[i] + st2->source_messages[i];
+        target->source_duplicates[i] = st1->source_duplicates[i] + st2->source_duplicates[i];
+    }
+    target->iqcapture_bytes = st1->iqcapture_bytes + st2->iqcapture_bytes;
+    target->iqcapture_dropped_bytes = st1->iqcapture_dropped_bytes + st2->iqcapture_dropped_bytes;
+    target->iqcapture_overruns = st1->iqcapture_overruns + st2->iqcapture_overruns;
+    target->iqcapture_files = st1->iqcapture_files + st2->iqcapture_files;
 
     add_timespecs(&st1->demod_cpu, &st2->demod_cpu, &target->demod_cpu);
+    add_timespecs(&st1->decode_cpu, &st2->decode_cpu, &target->decode_cpu);
+    add_timespecs(&st1->track_cpu, &st2->track_cpu, &target->track_cpu);
+    add_timespecs(&st1->output_cpu, &st2->output_cpu, &target->output_cpu);
+    for (i = 0; i < MODES_MAX_DEMOD_THREADS; ++i)
+        add_timespecs(&st1->demod_worker_cpu[i], &st2->demod_worker_cpu[i], &target->demod_worker_cpu[i]);
     add_timespecs(&st1->reader_cpu, &st2->reader_cpu, &target->reader_cpu);
     add_timespecs(&st1->background_cpu, &st2->background_cpu, &target->background_cpu);
 
@@ -414,4 +538,20 @@ void add_stats(const struct stats *st1, const struct stats *st2, struct stats *t
     target->adaptive_gain_changes = st1->adaptive_gain_changes + st2->adaptive_gain_changes;
     target->adaptive_noise_dbfs = adaptive_best->adaptive_noise_dbfs;
     target->adaptive_range_gain_limit = adaptive_best->adaptive_range_gain_limit;
+
+    // overload shedding
+
+    const struct stats *overload_best;
+    if (st1->overload_valid && st2->overload_valid)
+        overload_best = newer;
+    else if (st1->overload_valid)
+        overload_best = st1;
+    else
+        overload_best = st2;
+
+    target->overload_valid = overload_best->overload_valid;
+    target->overload_level = overload_best->overload_level;
+    for (unsigned i = 0; i < OVERLOAD_LEVELS; ++i)
+        target->overload_level_seconds[i] = st1->overload_level_seconds[i] + st2->overload_level_seconds[i];
+    target->overload_changes = st1->overload_changes + st2->overload_changes;
 }
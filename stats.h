@@ -60,15 +60,43 @@ struct stats {
     uint32_t demod_rejected_bad;
     uint32_t demod_rejected_unknown_icao;
     uint32_t demod_accepted[MODES_MAX_BITERRORS+1];
+    uint32_t demod_phases_scored[6];               // preambles, by number of phases scored (0-5)
+
+    // Mode S demodulator counts for the correlation preamble detector
+    // (included in the counts above):
+    uint32_t demod_correlate_preambles;
+    uint32_t demod_correlate_accepted[MODES_MAX_BITERRORS+1];
+    uint32_t demod_correlate_only;                 // accepted, but would be missed by the peak/valley tests
+
+    // Mode S error correction work and yield, by correction type:
+    struct fix_stats fix;
 
     // Mode A/C demodulator counts:
     uint32_t demod_modeac;
 
     uint64_t samples_processed;
     uint64_t samples_dropped;
+    uint64_t samples_dropped_by_cause[MAGBUF_DROP_CAUSES];
+    uint32_t discontinuities[MAGBUF_DROP_CAUSES];  // number of discontinuous buffers, by cause
+
+    // per-source figures, when reading from more than one SDR source (--add-source):
+    uint64_t source_samples_processed[MAGBUF_MAX_SOURCES];
+    uint64_t source_samples_dropped[MAGBUF_MAX_SOURCES];
+    uint32_t source_messages[MAGBUF_MAX_SOURCES];    // messages used after duplicate suppression
+    uint32_t source_duplicates[MAGBUF_MAX_SOURCES];  // messages discarded as duplicates of another source's
+
+    // raw sample capture (--iq-capture):
+    uint64_t iqcapture_bytes;           // bytes written to capture files
+    uint64_t iqcapture_dropped_bytes;   // bytes left out because the writer fell behind, or failed
+    uint32_t iqcapture_overruns;        // number of times the writer fell behind
+    uint32_t iqcapture_files;           // number of capture files started
 
     // timing:
     struct timespec demod_cpu;
+    struct timespec decode_cpu;         // parts of demod_cpu: decoding demodulated messages,
+    struct timespec track_cpu;          //   updating aircraft tracks with them,
+    struct timespec output_cpu;         //   and displaying them / queueing network output
+    struct timespec demod_worker_cpu[MODES_MAX_DEMOD_THREADS];
     struct timespec reader_cpu;
     struct timespec background_cpu;
 
@@ -140,12 +168,19 @@ struct stats {
     uint32_t adaptive_gain_changes;                     // Total number of gain changes caused by adaptive gain control
     double adaptive_noise_dbfs;                         // Current adaptive-dynamic-range smoothed noise measurement, dBFS
     int adaptive_range_gain_limit;                      // Current adaptive-dynamic-range gain step limit
+
+    // overload shedding
+    bool overload_valid;                                // is the following data valid?
+    int overload_level;                                 // Current shedding level
+    uint32_t overload_level_seconds[OVERLOAD_LEVELS];   // Seconds spent at each shedding level
+    uint32_t overload_changes;                          // Total number of shedding level changes
 };
 
 void add_stats(const struct stats *st1, const struct stats *st2, struct stats *target);
 void display_stats(struct stats *st);
 void reset_stats(struct stats *st);
 
+void add_fix_stats(const struct fix_stats *st1, const struct fix_stats *st2, struct fix_stats *target);
 void add_timespecs(const struct timespec *x, const struct timespec *y, struct timespec *z);
 
 #endif
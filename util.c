@@ -47,12 +47,13 @@
 //   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 //   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
-// we want pthread_setname_np if available
+// we want pthread_setname_np and pthread_setaffinity_np if available
 #define _GNU_SOURCE
 
 #include "dump1090.h"
 
 #include <stdlib.h>
+#include <sched.h>
 #include <sys/time.h>
 
 uint64_t _messageNow = 0;
@@ -125,6 +126,30 @@ void update_cpu_timing(struct timespec *start_time, struct timespec *add_to)
     *start_time = end_time;
 }
 
+void start_phase_timing(struct timespec *start_time)
+{
+    clock_gettime(CLOCK_MONOTONIC, start_time);
+}
+
+void end_phase_timing(const struct timespec *start_time, struct timespec *add_to)
+{
+    struct timespec end_time;
+    clock_gettime(CLOCK_MONOTONIC, &end_time);
+    add_to->tv_sec += end_time.tv_sec - start_time->tv_sec;
+    add_to->tv_nsec += end_time.tv_nsec - start_time->tv_nsec;
+    normalize_timespec(add_to);
+}
+
+void update_phase_timing(struct timespec *start_time, struct timespec *add_to)
+{
+    struct timespec end_time;
+    clock_gettime(CLOCK_MONOTONIC, &end_time);
+    add_to->tv_sec += end_time.tv_sec - start_time->tv_sec;
+    add_to->tv_nsec += end_time.tv_nsec - start_time->tv_nsec;
+    normalize_timespec(add_to);
+    *start_time = end_time;
+}
+
 void set_thread_name(const char *name)
 {
 #if (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 12)
@@ -145,3 +170,52 @@ int join_thread(pthread_t thread, void **retval, uint32_t timeout_ms)
     return pthread_join(thread, retval);
 #endif
 }
+
+// Record and report a failure to apply part of a thread policy
+static void thread_policy_failed(struct thread_policy *policy, const char *what, const char *action, int err)
+{
+    fprintf(stderr, "%s: can't %s: %s\n", what, action, strerror(err));
+    if (!policy->error[0])
+        snprintf(policy->error, sizeof(policy->error), "%s: %s", action, strerror(err));
+}
+
+bool apply_thread_policy(struct thread_policy *policy, const char *what)
+{
+    char action[64];
+    int err;
+
+    if (policy->pin) {
+        snprintf(action, sizeof(action), "pin to CPU %d", policy->cpu);
+#ifdef __linux__
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        if (policy->cpu < 0 || policy->cpu >= CPU_SETSIZE)
+            err = EINVAL;
+        else {
+            CPU_SET(policy->cpu, &cpus);
+            err = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+        }
+#else
+        err = ENOTSUP;
+#endif
+        if (err)
+            thread_policy_failed(policy, what, action, err);
+        else {
+            fprintf(stderr, "%s: pinned to CPU %d\n", what, policy->cpu);
+            policy->pinned = true;
+        }
+    }
+
+    if (policy->priority) {
+        snprintf(action, sizeof(action), "set SCHED_FIFO priority %d", policy->priority);
+        struct sched_param param = { .sched_priority = policy->priority };
+        if ((err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param)))
+            thread_policy_failed(policy, what, action, err);
+        else {
+            fprintf(stderr, "%s: running with SCHED_FIFO priority %d\n", what, policy->priority);
+            policy->realtime = true;
+        }
+    }
+
+    return (policy->pinned == policy->pin && policy->realtime == (policy->priority != 0));
+}
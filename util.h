@@ -21,6 +21,7 @@
 #define DUMP1090_UTIL_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <pthread.h>
 
 /* Returns system time in milliseconds */
@@ -58,6 +59,14 @@ void end_cpu_timing(const struct timespec *start_time, struct timespec *add_to);
 /* like end_cpu_timing followed by start_cpu_timing, but without a gap */
 void update_cpu_timing(struct timespec *start_time, struct timespec *add_to);
 
+/* As start_cpu_timing / end_cpu_timing / update_cpu_timing, but using the
+ * monotonic clock, which is several times cheaper to read than the CPU time.
+ * For splitting the CPU time of a thread between short phases of work that
+ * don't block, where elapsed time and CPU time are the same. */
+void start_phase_timing(struct timespec *start_time);
+void end_phase_timing(const struct timespec *start_time, struct timespec *add_to);
+void update_phase_timing(struct timespec *start_time, struct timespec *add_to);
+
 /* set current thread name, if supported */
 void set_thread_name(const char *name);
 
@@ -66,4 +75,22 @@ void set_thread_name(const char *name);
  */
 int join_thread(pthread_t thread, void **retval, uint32_t timeout_ms);
 
+/* CPU affinity and real-time priority requested for a thread, and what
+ * was actually applied
+ */
+struct thread_policy {
+    bool pin;           // pin the thread to 'cpu'?
+    int  cpu;           // CPU to pin to
+    int  priority;      // SCHED_FIFO priority, 0 for default scheduling
+    bool pinned;        // the thread was pinned to 'cpu'
+    bool realtime;      // the thread was given SCHED_FIFO 'priority'
+    char error[128];    // description of the first failure, empty if none
+};
+
+/* apply 'policy' to the current thread, recording what was applied; failures
+ * are reported on stderr, naming the thread as `what`. Returns true if
+ * everything requested was applied.
+ */
+bool apply_thread_policy(struct thread_policy *policy, const char *what);
+
 #endif